@@ -0,0 +1,172 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Python/Games/VectorEnv.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/VectorEnv.hpp>
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include <optional>
+#include <stdexcept>
+
+using namespace RosettaStone;
+
+namespace
+{
+using ActionArray =
+    pybind11::array_t<std::int32_t, pybind11::array::c_style |
+                                        pybind11::array::forcecast>;
+
+std::unique_ptr<VectorEnv> CreateVectorEnv(
+    std::size_t numEnvs, CardClass player1Class, CardClass player2Class,
+    const std::vector<std::string>& player1Deck,
+    const std::vector<std::string>& player2Deck, std::size_t numThreads,
+    std::optional<std::uint64_t> seed)
+{
+    if (player1Deck.size() > START_DECK_SIZE ||
+        player2Deck.size() > START_DECK_SIZE)
+    {
+        throw std::invalid_argument(
+            "VectorEnv() - The number of cards in deck is too large!");
+    }
+
+    GameConfig config;
+    config.player1Class = player1Class;
+    config.player2Class = player2Class;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doFillDecks = player1Deck.empty() && player2Deck.empty();
+    config.seed = seed;
+
+    for (std::size_t i = 0; i < player1Deck.size(); ++i)
+    {
+        config.player1Deck[i] = Cards::FindCardByID(player1Deck[i]);
+    }
+    for (std::size_t i = 0; i < player2Deck.size(); ++i)
+    {
+        config.player2Deck[i] = Cards::FindCardByID(player2Deck[i]);
+    }
+
+    // Creating games can take a while, so other Python threads can run
+    pybind11::gil_scoped_release release;
+    return std::make_unique<VectorEnv>(config, numEnvs, numThreads);
+}
+
+//! Creates an array that refers to \p data of \p self without copying.
+template <typename T>
+pybind11::array_t<T> CreateView(const pybind11::object& self, const T* data,
+                                std::vector<pybind11::ssize_t> shape)
+{
+    std::vector<pybind11::ssize_t> strides(shape.size(), sizeof(T));
+    for (std::size_t i = shape.size() - 1; i > 0; --i)
+    {
+        strides[i - 1] = strides[i] * shape[i];
+    }
+
+    // NOTE: self is the base of the array, so the environment outlives it
+    pybind11::array_t<T> array(std::move(shape), std::move(strides), data,
+                               self);
+    array.attr("flags").attr("writeable") = false;
+
+    return array;
+}
+}  // namespace
+
+void AddVectorEnv(pybind11::module& m)
+{
+    pybind11::class_<VectorEnv> env(m, "VectorEnv");
+
+    env.attr("NUM_FEATURES") = VectorEnv::NUM_FEATURES;
+    env.attr("NUM_ACTIONS") = VectorEnv::NUM_ACTIONS;
+
+    env.def(pybind11::init(&CreateVectorEnv),
+            R"pbdoc(Creates games that are stepped in parallel.
+
+            Parameters
+            ----------
+            num_envs : The number of games.
+            player1_class : The class of the first player.
+            player2_class : The class of the second player.
+            player1_deck : The card IDs of the deck of the first player.
+            player2_deck : The card IDs of the deck of the second player.
+            If both decks are empty, they are filled with basic cards.
+            num_threads : The number of threads, 0 for all hardware threads.
+            seed : The seed of the games, random if it is None.)pbdoc",
+            pybind11::arg("num_envs"), pybind11::arg("player1_class"),
+            pybind11::arg("player2_class"),
+            pybind11::arg("player1_deck") = std::vector<std::string>(),
+            pybind11::arg("player2_deck") = std::vector<std::string>(),
+            pybind11::arg("num_threads") = 0,
+            pybind11::arg("seed") = pybind11::none())
+        .def("__len__", &VectorEnv::GetNumEnvs)
+        .def("reset", &VectorEnv::Reset,
+             pybind11::call_guard<pybind11::gil_scoped_release>(),
+             R"pbdoc(Restarts all games.)pbdoc")
+        .def(
+            "step",
+            [](VectorEnv& self, const ActionArray& actions) {
+                if (actions.ndim() != 1 ||
+                    static_cast<std::size_t>(actions.size()) !=
+                        self.GetNumEnvs())
+                {
+                    throw std::invalid_argument(
+                        "VectorEnv::Step() - The number of actions is "
+                        "mismatched!");
+                }
+
+                const std::int32_t* data = actions.data();
+                pybind11::gil_scoped_release release;
+                self.Step(data);
+            },
+            R"pbdoc(Applies an action to each game and restarts the games that are over.
+
+            Parameters
+            ----------
+            actions : The int32 array of shape [N] that has an action index of each game.)pbdoc",
+            pybind11::arg("actions"))
+        .def_property_readonly(
+            "observations",
+            [](const pybind11::object& self) {
+                const auto& env = self.cast<const VectorEnv&>();
+                return CreateView(
+                    self, env.GetObservations(),
+                    { static_cast<pybind11::ssize_t>(env.GetNumEnvs()),
+                      static_cast<pybind11::ssize_t>(
+                          VectorEnv::NUM_FEATURES) });
+            },
+            R"pbdoc(The float32 array of shape [N, NUM_FEATURES] without copying.)pbdoc")
+        .def_property_readonly(
+            "action_masks",
+            [](const pybind11::object& self) {
+                const auto& env = self.cast<const VectorEnv&>();
+                return CreateView(
+                    self, env.GetActionMasks(),
+                    { static_cast<pybind11::ssize_t>(env.GetNumEnvs()),
+                      static_cast<pybind11::ssize_t>(
+                          VectorEnv::NUM_ACTIONS) });
+            },
+            R"pbdoc(The uint8 array of shape [N, NUM_ACTIONS] without copying.)pbdoc")
+        .def_property_readonly(
+            "rewards",
+            [](const pybind11::object& self) {
+                const auto& env = self.cast<const VectorEnv&>();
+                return CreateView(
+                    self, env.GetRewards(),
+                    { static_cast<pybind11::ssize_t>(env.GetNumEnvs()) });
+            },
+            R"pbdoc(The float32 array of shape [N] without copying.)pbdoc")
+        .def_property_readonly(
+            "dones",
+            [](const pybind11::object& self) {
+                const auto& env = self.cast<const VectorEnv&>();
+                return CreateView(
+                    self, env.GetDones(),
+                    { static_cast<pybind11::ssize_t>(env.GetNumEnvs()) });
+            },
+            R"pbdoc(The uint8 array of shape [N] without copying.)pbdoc");
+}
@@ -21,6 +21,8 @@
 #include <Python/Enums/TaskEnums.hpp>
 #include <Python/Enums/TriggerEnums.hpp>
 
+#include <Python/Games/VectorEnv.hpp>
+
 #include <Python/Loaders/AccountLoader.hpp>
 #include <Python/Loaders/InternalCardLoader.hpp>
 #include <Python/Loaders/TargetingPredicates.hpp>
@@ -53,6 +55,9 @@ PYBIND11_MODULE(pyRosetta, m)
     AddTaskEnums(m);
     AddTriggerEnums(m);
 
+    // Games
+    AddVectorEnv(m);
+
     // Loaders
     AddAccountLoader(m);
     AddInternalCardLoader(m);
@@ -14,9 +14,11 @@
 #include <Agents/MCTSRunner.hpp>
 #include <MCTS/Selection/TreeNode.hpp>
 
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
-using Random = effolkronium::random_static;
+#include <algorithm>
+#include <chrono>
+#include <memory>
 
 namespace RosettaTorch::Agents
 {
@@ -90,23 +92,37 @@ class MCTSAgent
     {
         m_callback.BeforeThink(gameState);
 
-        m_controller.reset(new MCTSRunner(m_config));
+        // The runner keeps its threads and trees across actions
+        if (!m_controller)
+        {
+            m_controller = std::make_unique<MCTSRunner>(m_config);
+        }
         m_controller->Run(gameState);
 
+        using Clock = std::chrono::steady_clock;
+        using Milliseconds = std::chrono::milliseconds;
+        const auto deadline =
+            Clock::now() + Milliseconds(m_config.thinkTimeLimit);
+
         while (true)
         {
-            const uint64_t iterations =
-                m_controller->GetStatistics().GetSuccededIterates();
-            m_callback.Think(gameState, iterations);
+            auto timeout = Milliseconds(m_config.callbackInterval);
+            if (m_config.thinkTimeLimit > 0)
+            {
+                timeout = std::min(timeout,
+                                   std::chrono::duration_cast<Milliseconds>(
+                                       deadline - Clock::now()));
+            }
+
+            const bool isIterated = m_controller->WaitForIterations(timeout);
+            m_callback.Think(
+                gameState, m_controller->GetStatistics().GetSuccededIterates());
 
-            if (iterations >=
-                static_cast<uint64_t>(m_config.iterationsPerAction))
+            if (isIterated ||
+                (m_config.thinkTimeLimit > 0 && Clock::now() >= deadline))
             {
                 break;
             }
-
-            std::this_thread::sleep_for(
-                std::chrono::milliseconds(m_config.callbackInterval));
         }
 
         m_controller->WaitUntilStopped();
@@ -191,7 +207,9 @@ class MCTSAgent
             item.value = accumulated;
         }
 
-        const auto v = Random::get<double>(0.0, accumulated);
+        RandomGenerator& random = RandomGenerator::GetThreadLocal();
+
+        const auto v = random.Get<double>(0.0, accumulated);
         for (const auto& item : items)
         {
             if (v < item.value)
@@ -203,7 +221,7 @@ class MCTSAgent
 
         // If goes here, the only possible reason is we don't have any child
         // nodes no any choice is evaluated. randomly choose one.
-        return Random::get<int>(0, choices.Size() - 1);
+        return random.Get<int>(0, choices.Size() - 1);
     }
 
  private:
@@ -25,6 +25,10 @@ struct MCTSConfig
         : threads(1),
           iterationsPerAction(10000),
           callbackInterval(1000),
+          thinkTimeLimit(0),
+          inferenceBatchSize(1),
+          inferenceMaxWait(100),
+          reuseTree(true),
           mcts(),
           actionFollowTemperature(0.0)
     {
@@ -35,6 +39,19 @@ struct MCTSConfig
 
     int iterationsPerAction;
     int callbackInterval;
+    //! The maximum time in milliseconds to think for an action.
+    //! The agent thinks until it iterates enough if it is 0.
+    int thinkTimeLimit;
+
+    //! The maximum number of leaf states to evaluate in one forward pass.
+    //! The threads share one network if it is greater than 1.
+    int inferenceBatchSize;
+    //! The maximum time in microseconds that a leaf state waits for a batch.
+    int inferenceMaxWait;
+
+    //! The flag indicates whether to search from the subtree of the previous
+    //! search that matches the current board.
+    bool reuseTree;
 
     MCTS::Config mcts;
 
@@ -17,6 +17,12 @@
 
 #include <Rosetta/Cards/Cards.hpp>
 
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
 #include <thread>
 
 namespace RosettaTorch::Agents
@@ -24,7 +30,11 @@ namespace RosettaTorch::Agents
 //!
 //! \brief MCTSRunner class.
 //!
-//! This class runs multi-thread MCTS with simple statistics.
+//! This class runs multi-thread MCTS with simple statistics. The threads are
+//! created at the first search and wait for the next search between moves.
+//! The trees are kept between searches, and a search starts from the node of
+//! the previous tree that matches the current board if it exists. The nodes
+//! that can't be reached anymore are freed on a background thread.
 //!
 class MCTSRunner
 {
@@ -33,13 +43,31 @@ class MCTSRunner
     //! \param config The MCTS config.
     explicit MCTSRunner(const MCTSConfig& config);
 
-    //! Destructs MCTS runner.
+    //! Destructs MCTS runner. It stops the search and the threads.
     ~MCTSRunner();
 
-    //! Runs MCTS as many threads as you set in config.
+    //! Deleted copy constructor.
+    MCTSRunner(const MCTSRunner&) = delete;
+
+    //! Deleted move constructor.
+    MCTSRunner(MCTSRunner&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    MCTSRunner& operator=(const MCTSRunner&) = delete;
+
+    //! Deleted move assignment operator.
+    MCTSRunner& operator=(MCTSRunner&&) noexcept = delete;
+
+    //! Starts a new search on as many threads as you set in config. The
+    //! previous search is stopped if it is still running.
     //! \param view The board ref view to set game state.
     void Run(const BoardRefView& view);
 
+    //! Waits until the search iterates as many times as you set in config.
+    //! \param timeout The maximum time to wait.
+    //! \return The flag indicates whether the search iterated enough.
+    bool WaitForIterations(std::chrono::milliseconds timeout);
+
     //! Returns the statistics of MCTS runner.
     //! \return The statistics of MCTS runner.
     const MCTS::Statistics<>& GetStatistics() const;
@@ -49,21 +77,107 @@ class MCTSRunner
     //! \return The root node of the tree.
     const MCTS::TreeNode* GetRootNode(PlayerType playerType) const;
 
+    //! Saves the tree of \p playerType to the file of \p path. The search
+    //! is stopped if it is running.
+    //! \param playerType The type of player.
+    //! \param path The path of the file.
+    void SaveTree(PlayerType playerType, const std::string& path);
+
+    //! Loads the tree of \p playerType from the file of \p path. The
+    //! search is stopped if it is running. The next search of the player
+    //! starts from the loaded tree if it is run on the board that the tree
+    //! was saved for.
+    //! \param playerType The type of player.
+    //! \param path The path of the file.
+    void LoadTree(PlayerType playerType, const std::string& path);
+
     //! Notifies threads to stop.
     void NotifyStop();
 
-    //! Waits until all threads stop.
+    //! Notifies threads to stop and waits until they finish the search.
     void WaitUntilStopped();
 
  private:
+    //!
+    //! \brief SearchTree struct.
+    //!
+    //! This struct contains the tree of a player and the node that a search
+    //! starts from.
+    //!
+    struct SearchTree
+    {
+        std::unique_ptr<MCTS::TreeNode> tree;
+        MCTS::TreeNode* root = nullptr;
+
+        //! The board node map of the node where the turn started. The boards
+        //! after the actions of the root are looked up in this map.
+        MCTS::BoardNodeMap* redirectNodeMap = nullptr;
+
+        //! The hash of the board that the loaded tree was saved for, or 0
+        //! if the tree isn't loaded.
+        std::uint64_t loadedBoardHash = 0;
+    };
+
+    using Trees = std::vector<std::unique_ptr<MCTS::TreeNode>>;
+
+    //! Prepares the trees of the players to search \p view.
+    //! \param view The board ref view to search.
+    void PrepareTrees(const BoardRefView& view);
+
+    //! Moves the root of \p tree to the node that matches \p view.
+    //! \param tree The tree to promote the node.
+    //! \param view The board ref view to search.
+    //! \param isSameTurn The flag indicates whether the previous search was
+    //! in the same turn.
+    //! \param garbage The trees that can't be reached anymore.
+    //! \return The flag indicates whether the node is found.
+    static bool PromoteSubtree(SearchTree& tree, const BoardRefView& view,
+                               bool isSameTurn, Trees& garbage);
+
+    //! Replaces \p tree with a new tree.
+    //! \param tree The tree to reset.
+    //! \param garbage The trees that can't be reached anymore.
+    static void ResetTree(SearchTree& tree, Trees& garbage);
+
+    //! Collapses the least visited subtrees of the trees until they have
+    //! half of MCTS::Config::maxTreeNodes, so the next search has room to
+    //! grow. The roots and their ancestors are kept. The node budget is set
+    //! to the number of nodes that are left.
+    void PruneTrees();
+
+    //! Frees \p trees on a background thread.
+    //! \param trees The trees to free.
+    void ReleaseTrees(Trees trees);
+
+    //! Waits for a search and runs it until the runner stops.
+    void RunThread();
+
+    //! Runs the search on \p gameState until it is notified to stop.
+    //! \param gameState The board ref view to set game state.
+    void Search(const BoardRefView& gameState);
+
     MCTSConfig m_config;
     std::vector<std::thread> m_threads;
 
-    MCTS::TreeNode m_p1Tree;
-    MCTS::TreeNode m_p2Tree;
-    MCTS::Statistics<> m_statistics;
+    SearchTree m_p1Tree;
+    SearchTree m_p2Tree;
+    std::unique_ptr<MCTS::Statistics<>> m_statistics;
+    std::thread m_releaseThread;
+
+    PlayerType m_lastSide = PlayerType::INVALID;
+    int m_lastTurn = 0;
+    std::uint64_t m_lastBoardHash = 0;
+
+    std::mutex m_mutex;
+    std::condition_variable m_searchCV;
+    std::condition_variable m_progressCV;
+    std::optional<BoardRefView> m_gameState;
+    std::size_t m_searchID = 0;
+    int m_numRunningThreads = 0;
+    bool m_shutdownFlag = false;
 
     std::atomic_bool m_stopFlag = false;
+    std::atomic_bool m_isIterated = false;
 };
 }  // namespace RosettaTorch::Agents
 
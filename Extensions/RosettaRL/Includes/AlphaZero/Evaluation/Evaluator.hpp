@@ -17,10 +17,7 @@
 #include <NeuralNet/NeuralNetwork.hpp>
 
 #include <Rosetta/Commons/DeckCode.hpp>
-
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
 namespace RosettaTorch::AlphaZero::Evaluation
 {
@@ -78,7 +75,8 @@ class Evaluator
             Agents::MCTSAgent<> bestAgent(bestAgentConfig);
             Agents::MCTSAgent<> competitorAgent(competitorAgentConfig);
 
-            bool isCompetitorFirst = Random::get<int>(0, 1) == 0;
+            bool isCompetitorFirst =
+                RandomGenerator::GetThreadLocal().Get<int>(0, 1) == 0;
 
             if (isCompetitorFirst)
             {
@@ -102,13 +100,9 @@ class Evaluator
 
             const std::string INNKEEPER_EXPERT_WARLOCK =
                 "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
-            auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
-
-            for (std::size_t j = 0; j < deck.size(); ++j)
-            {
-                gameConfig.player1Deck[j] = *Cards::FindCardByID(deck[j]);
-                gameConfig.player2Deck[j] = *Cards::FindCardByID(deck[j]);
-            }
+            const auto& deck = DeckCode::GetDeck(INNKEEPER_EXPERT_WARLOCK);
+            gameConfig.player1Deck = deck;
+            gameConfig.player2Deck = deck;
 
             Game game(gameConfig);
             auto [p1Result, p2Result] = judger.Start(game);
@@ -15,13 +15,16 @@
 #include <AlphaZero/SelfPlay/RunOptions.hpp>
 #include <AlphaZero/SelfPlay/RunResult.hpp>
 #include <AlphaZero/Training/TrainingData.hpp>
-#include <Judges/JSON/Recorder.hpp>
+#include <Judges/Binary/Reader.hpp>
+#include <Judges/Binary/RecordFile.hpp>
+#include <Judges/Binary/Recorder.hpp>
 #include <Judges/Judger.hpp>
 #include <NeuralNet/NeuralNetwork.hpp>
 
 #include <Rosetta/Commons/DeckCode.hpp>
 
 #include <chrono>
+#include <memory>
 
 namespace RosettaTorch::AlphaZero::SelfPlay
 {
@@ -89,8 +92,9 @@ class SelfPlayer
         {
             using MCTSAgent = Agents::MCTSAgent<AgentCallback>;
 
-            Judges::JSON::Recorder recorder;
-            Judges::Judger<MCTSAgent, Judges::JSON::Recorder> judger(recorder);
+            Judges::Binary::Recorder recorder;
+            Judges::Judger<MCTSAgent, Judges::Binary::Recorder> judger(
+                recorder);
             MCTSAgent p1Agent(m_config.agentConfig, AgentCallback(m_logger));
             MCTSAgent p2Agent(m_config.agentConfig, AgentCallback(m_logger));
 
@@ -108,22 +112,18 @@ class SelfPlayer
 
             const std::string INNKEEPER_EXPERT_WARLOCK =
                 "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
-            auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
-
-            for (std::size_t j = 0; j < deck.size(); ++j)
-            {
-                gameConfig.player1Deck[j] = *Cards::FindCardByID(deck[j]);
-                gameConfig.player2Deck[j] = *Cards::FindCardByID(deck[j]);
-            }
+            const auto& deck = DeckCode::GetDeck(INNKEEPER_EXPERT_WARLOCK);
+            gameConfig.player1Deck = deck;
+            gameConfig.player2Deck = deck;
 
             Game game(gameConfig);
             judger.Start(game);
 
-            SaveJSON(recorder.GetJSON());
+            SaveRecord(recorder.GetRecord());
 
-            Judges::JSON::Reader reader;
-            reader.Parse(recorder.GetJSON(),
-                         [&](const Judges::JSON::NeuralNetInputGetter& input,
+            Judges::Binary::Reader reader;
+            reader.Parse(recorder.GetRecord(),
+                         [&](const Judges::Binary::NeuralNetInputGetter& input,
                              int label) {
                              m_data->Push(std::make_shared<TrainingDataItem>(
                                  input, label));
@@ -140,9 +140,9 @@ class SelfPlayer
     //! Removes temp file.
     void RemoveTempFile();
 
-    //! Saves recorder data to JSON file.
-    //! \param json The JSON object.
-    void SaveJSON(const nlohmann::json& json);
+    //! Appends recorder data to the shard of the self player.
+    //! \param record The game record.
+    void SaveRecord(const Judges::Binary::GameRecord& record);
 
     ILogger& m_logger;
     TrainingData* m_data = nullptr;
@@ -150,6 +150,7 @@ class SelfPlayer
     RunResult m_result;
 
     std::string m_tempFile;
+    std::shared_ptr<Judges::Binary::RecordWriter> m_writer;
 };
 }  // namespace RosettaTorch::AlphaZero::SelfPlay
 
@@ -14,9 +14,8 @@
 #include <AlphaZero/Utils/CircularArray.hpp>
 #include <AlphaZero/Utils/SharedPtrItem.hpp>
 
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
-using Random = effolkronium::random_static;
 
 namespace RosettaTorch::AlphaZero
 {
@@ -54,7 +53,8 @@ class TrainingData
         // to actually fetch an item which is already written by a writer. But
         // noted that we still has a chance to get an empty (or very old data)
         // if the writer is slow.
-        const std::size_t idx = Random::get<std::size_t>(0, m_size.load() - 1);
+        auto& random = RosettaStone::RandomGenerator::GetThreadLocal();
+        const std::size_t idx = random.Get<std::size_t>(0, m_size.load() - 1);
 
         // Acquire ownership, so it will not be rotated out.
         const auto sharedPtrItem = m_data.GetRandom(idx).Get();
@@ -10,7 +10,7 @@
 #ifndef ROSETTASTONE_TORCH_ALPHA_ZERO_TRAINING_DATA_ITEM_HPP
 #define ROSETTASTONE_TORCH_ALPHA_ZERO_TRAINING_DATA_ITEM_HPP
 
-#include <Judges/JSON/Reader.hpp>
+#include <Judges/Binary/Reader.hpp>
 
 namespace RosettaTorch::AlphaZero
 {
@@ -25,18 +25,18 @@ class TrainingDataItem
     //! Constructs training data item with given \p input and \p label.
     //! \param input The getter for input of the neural network.
     //! \param label The label of the training data.
-    TrainingDataItem(Judges::JSON::NeuralNetInputGetter input, int label);
+    TrainingDataItem(Judges::Binary::NeuralNetInputGetter input, int label);
 
     //! Gets the getter for input of the neural network.
     //! \return The getter for input of the neural network.
-    const Judges::JSON::NeuralNetInputGetter& GetInput() const;
+    const Judges::Binary::NeuralNetInputGetter& GetInput() const;
 
     //! Gets the label of the training data.
     //! \return The label of the training data.
     int GetLabel() const;
 
  private:
-    Judges::JSON::NeuralNetInputGetter m_input;
+    Judges::Binary::NeuralNetInputGetter m_input;
     int m_label;
 };
 }  // namespace RosettaTorch::AlphaZero
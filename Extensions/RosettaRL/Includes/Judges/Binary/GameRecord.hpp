@@ -0,0 +1,193 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_JUDGES_BINARY_GAME_RECORD_HPP
+#define ROSETTASTONE_TORCH_JUDGES_BINARY_GAME_RECORD_HPP
+
+#include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Enums/CardEnums.hpp>
+#include <Rosetta/Games/Game.hpp>
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace RosettaTorch::Judges::Binary
+{
+//! The type of the entry of game record.
+enum class EntryType : std::uint8_t
+{
+    MAIN_ACTION,
+    RANDOM,
+    MANUAL,
+    END
+};
+
+//! The result of the game.
+enum class GameResult : std::uint8_t
+{
+    INVALID,
+    PLAYER1_WIN,
+    PLAYER2_WIN,
+    DRAW
+};
+
+//! The type of the choices of the manual action.
+enum class ChoicesType : std::uint8_t
+{
+    INVALID,
+    CHOOSE_FROM_NUMBERS,
+    CHOOSE_FROM_CARD_IDS
+};
+
+//! The flags of the minion in the snapshot.
+enum MinionFlag : std::uint8_t
+{
+    ATTACKABLE = 1 << 0,
+    TAUNT = 1 << 1,
+    DIVINE_SHIELD = 1 << 2,
+    STEALTH = 1 << 3
+};
+
+//!
+//! \brief MinionSnapshot struct.
+//!
+//! This struct holds the fields of a minion that the neural network reads.
+//!
+struct MinionSnapshot
+{
+    std::int16_t attack;
+    std::int16_t health;
+    std::int16_t maxHealth;
+    std::uint8_t flags;
+    std::uint8_t reserved;
+};
+
+//!
+//! \brief HandCardSnapshot struct.
+//!
+//! This struct holds the fields of a card in hand that the neural network
+//! reads.
+//!
+struct HandCardSnapshot
+{
+    std::int16_t cost;
+    std::uint8_t playable;
+    std::uint8_t reserved;
+};
+
+//!
+//! \brief SideSnapshot struct.
+//!
+//! This struct holds the fields of a player that the neural network reads.
+//!
+struct SideSnapshot
+{
+    std::int16_t manaRemaining;
+    std::int16_t manaTotal;
+    std::int16_t overloadOwed;
+    std::int16_t overloadLocked;
+    std::int16_t heroHealth;
+    std::int16_t heroArmor;
+    std::uint8_t heroPowerPlayable;
+    std::uint8_t numMinions;
+    std::uint8_t numHandCards;
+    std::uint8_t reserved;
+    MinionSnapshot minions[RosettaStone::MAX_FIELD_SIZE];
+    HandCardSnapshot hand[RosettaStone::MAX_HAND_SIZE];
+};
+
+//!
+//! \brief StateSnapshot struct.
+//!
+//! This struct is a compact snapshot of the game that is taken before a main
+//! action. It holds the same fields as the JSON object of JSONSerializer
+//! that the neural network reads, but it takes a few hundred bytes.
+//!
+struct StateSnapshot
+{
+    //! Takes the snapshot of \p game seen by the current player.
+    //! \param game The game context.
+    //! \param entryIdx The index of the entry of the main action.
+    //! \return The snapshot of \p game.
+    static StateSnapshot Capture(RosettaStone::Game& game,
+                                 std::uint32_t entryIdx);
+
+    std::uint32_t entryIdx;
+    std::uint8_t currentPlayer;
+    std::uint8_t reserved[3];
+    SideSnapshot current;
+    SideSnapshot opponent;
+};
+
+//!
+//! \brief Entry struct.
+//!
+//! This struct is an entry of the action log of game record.
+//!   - MAIN_ACTION: value is the main operation type.
+//!   - RANDOM: value is the number of available actions and choice is the
+//!     index of the selected one.
+//!   - MANUAL: actionType and choicesType are the types of the action,
+//!     numChoices choices follow in the pool and choice is the selected one.
+//!   - END: value is the result of the game.
+//!
+struct Entry
+{
+    EntryType type;
+    std::uint8_t actionType;
+    ChoicesType choicesType;
+    std::uint8_t reserved;
+    std::int32_t value;
+    std::int32_t choice;
+    std::uint32_t numChoices;
+};
+
+static_assert(sizeof(MinionSnapshot) == 8, "The size must be fixed");
+static_assert(sizeof(HandCardSnapshot) == 4, "The size must be fixed");
+static_assert(sizeof(SideSnapshot) == 112, "The size must be fixed");
+static_assert(sizeof(StateSnapshot) == 232, "The size must be fixed");
+static_assert(sizeof(Entry) == 16, "The size must be fixed");
+
+//!
+//! \brief GameRecord class.
+//!
+//! This class is the record of a game in binary form. It consists of the log
+//! of all actions and the snapshots of some main actions. The serialized
+//! form is a fixed header followed by the entries, the choices of manual
+//! actions and the snapshots, so it can be read back with a few copies.
+//!
+class GameRecord
+{
+ public:
+    //! Removes all data.
+    void Clear();
+
+    //! Appends the serialized form of the record to \p data.
+    //! \param data The buffer to append.
+    void Serialize(std::string& data) const;
+
+    //! Reads the record from the serialized form.
+    //! \param data The serialized form.
+    //! \param size The size of \p data.
+    //! \return true if \p data is a valid record, false otherwise.
+    bool Deserialize(const char* data, std::size_t size);
+
+    //! Returns the result of the game from the results of both players.
+    //! \param result The result of the game (player1 and player2).
+    //! \return The result of the game.
+    static GameResult GetResult(
+        const std::tuple<RosettaStone::PlayState, RosettaStone::PlayState>&
+            result);
+
+    std::vector<Entry> entries;
+    std::vector<std::int32_t> choices;
+    std::vector<StateSnapshot> snapshots;
+    GameResult result = GameResult::INVALID;
+};
+}  // namespace RosettaTorch::Judges::Binary
+
+#endif  // ROSETTASTONE_TORCH_JUDGES_BINARY_GAME_RECORD_HPP
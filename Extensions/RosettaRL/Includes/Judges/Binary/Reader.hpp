@@ -0,0 +1,91 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_JUDGES_BINARY_READER_HPP
+#define ROSETTASTONE_TORCH_JUDGES_BINARY_READER_HPP
+
+#include <Judges/Binary/GameRecord.hpp>
+#include <NeuralNet/IInputGetter.hpp>
+
+#include <json/json.hpp>
+
+namespace RosettaTorch::Judges::Binary
+{
+//!
+//! \brief NeuralNetInputGetter class.
+//!
+//! This class inherits from NeuralNet::IInputGetter class. It reads the
+//! fields from a snapshot of game record.
+//!
+class NeuralNetInputGetter : public NeuralNet::IInputGetter
+{
+ public:
+    //! Constructs neural net input getter with given \p snapshot.
+    //! \param snapshot The snapshot of the game.
+    explicit NeuralNetInputGetter(const StateSnapshot& snapshot);
+
+    //! Returns the value of the field.
+    //! Note that boolean value is 1 for true, 0 for false.
+    //! \param fieldSide The side of the field.
+    //! \param fieldType The type of the field.
+    //! \param arg The argument such as the index of minion in field zone.
+    //! \return The value of the field.
+    double GetField(NeuralNet::FieldSide fieldSide,
+                    NeuralNet::FieldType fieldType, int arg = 0) const final;
+
+    //! Writes all values in the layout of RosettaStone::FeatureEncoder.
+    //! \param data The buffer that has room for FeatureEncoder::NUM_FEATURES
+    //! floats.
+    //! \return The flag indicates whether the values are written. It is
+    //! false if the counts of minions or cards of the snapshot are out of
+    //! range.
+    bool Encode(float* data) const final;
+
+ private:
+    StateSnapshot m_snapshot;
+};
+
+//!
+//! \brief Reader class.
+//!
+//! This class reads the training data from game record.
+//!
+class Reader
+{
+ public:
+    //! Runs function to add data for each snapshot of the record.
+    //! \param record The game record.
+    //! \param callback A function to add data.
+    template <class Callback>
+    void Parse(const GameRecord& record, Callback&& callback) const
+    {
+        for (const StateSnapshot& snapshot : record.snapshots)
+        {
+            const int label =
+                IsCurrentPlayerWin(snapshot, record.result) ? 1 : -1;
+            callback(NeuralNetInputGetter(snapshot), label);
+        }
+    }
+
+    //! Converts the record to JSON object in the format of JSON::Recorder.
+    //! It is for debugging, and the field of a main action contains only
+    //! the values that the neural network reads. The main actions without
+    //! snapshot have no field.
+    //! \param record The game record.
+    //! \return The JSON object that contains the game data.
+    static nlohmann::json ToJSON(const GameRecord& record);
+
+ private:
+    //! Returns the flag whether the current player won the game.
+    //! \param snapshot The snapshot of the game.
+    //! \param result The result of the game.
+    //! \return The flag whether the current player won the game.
+    static bool IsCurrentPlayerWin(const StateSnapshot& snapshot,
+                                   GameResult result);
+};
+}  // namespace RosettaTorch::Judges::Binary
+
+#endif  // ROSETTASTONE_TORCH_JUDGES_BINARY_READER_HPP
@@ -0,0 +1,145 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_JUDGES_BINARY_RECORD_FILE_HPP
+#define ROSETTASTONE_TORCH_JUDGES_BINARY_RECORD_FILE_HPP
+
+#include <Judges/Binary/GameRecord.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace RosettaTorch::Judges::Binary
+{
+//! The compression of the records in a shard.
+//! NOTE: Only NONE is supported now. The frame of a record stores the sizes
+//! before and after compression, so a block codec can be added without
+//! changing the layout.
+enum class Compression : std::uint32_t
+{
+    NONE
+};
+
+//!
+//! \brief RecordWriter class.
+//!
+//! This class appends game records to shard files. A shard is named
+//! "(prefix)-(index).rsgr" in the directory and starts with a header, and
+//! each record is framed by its size and checksum. A new shard is started
+//! when the current one exceeds the maximum size. A shard is created
+//! exclusively and a writer never opens an existing shard, so several
+//! writers, even in other processes, can append to the same data set.
+//! Write() can be called from multiple threads.
+//!
+class RecordWriter
+{
+ public:
+    //! Constructs record writer with given \p dirName, \p prefix,
+    //! \p maxShardSize and \p compression.
+    //! \param dirName The directory to write shards.
+    //! \param prefix The prefix of the names of shards.
+    //! \param maxShardSize The size to start a new shard.
+    //! \param compression The compression of the records.
+    RecordWriter(std::string dirName, std::string prefix,
+                 std::size_t maxShardSize = 64 * 1024 * 1024,
+                 Compression compression = Compression::NONE);
+
+    //! Destructor.
+    ~RecordWriter();
+
+    //! Deleted copy constructor.
+    RecordWriter(const RecordWriter&) = delete;
+
+    //! Deleted move constructor.
+    RecordWriter(RecordWriter&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    RecordWriter& operator=(const RecordWriter&) = delete;
+
+    //! Deleted move assignment operator.
+    RecordWriter& operator=(RecordWriter&&) noexcept = delete;
+
+    //! Appends \p record to the current shard.
+    //! \param record The game record to append.
+    void Write(const GameRecord& record);
+
+    //! Flushes the written records to the file.
+    void Flush();
+
+    //! Returns the path of the shard.
+    //! \param dirName The directory of shards.
+    //! \param prefix The prefix of the names of shards.
+    //! \param idx The index of the shard.
+    //! \return The path of the shard.
+    static std::string GetShardPath(const std::string& dirName,
+                                    const std::string& prefix,
+                                    std::size_t idx);
+
+ private:
+    //! Creates and opens the next shard that doesn't exist.
+    void OpenNextShard();
+
+    std::string m_dirName;
+    std::string m_prefix;
+    std::size_t m_maxShardSize;
+    Compression m_compression;
+
+    std::mutex m_mutex;
+    std::ofstream m_file;
+    std::size_t m_shardIdx = 0;
+    std::size_t m_shardSize = 0;
+    std::string m_buffer;
+};
+
+//!
+//! \brief RecordReader class.
+//!
+//! This class reads game records from shard files one by one, so a data set
+//! that doesn't fit in memory can be streamed to training. A record that is
+//! truncated or corrupted ends its shard, e.g. the last record of a shard
+//! whose writer was killed.
+//!
+class RecordReader
+{
+ public:
+    //! Constructs record reader with given \p paths.
+    //! \param paths The paths of shards to read in order.
+    explicit RecordReader(std::vector<std::string> paths);
+
+    //! Constructs record reader that reads all shards of \p prefix in
+    //! \p dirName.
+    //! \param dirName The directory of shards.
+    //! \param prefix The prefix of the names of shards.
+    RecordReader(const std::string& dirName, const std::string& prefix);
+
+    //! Reads the next record.
+    //! \param record The game record to store.
+    //! \return true if a record is read, false if no record is left.
+    bool Next(GameRecord& record);
+
+    //! Returns the paths of all shards of \p prefix in \p dirName.
+    //! \param dirName The directory of shards.
+    //! \param prefix The prefix of the names of shards.
+    //! \return The paths of shards.
+    static std::vector<std::string> FindShards(const std::string& dirName,
+                                               const std::string& prefix);
+
+ private:
+    //! Opens the next shard that has a valid header.
+    //! \return true if a shard is opened, false if no shard is left.
+    bool OpenNextShard();
+
+    std::vector<std::string> m_paths;
+    std::size_t m_pathIdx = 0;
+    std::ifstream m_file;
+    std::string m_buffer;
+};
+}  // namespace RosettaTorch::Judges::Binary
+
+#endif  // ROSETTASTONE_TORCH_JUDGES_BINARY_RECORD_FILE_HPP
@@ -0,0 +1,71 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_JUDGES_BINARY_RECORDER_HPP
+#define ROSETTASTONE_TORCH_JUDGES_BINARY_RECORDER_HPP
+
+#include <Judges/Binary/GameRecord.hpp>
+
+#include <Rosetta/Actions/ActionChoices.hpp>
+#include <Rosetta/Enums/ActionEnums.hpp>
+#include <Rosetta/Games/Game.hpp>
+
+namespace RosettaTorch::Judges::Binary
+{
+//!
+//! \brief Recorder class.
+//!
+//! This class records the game data to GameRecord. It has the same interface
+//! as JSON::Recorder, but it takes a compact snapshot of the game only for
+//! every \p snapshotInterval main actions instead of serializing the whole
+//! game to JSON for each of them.
+//!
+class Recorder
+{
+ public:
+    //! Constructs recorder with given \p snapshotInterval.
+    //! \param snapshotInterval The interval of main actions to take
+    //! snapshot. 1 takes snapshot for every main action.
+    explicit Recorder(std::size_t snapshotInterval = 1);
+
+    //! Starts recording by clearing the record.
+    void Start();
+
+    //! Returns the record that contains the game data.
+    //! \return The record that contains the game data.
+    const GameRecord& GetRecord() const;
+
+    //! Records the main action data.
+    //! \param game The game context.
+    //! \param op The main operation type.
+    void RecordMainAction(RosettaStone::Game& game,
+                          RosettaStone::MainOpType op);
+
+    //! Records the randomly selected action.
+    //! \param maxValue The number of available actions.
+    //! \param action The index of available actions selected randomly.
+    void RecordRandomAction(int maxValue, int action);
+
+    //! Records the manually selected action.
+    //! \param actionType The selected action type.
+    //! \param choices The type of action choices.
+    //! \param action The index of available choices selected manually.
+    void RecordManualAction(RosettaStone::ActionType actionType,
+                            RosettaStone::ActionChoices choices, int action);
+
+    //! Records the game end data.
+    //! \param result The result of the game (player1 and player2).
+    void End(
+        std::tuple<RosettaStone::PlayState, RosettaStone::PlayState> result);
+
+ private:
+    GameRecord m_record;
+    std::size_t m_snapshotInterval = 1;
+    std::size_t m_numMainActions = 0;
+};
+}  // namespace RosettaTorch::Judges::Binary
+
+#endif  // ROSETTASTONE_TORCH_JUDGES_BINARY_RECORDER_HPP
@@ -141,7 +141,10 @@ class Reader
 
         for (std::size_t idx = 0; idx < obj.size(); ++idx)
         {
-            if (obj[idx]["type"] == "MAIN_ACTION")
+            // NOTE: The records converted from binary have no field for
+            // the main actions without snapshot
+            if (obj[idx]["type"] == "MAIN_ACTION" &&
+                obj[idx].find("field") != obj[idx].end())
             {
                 const nlohmann::json& game = obj[idx]["field"];
 
@@ -56,11 +56,6 @@ class Recorder
         std::tuple<RosettaStone::PlayState, RosettaStone::PlayState> result);
 
  private:
-    //! Converts the action type to string.
-    //! \param type The action type to convert.
-    //! \return The converted string of the action type.
-    std::string GetActionTypeString(RosettaStone::ActionType type);
-
     //! Converts the choice type to string.
     //! \param choices The choice type to convert.
     //! \return The converted string of the choice type.
@@ -14,15 +14,12 @@
 
 #include <Rosetta/Actions/ActionChoices.hpp>
 #include <Rosetta/Actions/ActionParams.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 #include <Rosetta/Enums/ActionEnums.hpp>
 #include <Rosetta/Games/Game.hpp>
 
-#include <effolkronium/random.hpp>
-
 #include <tuple>
 
-using Random = effolkronium::random_static;
-
 namespace RosettaTorch::Judges
 {
 //!
@@ -221,7 +218,8 @@ class Judger
             if (actionType == ActionType::RANDOM)
             {
                 int exclusiveMax = choices.Size();
-                auto action = Random::get<std::size_t>(0, exclusiveMax - 1);
+                auto action = m_game->GetRandom().Get<std::size_t>(
+                    0, exclusiveMax - 1);
                 m_guide.m_recorder.RecordRandomAction(exclusiveMax, action);
                 return action;
             }
@@ -10,10 +10,19 @@
 #ifndef ROSETTASTONE_TORCH_MCTS_CONFIG_HPP
 #define ROSETTASTONE_TORCH_MCTS_CONFIG_HPP
 
+#include <cstddef>
+#include <memory>
 #include <string>
 
+namespace RosettaTorch::NeuralNet
+{
+class InferenceServer;
+}  // namespace RosettaTorch::NeuralNet
+
 namespace RosettaTorch::MCTS
 {
+class NodeBudget;
+
 //!
 //! \brief Config struct.
 //!
@@ -23,6 +32,20 @@ struct Config
 {
     std::string neuralNetPath;
     bool isNeuralNetRandom;
+
+    //! The server that batches the predictions of all search threads.
+    //! If it is null, each state value policy loads its own network.
+    std::shared_ptr<NeuralNet::InferenceServer> inferenceServer;
+
+    //! The maximum number of nodes of the trees of a runner. When it is
+    //! reached, the search stops adding nodes and plays out from the last
+    //! node, and the least visited subtrees are pruned before the next
+    //! search. It is unlimited if it is 0.
+    std::size_t maxTreeNodes = 0;
+
+    //! The budget that counts the nodes of the trees of the runner against
+    //! maxTreeNodes. If it is null, the trees are unlimited.
+    std::shared_ptr<NodeBudget> nodeBudget;
 };
 }  // namespace RosettaTorch::MCTS
 
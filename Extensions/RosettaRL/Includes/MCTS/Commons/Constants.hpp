@@ -43,6 +43,22 @@ constexpr static int VIRTUAL_LOSS = 3;
 constexpr static bool RECORD_LEADING_NODES =
     std::is_same_v<UpdaterPolicy, TreeUpdate>;
 
+//! The maximum number of leading nodes that a node records. It bounds the
+//! work of a tree update on a board that is reached in many ways.
+constexpr static int MAX_LEADING_NODES = 16;
+
+//! The flag indicates whether to compare the reduced board view of a node
+//! with the board that has the same hash. The boards are keyed by a 64-bit
+//! hash, so it is for debugging only.
+constexpr static bool CHECK_BOARD_HASH_COLLISION = false;
+
+//! The version of the encoding of actions in a tree, that is the choices of
+//! edges and the hashes of boards. Increase it when the order of the choices
+//! of an action, ZobristHash or the values of the cards in it are changed,
+//! so the saved trees are rejected. Version 2 hashes the card IDs with
+//! FNV-1a.
+constexpr static int ACTION_ENCODING_VERSION = 2;
+
 }  // namespace RosettaTorch::MCTS
 
 #endif  // ROSETTASTONE_TORCH_MCTS_CONSTANTS_HPP
\ No newline at end of file
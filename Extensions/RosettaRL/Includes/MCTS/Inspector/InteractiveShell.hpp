@@ -12,6 +12,7 @@
 
 #include <Agents/MCTSRunner.hpp>
 #include <MCTS/Policies/NeuralNetworkStateValue.hpp>
+#include <MCTS/Selection/TreeSnapshot.hpp>
 
 #include <Rosetta/Actions/ActionApplyHelper.hpp>
 #include <Rosetta/Games/Game.hpp>
@@ -75,6 +76,9 @@ class InteractiveShell
                              const ActionApplyHelper& actionInfoGetter,
                              int indent, bool onlyShowBestChoice = true);
 
+    void ShowBestSnapshotNodeInfo(std::ostream& os, std::uint32_t node,
+                                  int indent, bool onlyShowBestChoice = true);
+
     std::string GetChoiceString(const TreeNode* mainNode,
                                 const ActionValidChecker& actionChecker,
                                 const TreeNode* node, int choice,
@@ -84,9 +88,18 @@ class InteractiveShell
 
     void DoRoot(std::istream& is, std::ostream& os);
 
+    void DoSave(std::istream& is, std::ostream& os);
+
+    void DoLoad(std::istream& is, std::ostream& os);
+
     Agents::MCTSRunner* m_controller;
     StartBoardGetter m_startBoardGetter;
     const TreeNode* m_node;
+
+    //! The tree that is loaded from a file. It is inspected in place
+    //! instead of the trees of the controller.
+    std::unique_ptr<TreeSnapshot> m_snapshot;
+    std::uint32_t m_snapshotNode = 0;
     std::unique_ptr<NeuralNetworkStateValue> m_stateValue{};
 };
 }  // namespace RosettaTorch::MCTS
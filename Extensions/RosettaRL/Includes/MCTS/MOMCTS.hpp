@@ -29,8 +29,12 @@ class MOMCTS
     //! \param p1Tree The tree of player 1.
     //! \param p2Tree The tree of player 2.
     //! \param statistics The statistics of MCTS.
+    //! \param config The config for neural network.
+    //! \param p1RedirectNodeMap The board node map of the root of player 1.
+    //! \param p2RedirectNodeMap The board node map of the root of player 2.
     MOMCTS(TreeNode& p1Tree, TreeNode& p2Tree, Statistics<>& statistics,
-           const Config& config);
+           const Config& config, BoardNodeMap* p1RedirectNodeMap = nullptr,
+           BoardNodeMap* p2RedirectNodeMap = nullptr);
 
     //! Deleted copy constructor.
     MOMCTS(const MOMCTS&) = delete;
@@ -13,6 +13,7 @@
 #include <MCTS/Commons/Config.hpp>
 #include <MCTS/Commons/Types.hpp>
 #include <NeuralNet/GameDataBridge.hpp>
+#include <NeuralNet/InferenceServer.hpp>
 #include <NeuralNet/NeuralNetwork.hpp>
 
 #include <Rosetta/Views/Board.hpp>
@@ -43,6 +44,7 @@ class NeuralNetworkStateValue
 
  private:
     NeuralNet::NeuralNetwork m_net;
+    std::shared_ptr<NeuralNet::InferenceServer> m_server;
     NeuralNet::GameDataBridge m_curPlayerViewer;
 };
 }  // namespace RosettaTorch::MCTS
@@ -31,8 +31,12 @@ class SOMCTS
     //! \param tree The tree of player.
     //! \param statistics The statistics of MCTS.
     //! \param config The config for neural network.
+    //! \param redirectNodeMap The board node map to look up the boards after
+    //! the actions of the root node. The map of the root node is used if it is
+    //! nullptr.
     explicit SOMCTS(TreeNode& tree, Statistics<>& statistics,
-                    const Config& config);
+                    const Config& config,
+                    BoardNodeMap* redirectNodeMap = nullptr);
 
     //! Deleted copy constructor.
     SOMCTS(const SOMCTS&) = delete;
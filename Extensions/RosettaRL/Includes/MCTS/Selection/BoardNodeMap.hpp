@@ -10,14 +10,12 @@
 #ifndef ROSETTASTONE_TORCH_MCTS_BOARD_NODE_MAP_HPP
 #define ROSETTASTONE_TORCH_MCTS_BOARD_NODE_MAP_HPP
 
-#include <Rosetta/Commons/SpinLocks.hpp>
+#include <MCTS/Selection/ConcurrentMap.hpp>
+
 #include <Rosetta/Views/Board.hpp>
-#include <Rosetta/Views/ReducedBoardView.hpp>
 
-#include <functional>
+#include <cstdint>
 #include <memory>
-#include <shared_mutex>
-#include <unordered_map>
 
 using namespace RosettaStone;
 
@@ -25,12 +23,13 @@ namespace RosettaTorch::MCTS
 {
 struct TreeNode;
 
-using MapType = std::unordered_map<ReducedBoardView, std::unique_ptr<TreeNode>>;
-
 //!
 //! \brief BoardNodeMap class.
 //!
 //! This class stores several boards that are reduced by hash function.
+//! The boards are keyed by the Zobrist hash of the reduced board view, so
+//! a lookup doesn't create the view. Many search threads can find and
+//! create nodes at the same time without a lock.
 //!
 class BoardNodeMap
 {
@@ -42,34 +41,46 @@ class BoardNodeMap
     TreeNode* GetOrCreateNode(const Board& board,
                               bool* newNodeCreated = nullptr);
 
-    //! Runs \p functor on each element of the map.
+    //! Creates an new node or returns an node if the board that has
+    //! \p boardHash already exists. The board isn't checked, so it is used
+    //! to restore a saved tree.
+    //! \param boardHash The hash of the board.
+    //! \return An node that is newly created or is already existed.
+    TreeNode* GetOrCreateNode(std::uint64_t boardHash);
+
+    //! Returns the node of the board that has \p boardHash.
+    //! \param boardHash The hash of the board.
+    //! \return The node of the board if it exists, nullptr otherwise.
+    TreeNode* Find(std::uint64_t boardHash) const;
+
+    //! Takes the node of the board that has \p boardHash out of the map.
+    //! The item remains with no node, so it must not be called while
+    //! searching.
+    //! \param boardHash The hash of the board.
+    //! \return The node of the board if it exists, nullptr otherwise.
+    std::unique_ptr<TreeNode> Release(std::uint64_t boardHash);
+
+    //! Removes all boards and their nodes. It must not be called while
+    //! searching.
+    void Clear();
+
+    //! Runs \p functor on each element of the map. The node is nullptr if
+    //! it is released.
     //! \param functor A function to run for each element.
     template <typename Functor>
     void ForEach(Functor&& functor) const
     {
-        std::shared_lock<SharedSpinLock> lock(m_mutex);
-
-        if (!m_map)
-        {
-            return;
-        }
-
-        for (const auto& kv : *m_map)
-        {
-            if (!functor(kv.first, kv.second.get()))
-            {
-                return;
-            }
-        }
+        m_map.ForEach([&](std::uint64_t boardHash,
+                          const std::unique_ptr<TreeNode>& node) {
+            return functor(boardHash, node.get());
+        });
     }
 
  private:
-    //! Returns the map that stores several boards.
-    //! \return The map that stores several boards.
-    MapType& GetLockedMap();
+    //! The number of boards in a chunk.
+    static constexpr std::size_t CHUNK_SIZE = 16;
 
-    mutable SharedSpinLock m_mutex;
-    std::unique_ptr<MapType> m_map;
+    ConcurrentMap<std::uint64_t, std::unique_ptr<TreeNode>, CHUNK_SIZE> m_map;
 };
 }  // namespace RosettaTorch::MCTS
 
@@ -0,0 +1,286 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_MCTS_CONCURRENT_MAP_HPP
+#define ROSETTASTONE_TORCH_MCTS_CONCURRENT_MAP_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <optional>
+#include <thread>
+#include <utility>
+
+namespace RosettaTorch::MCTS
+{
+//!
+//! \brief ConcurrentMapBase class.
+//!
+//! This class counts the memory of the chunks of all concurrent maps.
+//!
+class ConcurrentMapBase
+{
+ public:
+    //! Returns the bytes of the chunks that all concurrent maps allocate.
+    //! \return The bytes of the chunks.
+    static std::size_t GetAllocatedBytes()
+    {
+        return s_allocatedBytes.load(std::memory_order_relaxed);
+    }
+
+ protected:
+    inline static std::atomic<std::size_t> s_allocatedBytes{ 0 };
+};
+
+//!
+//! \brief ConcurrentMap class.
+//!
+//! This class is an append-only map that many threads can search and insert
+//! into without a lock. The items are stored in chunks of fixed capacity that
+//! are linked when a chunk is full. A thread inserts an item by claiming the
+//! first empty slot with compare-and-swap, so an item is never stored twice.
+//! Each slot has a tag that contains the hash of the key and the state of the
+//! slot. Readers compare the tag first and wait only for a slot that is being
+//! filled with the same hash. Items are removed only by Clear() when no other
+//! thread uses the map. The fan-out of a tree node is small, so a linear scan
+//! is fast.
+//!
+template <class Key, class Value, std::size_t ChunkSize>
+class ConcurrentMap : public ConcurrentMapBase
+{
+ public:
+    //! Default constructor.
+    ConcurrentMap() = default;
+
+    //! Destructor.
+    ~ConcurrentMap()
+    {
+        Clear();
+    }
+
+    //! Deleted copy constructor.
+    ConcurrentMap(const ConcurrentMap&) = delete;
+
+    //! Deleted move constructor.
+    ConcurrentMap(ConcurrentMap&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    ConcurrentMap& operator=(const ConcurrentMap&) = delete;
+
+    //! Deleted move assignment operator.
+    ConcurrentMap& operator=(ConcurrentMap&&) noexcept = delete;
+
+    //! Returns the value of \p key.
+    //! \param key The key to find.
+    //! \param hash The hash of \p key.
+    //! \return The value of \p key if it exists, nullptr otherwise.
+    Value* Find(const Key& key, std::uint64_t hash) const
+    {
+        for (Chunk* chunk = m_head.load(std::memory_order_acquire);
+             chunk != nullptr;
+             chunk = chunk->next.load(std::memory_order_acquire))
+        {
+            for (auto& slot : chunk->slots)
+            {
+                const std::uint64_t tag =
+                    slot.tag.load(std::memory_order_acquire);
+                if (tag == EMPTY)
+                {
+                    return nullptr;
+                }
+
+                if (IsMatched(slot, tag, key, hash))
+                {
+                    return &slot.value;
+                }
+            }
+        }
+
+        return nullptr;
+    }
+
+    //! Returns the value of \p key or inserts it if it doesn't exist.
+    //! \param key The key to find or insert.
+    //! \param hash The hash of \p key.
+    //! \param createFunctor A function to run on the value that is inserted.
+    //! \return First element is the flag indicates whether to insert the
+    //! value. Second element is the value of \p key.
+    template <class CreateFunctor>
+    std::pair<bool, Value*> GetOrCreate(const Key& key, std::uint64_t hash,
+                                        CreateFunctor&& createFunctor)
+    {
+        std::atomic<Chunk*>* link = &m_head;
+
+        while (true)
+        {
+            Chunk* chunk = GetOrCreateChunk(*link);
+
+            for (auto& slot : chunk->slots)
+            {
+                std::uint64_t tag = slot.tag.load(std::memory_order_acquire);
+
+                if (tag == EMPTY)
+                {
+                    const std::uint64_t reserved = MakeTag(hash, RESERVED);
+                    if (slot.tag.compare_exchange_strong(
+                            tag, reserved, std::memory_order_acq_rel))
+                    {
+                        slot.key.emplace(key);
+                        createFunctor(slot.value);
+                        slot.tag.store(MakeTag(hash, READY),
+                                       std::memory_order_release);
+
+                        return { true, &slot.value };
+                    }
+                }
+
+                // The slot is taken by another thread, maybe with the key
+                if (IsMatched(slot, tag, key, hash))
+                {
+                    return { false, &slot.value };
+                }
+            }
+
+            link = &chunk->next;
+        }
+    }
+
+    //! Removes all items. It must not be called while other threads use the
+    //! map.
+    void Clear()
+    {
+        Chunk* chunk = m_head.exchange(nullptr, std::memory_order_relaxed);
+        while (chunk != nullptr)
+        {
+            Chunk* next = chunk->next.load(std::memory_order_relaxed);
+            delete chunk;
+            s_allocatedBytes.fetch_sub(sizeof(Chunk),
+                                       std::memory_order_relaxed);
+            chunk = next;
+        }
+    }
+
+    //! Runs \p functor on each item of the map.
+    //! \param functor A function to run for each item.
+    template <typename Functor>
+    void ForEach(Functor&& functor) const
+    {
+        for (Chunk* chunk = m_head.load(std::memory_order_acquire);
+             chunk != nullptr;
+             chunk = chunk->next.load(std::memory_order_acquire))
+        {
+            for (auto& slot : chunk->slots)
+            {
+                const std::uint64_t tag =
+                    slot.tag.load(std::memory_order_acquire);
+                if (tag == EMPTY)
+                {
+                    return;
+                }
+
+                // Skips the item that is being inserted
+                if ((tag & STATE_MASK) != READY)
+                {
+                    continue;
+                }
+
+                if (!functor(*slot.key, slot.value))
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    //! Returns the size of a slot that stores an item.
+    //! \return The size of a slot in bytes.
+    static constexpr std::size_t GetSlotSize()
+    {
+        return sizeof(Slot);
+    }
+
+ private:
+    static constexpr std::uint64_t EMPTY = 0;
+    static constexpr std::uint64_t RESERVED = 1;
+    static constexpr std::uint64_t READY = 2;
+    static constexpr std::uint64_t STATE_MASK = 3;
+
+    struct Slot
+    {
+        std::atomic<std::uint64_t> tag{ EMPTY };
+        std::optional<Key> key;
+        mutable Value value{};
+    };
+
+    struct Chunk
+    {
+        std::array<Slot, ChunkSize> slots;
+        std::atomic<Chunk*> next{ nullptr };
+    };
+
+    //! Makes the tag of the slot from \p hash and \p state.
+    //! \param hash The hash of the key.
+    //! \param state The state of the slot.
+    //! \return The tag of the slot.
+    static std::uint64_t MakeTag(std::uint64_t hash, std::uint64_t state)
+    {
+        return (hash << 2) | state;
+    }
+
+    //! Checks \p slot that has \p tag contains \p key. It waits until the
+    //! slot is filled if the hash is equal.
+    //! \param slot The slot to check.
+    //! \param tag The tag of \p slot that is loaded.
+    //! \param key The key to compare.
+    //! \param hash The hash of \p key.
+    //! \return The flag indicates whether the slot contains \p key.
+    static bool IsMatched(const Slot& slot, std::uint64_t tag, const Key& key,
+                          std::uint64_t hash)
+    {
+        if ((tag >> 2) != (MakeTag(hash, EMPTY) >> 2))
+        {
+            return false;
+        }
+
+        while ((tag & STATE_MASK) != READY)
+        {
+            std::this_thread::yield();
+            tag = slot.tag.load(std::memory_order_acquire);
+        }
+
+        return *slot.key == key;
+    }
+
+    //! Returns the chunk that \p link points or links a new chunk to it.
+    //! \param link The link to the chunk.
+    //! \return The chunk that \p link points.
+    static Chunk* GetOrCreateChunk(std::atomic<Chunk*>& link)
+    {
+        Chunk* chunk = link.load(std::memory_order_acquire);
+        if (chunk != nullptr)
+        {
+            return chunk;
+        }
+
+        Chunk* newChunk = new Chunk();
+        if (link.compare_exchange_strong(chunk, newChunk,
+                                         std::memory_order_acq_rel))
+        {
+            s_allocatedBytes.fetch_add(sizeof(Chunk),
+                                       std::memory_order_relaxed);
+            return newChunk;
+        }
+
+        // Another thread linked a chunk first
+        delete newChunk;
+        return chunk;
+    }
+
+    std::atomic<Chunk*> m_head{ nullptr };
+};
+}  // namespace RosettaTorch::MCTS
+
+#endif  // ROSETTASTONE_TORCH_MCTS_CONCURRENT_MAP_HPP
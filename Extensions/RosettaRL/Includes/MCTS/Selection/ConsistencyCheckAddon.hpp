@@ -10,14 +10,16 @@
 #ifndef ROSETTASTONE_TORCH_MCTS_CONSISTENCY_CHECK_ADDON_HPP
 #define ROSETTASTONE_TORCH_MCTS_CONSISTENCY_CHECK_ADDON_HPP
 
-#include <MCTS/Selection/BoardNodeMap.hpp>
-
 #include <Rosetta/Actions/ActionChoices.hpp>
 #include <Rosetta/Commons/SpinLocks.hpp>
 #include <Rosetta/Enums/ActionEnums.hpp>
+#include <Rosetta/Views/ReducedBoardView.hpp>
 
+#include <memory>
 #include <mutex>
 
+using namespace RosettaStone;
+
 namespace RosettaTorch::MCTS
 {
 //!
@@ -47,6 +47,17 @@ class EdgeAddon
     //! \return Total credit of the edge.
     std::int64_t GetTotal() const;
 
+    //! Returns credit of the edge.
+    //! \return Credit of the edge.
+    std::int64_t GetCredit() const;
+
+    //! Sets the statistics of the edge. It is used to restore a saved tree.
+    //! \param chosenTimes Chosen times of the edge.
+    //! \param credit Credit of the edge.
+    //! \param total Total credit of the edge.
+    void Set(std::int64_t chosenTimes, std::int64_t credit,
+             std::int64_t total);
+
  private:
     std::atomic<std::int64_t> m_chosenTimes;
     std::atomic<std::int64_t> m_credit;
@@ -11,12 +11,14 @@
 #define ROSETTASTONE_TORCH_MCTS_LEADING_NODES_HPP
 
 #include <MCTS/Selection/BoardNodeMap.hpp>
+#include <MCTS/Selection/ConcurrentMap.hpp>
 #include <MCTS/Selection/EdgeAddon.hpp>
 
-#include <Rosetta/Commons/SpinLocks.hpp>
 #include <Rosetta/Commons/Utils.hpp>
 
-#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <vector>
 
 namespace RosettaTorch::MCTS
 {
@@ -61,34 +63,60 @@ namespace RosettaTorch::MCTS
 //!
 //! \brief LeadingNodes class.
 //!
-//! This class represents the lead of the tree node.
+//! This class represents the lead of the tree node. Many search threads can
+//! add and iterate the leading nodes at the same time without a lock.
 //!
 class LeadingNodes
 {
  public:
-    //! Adds the leading node to items.
+    //! Adds the leading node to items. It is ignored if the node already has
+    //! about MAX_LEADING_NODES leading nodes.
     //! \param node A pointer pointing to add the leading node.
     //! \param edgeAddon The edge addon of the leading node.
     void AddLeadingNodes(TreeNode* node, EdgeAddon* edgeAddon);
 
+    //! Removes all leading nodes. It is called when the node becomes a root.
+    void Clear();
+
     //! Iterates something for each leading node.
     //! \param functor A function to run for each leading node.
     template <typename Functor>
-    void ForEachLeadingNode(Functor&& functor)
+    void ForEachLeadingNode(Functor&& functor) const
     {
-        std::shared_lock<SharedSpinLock> lock(m_mutex);
-        for (const auto& item : m_items)
-        {
-            if (!functor(item.node, item.edgeAddon))
+        m_items.ForEach([&](const LeadingNodesItem& item, bool) {
+            return functor(item.node, item.edgeAddon);
+        });
+    }
+
+    //! Removes the leading nodes that \p predicate returns true for. It
+    //! must not be called while searching.
+    //! \param predicate A function that takes the leading node and its edge
+    //! addon.
+    template <typename Predicate>
+    void RemoveIf(Predicate&& predicate)
+    {
+        std::vector<LeadingNodesItem> items;
+        m_items.ForEach([&](const LeadingNodesItem& item, bool) {
+            if (!predicate(item.node, item.edgeAddon))
             {
-                break;
+                items.emplace_back(item);
             }
+            return true;
+        });
+
+        Clear();
+        for (const auto& item : items)
+        {
+            AddLeadingNodes(item.node, item.edgeAddon);
         }
     }
 
  private:
-    mutable SharedSpinLock m_mutex;
-    std::vector<LeadingNodesItem> m_items;
+    //! The number of leading nodes in a chunk. Most nodes have only one.
+    static constexpr std::size_t CHUNK_SIZE = 2;
+
+    ConcurrentMap<LeadingNodesItem, bool, CHUNK_SIZE> m_items;
+    std::atomic<int> m_numItems{ 0 };
 };
 }  // namespace RosettaTorch::MCTS
 
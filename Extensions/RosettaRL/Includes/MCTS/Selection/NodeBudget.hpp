@@ -0,0 +1,56 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_MCTS_NODE_BUDGET_HPP
+#define ROSETTASTONE_TORCH_MCTS_NODE_BUDGET_HPP
+
+#include <atomic>
+#include <cstddef>
+
+namespace RosettaTorch::MCTS
+{
+//!
+//! \brief NodeBudget class.
+//!
+//! This class counts the nodes of the trees of a runner against the maximum
+//! number of nodes. The count is set when the trees are pruned between
+//! searches, and the search threads add the nodes that they create. Each
+//! runner has its own budget, so the runners of a process don't take nodes
+//! from each other.
+//!
+class NodeBudget
+{
+ public:
+    //! Constructs node budget with given \p maxNodes.
+    //! \param maxNodes The maximum number of nodes.
+    explicit NodeBudget(std::size_t maxNodes);
+
+    //! Returns the maximum number of nodes.
+    //! \return The maximum number of nodes.
+    std::size_t GetMaxNodes() const;
+
+    //! Returns the number of nodes.
+    //! \return The number of nodes.
+    std::size_t GetNumNodes() const;
+
+    //! Returns the flag indicates whether no node can be created.
+    //! \return The flag indicates whether the budget is used up.
+    bool IsFull() const;
+
+    //! Adds a node that is created by the search.
+    void AddNode();
+
+    //! Sets the number of nodes that the trees have.
+    //! \param numNodes The number of nodes.
+    void SetNumNodes(std::size_t numNodes);
+
+ private:
+    std::size_t m_maxNodes;
+    std::atomic<std::size_t> m_numNodes{ 0 };
+};
+}  // namespace RosettaTorch::MCTS
+
+#endif  // ROSETTASTONE_TORCH_MCTS_NODE_BUDGET_HPP
@@ -10,6 +10,7 @@
 #ifndef ROSETTASTONE_TORCH_MCTS_SELECTION_HPP
 #define ROSETTASTONE_TORCH_MCTS_SELECTION_HPP
 
+#include <MCTS/Commons/Config.hpp>
 #include <MCTS/Commons/Types.hpp>
 #include <MCTS/Policies/Selection/ISelectionPolicy.hpp>
 #include <MCTS/Selection/TraversedNodesInfo.hpp>
@@ -31,7 +32,12 @@ class Selection
  public:
     //! Constructs simulation with the specified policy.
     //! \param tree The root node of the tree.
-    explicit Selection(TreeNode& tree);
+    //! \param config The config of MCTS.
+    //! \param redirectNodeMap The board node map to look up the boards after
+    //! the actions of the root node. The map of the root node is used if it is
+    //! nullptr.
+    Selection(TreeNode& tree, const Config& config,
+              BoardNodeMap* redirectNodeMap = nullptr);
 
     //! Deleted copy constructor.
     Selection(const Selection&) = delete;
@@ -56,7 +62,8 @@ class Selection
     //! \param board The game board.
     void StartAction(const Board& board);
 
-    //! Chooses action according to the policy.
+    //! Chooses action according to the policy. If the path left the tree,
+    //! the action is chosen at random.
     //! \param actionType The type of action.
     //! \param choices The choices of action.
     //! \return The index of chosen action.
@@ -79,6 +86,7 @@ class Selection
 
  private:
     TreeNode& m_root;
+    BoardNodeMap* m_rootRedirectNodeMap = nullptr;
     bool m_boardChanged = false;
     BoardNodeMap* m_redirectNodeMap = nullptr;
     TraversedNodesInfo m_path;
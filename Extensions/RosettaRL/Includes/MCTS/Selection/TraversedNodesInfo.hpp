@@ -11,6 +11,7 @@
 #define ROSETTASTONE_TORCH_MCTS_TRAVERSED_NODES_INFO_HPP
 
 #include <MCTS/Selection/BoardNodeMap.hpp>
+#include <MCTS/Selection/NodeBudget.hpp>
 #include <MCTS/Selection/TraversedNodeInfo.hpp>
 #include <MCTS/Selection/TreeUpdater.hpp>
 
@@ -27,8 +28,10 @@ namespace RosettaTorch::MCTS
 class TraversedNodesInfo
 {
  public:
-    //! Constructs traversed nodes info.
-    TraversedNodesInfo();
+    //! Constructs traversed nodes info with given \p nodeBudget.
+    //! \param nodeBudget The budget of the nodes of the trees. The trees
+    //! are unlimited if it is nullptr.
+    explicit TraversedNodesInfo(NodeBudget* nodeBudget = nullptr);
 
     //! Deleted copy constructor.
     TraversedNodesInfo(const TraversedNodesInfo&) = delete;
@@ -46,7 +49,8 @@ class TraversedNodesInfo
     //! \param node The node to reset current node.
     void Restart(TreeNode* node);
 
-    //! Returns the current node.
+    //! Returns the current node. It is nullptr if the path left the tree
+    //! because no node can be created.
     //! \return The current node.
     TreeNode* GetCurrentNode() const;
 
@@ -58,10 +62,12 @@ class TraversedNodesInfo
     //! \return The flag indicates that the current node has pending choice.
     bool HasCurrentNodeMadeChoice() const;
 
-    //! Constructs new node.
+    //! Constructs new node. The path leaves the tree if the node doesn't exist
+    //! and the tree is full.
     void ConstructNode();
 
-    //! Constructs redirect node.
+    //! Constructs redirect node. The path leaves the tree if the node doesn't
+    //! exist and the tree is full.
     //! \param redirectNodeMap The board node map to get the next node.
     //! \param board The game board.
     //! \param result The result of the game (player1 and player2).
@@ -69,7 +75,8 @@ class TraversedNodesInfo
                                const Board& board,
                                std::tuple<PlayState, PlayState> result);
 
-    //! Jumps current node to next node.
+    //! Jumps current node to next node. The path leaves the tree if the node
+    //! doesn't exist and the tree is full.
     //! \param board The game board.
     void JumpToNode(const Board& board);
 
@@ -86,6 +93,16 @@ class TraversedNodesInfo
     bool HasNewNodeCreated() const;
 
  private:
+    //! Returns the flag indicates whether a node can be created.
+    //! \return The flag indicates whether the tree isn't full.
+    bool CanCreateNode() const;
+
+    //! Counts a node that is created against the budget.
+    void AddCreatedNode();
+
+    //! Leaves the tree, so the iteration switches to simulation.
+    void LeaveTree();
+
     //! Adds path nodes and sets the current node to next node.
     //! \param node A pointer pointing to parent node.
     //! \param choice The index of the node.
@@ -115,10 +132,12 @@ class TraversedNodesInfo
                          TreeNode* childNode)
         -> std::enable_if_t<RECORD_LEADING_NODES, Dummy>;
 
+    NodeBudget* m_nodeBudget;
     std::vector<TraversedNodeInfo> m_path;
     bool m_newNodeCreated;
     TreeNode* m_currentNode;
     int m_pendingChoice;
+    TreeUpdater m_updater;
 };
 }  // namespace RosettaTorch::MCTS
 
@@ -10,15 +10,13 @@
 #ifndef ROSETTASTONE_TORCH_MCTS_TREE_NODE_HPP
 #define ROSETTASTONE_TORCH_MCTS_TREE_NODE_HPP
 
+#include <MCTS/Selection/ConcurrentMap.hpp>
 #include <MCTS/Selection/EdgeAddon.hpp>
 #include <MCTS/Selection/TreeNodeAddon.hpp>
 
-#include <Rosetta/Commons/SpinLocks.hpp>
-
-#include <functional>
+#include <atomic>
 #include <memory>
 #include <tuple>
-#include <unordered_map>
 
 namespace RosettaTorch::MCTS
 {
@@ -27,9 +25,8 @@ struct TreeNode;
 //!
 //! \brief ChildNodeMap class.
 //!
-//! This class stores several child nodes and has shared spin lock to run in
-//! multi-thread. Note that this class is not thread safe. Do not expose it to
-//! outside!
+//! This class stores several child nodes. Many search threads can find and
+//! create child nodes at the same time without a lock.
 //!
 class ChildNodeMap
 {
@@ -40,6 +37,8 @@ class ChildNodeMap
     const EdgeAddon* GetEdgeAddon(int choice) const;
 
     //! Creates an new child node or returns a child node if it exists.
+    //! If the edge of \p choice is a redirect edge, the node is stored apart
+    //! from the edge.
     //! \param choice The index of child node.
     //! \param node A node of child node.
     //! \return First element is the flag indicates whether to create new node.
@@ -66,20 +65,18 @@ class ChildNodeMap
     //! an child node. If child node doesn't exist, both value are nullptr.
     std::pair<const EdgeAddon*, TreeNode*> Get(int choice) const;
 
+    //! Removes all child nodes and their edges. It must not be called while
+    //! searching.
+    void Clear();
+
     //! Runs \p functor on each child node (const).
     //! \param functor A function to run for each child node.
     template <typename Functor>
     void ForEach(Functor&& functor) const
     {
-        std::shared_lock<SharedSpinLock> lock(m_mapMutex);
-
-        for (const auto& kv : m_map)
-        {
-            if (!functor(kv.first, &kv.second.edgeAddon, kv.second.node.get()))
-            {
-                return;
-            }
-        }
+        m_map.ForEach([&](int choice, const ChildType& child) {
+            return functor(choice, &child.edgeAddon, child.node.get());
+        });
     }
 
     //! Runs \p functor on each child node (non-const).
@@ -87,15 +84,21 @@ class ChildNodeMap
     template <typename Functor>
     void ForEach(Functor&& functor)
     {
-        std::shared_lock<SharedSpinLock> lock(m_mapMutex);
-
-        for (auto& kv : m_map)
-        {
-            if (!functor(kv.first, &kv.second.edgeAddon, kv.second.node.get()))
-            {
-                return;
-            }
-        }
+        m_map.ForEach([&](int choice, ChildType& child) {
+            return functor(choice, &child.edgeAddon, child.node.get());
+        });
+    }
+
+    //! Runs \p functor on each node that is kept apart from the redirect edge
+    //! of its choice.
+    //! \param functor A function to run for each detached node.
+    template <typename Functor>
+    void ForEachDetachedNode(Functor&& functor) const
+    {
+        m_detachedNodes.ForEach(
+            [&](int choice, const std::unique_ptr<TreeNode>& node) {
+                return functor(choice, node.get());
+            });
     }
 
  private:
@@ -121,20 +124,67 @@ class ChildNodeMap
         std::unique_ptr<TreeNode> node;
     };
 
-    mutable SharedSpinLock m_mapMutex;
-    std::unordered_map<int, ChildType> m_map;
+    //! The number of child nodes in a chunk. UCBPolicy considers at most 16
+    //! choices, so most nodes need only one or two chunks.
+    static constexpr std::size_t CHUNK_SIZE = 8;
+
+    //! The number of detached nodes in a chunk. They are rare.
+    static constexpr std::size_t DETACHED_CHUNK_SIZE = 2;
+
+    ConcurrentMap<int, ChildType, CHUNK_SIZE> m_map;
+
+    // NOTE: The boards of a node can differ in a state that the board view
+    // doesn't have, so a choice that finishes the action for a board can need
+    // more choices for another board. The edge of it is a redirect edge, and
+    // the node of the next choices is kept here.
+    ConcurrentMap<int, std::unique_ptr<TreeNode>, DETACHED_CHUNK_SIZE>
+        m_detachedNodes;
+
+    static_assert(decltype(m_map)::GetSlotSize() <= 64,
+                  "An edge must fit in a cache line");
 };
 
 //!
 //! \brief TreeNode struct.
 //!
 //! This struct contains children and addon that checks consistency,
-//! records leading node and so on.
+//! records leading node and so on. The nodes of all trees are counted, so
+//! the search can be bounded by the number of nodes.
 //!
 struct TreeNode
 {
+    //! Default constructor.
+    TreeNode();
+
+    //! Destructor.
+    ~TreeNode();
+
+    //! Deleted copy constructor.
+    TreeNode(const TreeNode&) = delete;
+
+    //! Deleted move constructor.
+    TreeNode(TreeNode&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    TreeNode& operator=(const TreeNode&) = delete;
+
+    //! Deleted move assignment operator.
+    TreeNode& operator=(TreeNode&&) noexcept = delete;
+
+    //! Returns the number of nodes of all trees.
+    //! \return The number of nodes of all trees.
+    static std::size_t GetNumNodes();
+
+    //! Returns the bytes of the nodes of all trees, including the chunks of
+    //! their maps.
+    //! \return The bytes of the nodes of all trees.
+    static std::size_t GetNumBytes();
+
     ChildNodeMap children;
     TreeNodeAddon addon;
+
+ private:
+    inline static std::atomic<std::size_t> s_numNodes{ 0 };
 };
 }  // namespace RosettaTorch::MCTS
 
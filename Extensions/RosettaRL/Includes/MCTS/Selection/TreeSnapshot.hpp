@@ -0,0 +1,164 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_MCTS_TREE_SNAPSHOT_HPP
+#define ROSETTASTONE_TORCH_MCTS_TREE_SNAPSHOT_HPP
+
+#include <MCTS/Selection/TreeNode.hpp>
+
+#include <Rosetta/Commons/MappedFile.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace RosettaTorch::MCTS
+{
+//!
+//! \brief TreeSnapshot class.
+//!
+//! This class saves a tree to a binary file and reads it back. The file has
+//! a header and the tables of fixed-size nodes, edges, boards and leading
+//! nodes, which refer to each other by index. The nodes are in preorder, so
+//! a node comes after the node that owns it. The file is memory-mapped when
+//! it is loaded, so a large tree can be browsed in place with GetRootIndex()
+//! and ForEachEdge() without creating its nodes. Restore() creates the nodes
+//! from the mapped tables when the tree is searched again. The header
+//! contains the version of the format and ACTION_ENCODING_VERSION, so a tree
+//! that is saved with other choices or board hashes is rejected.
+//!
+class TreeSnapshot
+{
+ public:
+    //! The version of the format. Increase it when the format is changed.
+    static constexpr std::uint32_t VERSION = 1;
+
+    //! The index that refers to no node.
+    static constexpr std::uint32_t NO_NODE = 0xFFFFFFFF;
+
+    //! A node. Its edges, boards and leading nodes are the ranges of their
+    //! tables.
+    struct Node
+    {
+        std::uint32_t firstEdge;
+        std::uint32_t numEdges;
+        std::uint32_t firstBoard;
+        std::uint32_t numBoards;
+        std::uint32_t firstLeadingNode;
+        std::uint32_t numLeadingNodes;
+    };
+
+    //! An edge of a choice. The child of a redirect edge is NO_NODE, and the
+    //! node of the choice that is kept apart from it is the detached node.
+    struct Edge
+    {
+        std::int64_t chosenTimes;
+        std::int64_t credit;
+        std::int64_t total;
+        std::int32_t choice;
+        std::uint32_t child;
+        std::uint32_t detachedChild;
+        std::uint32_t reserved;
+    };
+
+    //! A board of the board node map of a node.
+    struct Board
+    {
+        std::uint64_t hash;
+        std::uint32_t node;
+        std::uint32_t reserved;
+    };
+
+    //! A leading node of a node and the index of its edge.
+    struct LeadingNode
+    {
+        std::uint32_t node;
+        std::uint32_t edge;
+    };
+
+    //! Saves \p tree to the file of \p path. It must not be called while
+    //! searching.
+    //! \param path The path of the file.
+    //! \param tree The tree to save.
+    //! \param root The node that a search starts from, or nullptr if it is
+    //! the root of \p tree.
+    //! \param redirectNodeMap The board node map that the boards after the
+    //! actions of \p root are looked up in, or nullptr if it is the map of
+    //! \p root.
+    //! \param boardHash The hash of the board of \p root, or 0 if unknown.
+    static void Save(const std::string& path, const TreeNode& tree,
+                     const TreeNode* root = nullptr,
+                     const BoardNodeMap* redirectNodeMap = nullptr,
+                     std::uint64_t boardHash = 0);
+
+    //! Constructs tree snapshot by mapping the file of \p path. It throws
+    //! an exception if the file is invalid or out of date.
+    //! \param path The path of the file.
+    explicit TreeSnapshot(const std::string& path);
+
+    //! Creates the nodes of the saved tree.
+    //! \param root The node to store the node that a search starts from.
+    //! \param redirectNodeMap The board node map to store the map that the
+    //! boards after the actions of the root are looked up in.
+    //! \return The root of the tree.
+    std::unique_ptr<TreeNode> Restore(
+        TreeNode** root = nullptr,
+        BoardNodeMap** redirectNodeMap = nullptr) const;
+
+    //! Returns the number of nodes.
+    //! \return The number of nodes.
+    std::uint32_t GetNumNodes() const;
+
+    //! Returns the hash of the board of the node that a search starts from.
+    //! \return The hash of the board, or 0 if unknown.
+    std::uint64_t GetBoardHash() const;
+
+    //! Returns the index of the node that a search starts from.
+    //! \return The index of the node.
+    std::uint32_t GetRootIndex() const;
+
+    //! Calls \p functor with each edge of the node of \p node in the mapped
+    //! file. It stops when \p functor returns false.
+    //! \param node The index of the node, less than GetNumNodes().
+    //! \param functor The function to call with the edge.
+    template <typename Functor>
+    void ForEachEdge(std::uint32_t node, Functor&& functor) const
+    {
+        const Node& record = m_nodes[node];
+        for (std::uint32_t i = record.firstEdge;
+             i < record.firstEdge + record.numEdges; ++i)
+        {
+            if (!functor(m_edges[i]))
+            {
+                return;
+            }
+        }
+    }
+
+ private:
+    //! Checks that the tables are in the file and that each node except
+    //! the root is owned by exactly one node that comes before it.
+    //! \return The flag indicates whether the tables are valid.
+    bool Validate() const;
+
+    RosettaStone::MappedFile m_file;
+
+    std::uint32_t m_numNodes = 0;
+    std::uint32_t m_numEdges = 0;
+    std::uint32_t m_numBoards = 0;
+    std::uint32_t m_numLeadingNodes = 0;
+    std::uint32_t m_rootNode = 0;
+    std::uint32_t m_redirectNode = NO_NODE;
+    std::uint64_t m_boardHash = 0;
+
+    const Node* m_nodes = nullptr;
+    const Edge* m_edges = nullptr;
+    const Board* m_boards = nullptr;
+    const LeadingNode* m_leadingNodes = nullptr;
+};
+}  // namespace RosettaTorch::MCTS
+
+#endif  // ROSETTASTONE_TORCH_MCTS_TREE_SNAPSHOT_HPP
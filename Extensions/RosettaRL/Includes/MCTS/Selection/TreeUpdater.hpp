@@ -13,14 +13,21 @@
 #include <MCTS/Commons/Constants.hpp>
 #include <MCTS/Selection/TraversedNodeInfo.hpp>
 
-#include <queue>
+#include <algorithm>
+#include <cstdint>
+#include <vector>
 
 namespace RosettaTorch::MCTS
 {
 //!
 //! \brief TreeUpdater class.
 //!
-//! This class updates node info by adding credit.
+//! This class updates node info by adding credit. For tree update, the
+//! boards that are reached in many ways make the tree a DAG, so the credit is
+//! propagated to all leading nodes. The nodes and the edges that an update
+//! visits are recorded, so each of them is visited once per update even if
+//! it is reached by many paths. The buffers are kept between updates, so an
+//! updater should be reused by a thread instead of created for each update.
 //!
 class TreeUpdater
 {
@@ -98,23 +105,33 @@ class TreeUpdater
                                float credit)
         -> std::enable_if_t<std::is_same_v<UpdaterPolicy, TreeUpdate>, RetType>
     {
-        m_bfs.push({ startNode, startEdge });
+        m_bfs.clear();
+        m_visitedNodes.Clear();
+        m_visitedEdges.Clear();
 
-        while (!m_bfs.empty())
+        m_bfs.push_back({ startNode, startEdge });
+
+        // NOTE: The items are kept until the end of the update, so the
+        // buffer is reused by the next update without allocation
+        for (std::size_t idx = 0; idx < m_bfs.size(); ++idx)
         {
-            auto node = m_bfs.front().node;
-            auto* edgeAddon = m_bfs.front().edgeAddon;
-            m_bfs.pop();
+            auto node = m_bfs[idx].node;
+            auto* edgeAddon = m_bfs[idx].edgeAddon;
 
-            if (edgeAddon)
+            if (edgeAddon && m_visitedEdges.Insert(edgeAddon))
             {
                 edgeAddon->AddCredit(credit);
             }
 
-            // Use BFS to reduce the lock time
+            // The leading nodes of a node are pushed only once per update
+            if (!m_visitedNodes.Insert(node))
+            {
+                continue;
+            }
+
             node->addon.leadingNodes.ForEachLeadingNode(
                 [&](TreeNode* leadingNode, EdgeAddon* leadingEdge) {
-                    m_bfs.push({ leadingNode, leadingEdge });
+                    m_bfs.push_back({ leadingNode, leadingEdge });
                     return true;
                 });
         }
@@ -128,7 +145,95 @@ class TreeUpdater
         EdgeAddon* edgeAddon;
     };
 
-    std::queue<Item> m_bfs;
+    //!
+    //! \brief VisitedSet class.
+    //!
+    //! This class is a set of pointers with open addressing. The filled slots
+    //! are recorded, so clearing it resets only them and keeps the table. It
+    //! doesn't allocate once it is large enough, and clearing it costs the
+    //! size of the last update instead of the largest table.
+    //!
+    class VisitedSet
+    {
+     public:
+        //! Removes all pointers.
+        void Clear()
+        {
+            for (const std::size_t idx : m_filled)
+            {
+                m_table[idx] = nullptr;
+            }
+
+            m_filled.clear();
+        }
+
+        //! Inserts \p ptr to the set.
+        //! \param ptr The pointer to insert.
+        //! \return The flag indicates whether \p ptr wasn't in the set.
+        bool Insert(const void* ptr)
+        {
+            // Keep the table at most half full
+            if ((m_filled.size() + 1) * 2 > m_table.size())
+            {
+                Grow();
+            }
+
+            const std::size_t mask = m_table.size() - 1;
+            for (std::size_t idx = Hash(ptr) & mask;; idx = (idx + 1) & mask)
+            {
+                if (m_table[idx] == ptr)
+                {
+                    return false;
+                }
+
+                if (m_table[idx] == nullptr)
+                {
+                    m_table[idx] = ptr;
+                    m_filled.push_back(idx);
+                    return true;
+                }
+            }
+        }
+
+     private:
+        //! Doubles the size of the table and inserts the pointers again.
+        void Grow()
+        {
+            std::vector<const void*> table(
+                std::max<std::size_t>(MIN_TABLE_SIZE, m_table.size() * 2),
+                nullptr);
+            table.swap(m_table);
+
+            std::vector<std::size_t> filled;
+            filled.swap(m_filled);
+            m_filled.reserve(m_table.size() / 2);
+
+            for (const std::size_t idx : filled)
+            {
+                Insert(table[idx]);
+            }
+        }
+
+        //! Returns the hash of \p ptr from the bits above the alignment.
+        //! \param ptr The pointer to hash.
+        //! \return The hash of \p ptr.
+        static std::size_t Hash(const void* ptr)
+        {
+            const auto value = reinterpret_cast<std::uintptr_t>(ptr);
+            return static_cast<std::size_t>(
+                (static_cast<std::uint64_t>(value) * 0x9E3779B97F4A7C15ULL) >>
+                32);
+        }
+
+        static constexpr std::size_t MIN_TABLE_SIZE = 64;
+
+        std::vector<const void*> m_table;
+        std::vector<std::size_t> m_filled;
+    };
+
+    std::vector<Item> m_bfs;
+    VisitedSet m_visitedNodes;
+    VisitedSet m_visitedEdges;
 };
 }  // namespace RosettaTorch::MCTS
 
@@ -11,6 +11,7 @@
 #define ROSETTASTONE_TORCH_MCTS_STATISTICS_HPP
 
 #include <MCTS/Commons/Constants.hpp>
+#include <MCTS/Selection/TreeNode.hpp>
 #include <MCTS/Statistics/Recorder.hpp>
 
 #include <sstream>
@@ -95,6 +96,20 @@ class Statistics<true>
         m_simulation.ReportSuccess();
     }
 
+    //! Returns the number of nodes of all trees.
+    //! \return The number of nodes of all trees.
+    std::size_t GetNumTreeNodes() const
+    {
+        return TreeNode::GetNumNodes();
+    }
+
+    //! Returns the bytes of the nodes of all trees.
+    //! \return The bytes of the nodes of all trees.
+    std::size_t GetTreeBytes() const
+    {
+        return TreeNode::GetNumBytes();
+    }
+
     //! Returns debug message related to statistics data.
     std::string GetDebugMessage() const
     {
@@ -112,6 +127,9 @@ class Statistics<true>
         PrintRate(ss, m_iter);
         ss << std::endl;
 
+        ss << "Tree nodes: " << GetNumTreeNodes() << " ("
+           << GetTreeBytes() / (1024 * 1024) << " MB)" << std::endl;
+
         return ss.str();
     }
 
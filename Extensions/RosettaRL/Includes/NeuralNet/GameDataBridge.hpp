@@ -38,6 +38,12 @@ class GameDataBridge : public IInputGetter
     double GetField(FieldSide fieldSide, FieldType fieldType,
                     int arg = 0) const override;
 
+    //! Writes all values using RosettaStone::FeatureEncoder.
+    //! \param data The buffer that has room for FeatureEncoder::NUM_FEATURES
+    //! floats.
+    //! \return Always true.
+    bool Encode(float* data) const override;
+
     //! Returns the value of the side field.
     //! Note that boolean value is 1 for true, 0 for false.
     //! \param fieldType The type of the field.
@@ -47,9 +53,13 @@ class GameDataBridge : public IInputGetter
                         const RosettaStone::Player* player) const;
 
  private:
+    //! Finds the playable cards and hero power if they aren't found yet.
+    void PreparePlayables() const;
+
     const RosettaStone::Game* m_game = nullptr;
-    std::vector<RosettaStone::Entity*> m_playableCards;
-    bool m_canUseHeroPower = false;
+    mutable std::vector<RosettaStone::Entity*> m_playableCards;
+    mutable bool m_canUseHeroPower = false;
+    mutable bool m_isPlayablesReady = false;
 };
 }  // namespace RosettaTorch::NeuralNet
 
@@ -33,6 +33,17 @@ class IInputGetter
     //! \return The value of the field.
     virtual double GetField(FieldSide fieldSide, FieldType fieldType,
                             int arg = 0) const = 0;
+
+    //! Writes all values in the layout of RosettaStone::FeatureEncoder at
+    //! once. The getters that can't do it return false and the values are
+    //! read by GetField() instead.
+    //! \param data The buffer that has room for FeatureEncoder::NUM_FEATURES
+    //! floats.
+    //! \return The flag indicates whether the values are written.
+    virtual bool Encode([[maybe_unused]] float* data) const
+    {
+        return false;
+    }
 };
 }  // namespace RosettaTorch::NeuralNet
 
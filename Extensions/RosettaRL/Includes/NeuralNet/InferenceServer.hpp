@@ -0,0 +1,99 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_NEURAL_NET_INFERENCE_SERVER_HPP
+#define ROSETTASTONE_TORCH_NEURAL_NET_INFERENCE_SERVER_HPP
+
+#include <NeuralNet/NeuralNetwork.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RosettaTorch::NeuralNet
+{
+//!
+//! \brief InferenceServer class.
+//!
+//! This class collects the states that search threads want to evaluate and
+//! predicts them together in one forward pass. A batch is predicted as soon
+//! as it has the maximum number of states or the first state of it waited
+//! for the maximum wait time. The caller blocks on the returned future, so
+//! the virtual loss of its path steers other threads away in the meantime.
+//!
+class InferenceServer
+{
+ public:
+    //! Constructs inference server with given \p net, \p maxBatchSize
+    //! and \p maxWait. It starts the thread that runs the forward passes.
+    //! \param net The neural network to predict with.
+    //! \param maxBatchSize The maximum number of states in a batch.
+    //! \param maxWait The maximum time that a state waits for a batch.
+    InferenceServer(NeuralNetwork&& net, std::size_t maxBatchSize,
+                    std::chrono::microseconds maxWait);
+
+    //! Destructor. It predicts the states that are still waiting and stops
+    //! the thread.
+    ~InferenceServer();
+
+    //! Deleted copy constructor.
+    InferenceServer(const InferenceServer&) = delete;
+
+    //! Deleted move constructor.
+    InferenceServer(InferenceServer&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    InferenceServer& operator=(const InferenceServer&) = delete;
+
+    //! Deleted move assignment operator.
+    InferenceServer& operator=(InferenceServer&&) noexcept = delete;
+
+    //! Requests the prediction of \p input. The input getter must stay valid
+    //! until the returned future is ready.
+    //! \param input The input getter to convert data type to framework's.
+    //! \return The future of the result of predict.
+    std::future<double> Predict(const IInputGetter* input);
+
+    //! Returns the number of forward passes that are run.
+    //! \return The number of forward passes that are run.
+    std::size_t GetNumBatches() const;
+
+    //! Returns the number of states that are predicted.
+    //! \return The number of states that are predicted.
+    std::size_t GetNumPredictions() const;
+
+ private:
+    //! Runs the loop that collects and predicts batches.
+    void Run();
+
+    struct Request
+    {
+        const IInputGetter* input;
+        std::promise<double> result;
+    };
+
+    NeuralNetwork m_net;
+    std::size_t m_maxBatchSize;
+    std::chrono::microseconds m_maxWait;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<Request> m_requests;
+    std::chrono::steady_clock::time_point m_firstRequestTime;
+    bool m_stopFlag = false;
+
+    std::atomic<std::size_t> m_numBatches = 0;
+    std::atomic<std::size_t> m_numPredictions = 0;
+
+    std::thread m_thread;
+};
+}  // namespace RosettaTorch::NeuralNet
+
+#endif  // ROSETTASTONE_TORCH_NEURAL_NET_INFERENCE_SERVER_HPP
@@ -12,8 +12,10 @@
 
 #include <NeuralNet/NeuralNetworkInput.hpp>
 #include <NeuralNet/NeuralNetworkOutput.hpp>
+#include <NeuralNet/TrainingDataLoader.hpp>
 
 #include <string>
+#include <vector>
 
 namespace RosettaTorch::NeuralNet
 {
@@ -75,6 +77,10 @@ class NeuralNetwork
                const NeuralNetworkOutput& output, std::size_t batchSize,
                std::size_t epoch) const;
 
+    //! Trains neural network model with all batches of \p loader.
+    //! \param loader The loader that streams the batches.
+    void Train(TrainingDataLoader& loader) const;
+
     //! Verifies neural network model.
     //! \param input The input layer of neural network model.
     //! \param output The output layer of neural network model.
@@ -83,10 +89,21 @@ class NeuralNetwork
         const NeuralNetworkInput& input,
         const NeuralNetworkOutput& output) const;
 
+    //! Verifies neural network model with all batches of \p loader.
+    //! \param loader The loader that streams the batches.
+    //! \return The value of correct and total.
+    std::pair<uint64_t, uint64_t> Verify(TrainingDataLoader& loader) const;
+
     //! Predicts neural network model.
     //! \param input The input getter to convert data type to framework's.
     double Predict(IInputGetter* input) const;
 
+    //! Predicts neural network model for several states in one forward pass.
+    //! \param inputs The input getters to convert data type to framework's.
+    //! \param results The container to store the results of predict.
+    void Predict(const std::vector<const IInputGetter*>& inputs,
+                 std::vector<double>& results) const;
+
  private:
     NeuralNetworkImpl* m_impl = nullptr;
 };
@@ -0,0 +1,200 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_TORCH_NEURAL_NET_TRAINING_DATA_LOADER_HPP
+#define ROSETTASTONE_TORCH_NEURAL_NET_TRAINING_DATA_LOADER_HPP
+
+#include <Judges/Binary/GameRecord.hpp>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace RosettaTorch::NeuralNet
+{
+//! The part of the data set that a loader reads.
+enum class DataSplit
+{
+    TRAIN,
+    VALIDATION
+};
+
+//!
+//! \brief TrainingDataLoaderConfig struct.
+//!
+//! This struct holds all configuration values of TrainingDataLoader.
+//!
+struct TrainingDataLoaderConfig
+{
+    //! The number of states in a batch.
+    std::size_t batchSize = 32;
+
+    //! The number of passes over the shards.
+    std::size_t numEpochs = 1;
+
+    //! The number of states that are shuffled together.
+    std::size_t shuffleBufferSize = 1 << 16;
+
+    //! The number of threads that decode the records.
+    std::size_t numWorkers = 2;
+
+    //! The number of batches that are assembled ahead of the consumer.
+    std::size_t numPrefetchBatches = 2;
+
+    //! The rate of the games that belong to DataSplit::VALIDATION.
+    double validationRate = 0.0;
+
+    //! The seed of the split. The loaders that have the same seed agree on
+    //! the split of each game.
+    std::uint64_t splitSeed = 0;
+
+    //! The seed of the shuffle.
+    std::uint64_t seed = 0;
+};
+
+//!
+//! \brief TrainingBatch struct.
+//!
+//! This struct is a batch of states that TrainingDataLoader assembled.
+//! The features are a row-major [size, FeatureEncoder::NUM_FEATURES] buffer
+//! and the labels are a [size] buffer, so both can be viewed as tensors
+//! without copying.
+//!
+struct TrainingBatch
+{
+    std::size_t size = 0;
+    const float* features = nullptr;
+    const float* labels = nullptr;
+};
+
+//!
+//! \brief TrainingDataLoader class.
+//!
+//! This class streams the states of game records from shards to batches,
+//! so a data set that doesn't fit in memory can be trained. A thread reads
+//! the records in order, the workers decode them to features, and a thread
+//! picks the states of a bounded shuffle buffer at random and assembles the
+//! batches in aligned memory. The batches are prefetched while the consumer
+//! trains the current one.
+//!
+class TrainingDataLoader
+{
+ public:
+    //! The alignment of the memory of batches in bytes.
+    static constexpr std::size_t ALIGNMENT = 64;
+
+    //! Constructs training data loader with given \p paths, \p config and
+    //! \p split, and starts reading.
+    //! \param paths The paths of shards to read.
+    //! \param config The configuration of the loader.
+    //! \param split The part of the data set to read.
+    TrainingDataLoader(std::vector<std::string> paths,
+                       const TrainingDataLoaderConfig& config,
+                       DataSplit split = DataSplit::TRAIN);
+
+    //! Destructor. It stops reading and joins the threads.
+    ~TrainingDataLoader();
+
+    //! Deleted copy constructor.
+    TrainingDataLoader(const TrainingDataLoader&) = delete;
+
+    //! Deleted move constructor.
+    TrainingDataLoader(TrainingDataLoader&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    TrainingDataLoader& operator=(const TrainingDataLoader&) = delete;
+
+    //! Deleted move assignment operator.
+    TrainingDataLoader& operator=(TrainingDataLoader&&) noexcept = delete;
+
+    //! Returns the next batch. The memory of the previous batch is reused,
+    //! so the batch is valid until the next call. The last batch can have
+    //! fewer states than the batch size.
+    //! \param batch The batch to store.
+    //! \return true if a batch is returned, false if no state is left.
+    bool Next(TrainingBatch& batch);
+
+    //! Returns the configuration of the loader.
+    //! \return The configuration of the loader.
+    const TrainingDataLoaderConfig& GetConfig() const;
+
+    //! Returns the number of records that are skipped because their states
+    //! can't be encoded.
+    //! \return The number of skipped records.
+    std::size_t GetNumSkippedRecords();
+
+ private:
+    //! Deleter of the memory that is allocated with ALIGNMENT.
+    struct AlignedDeleter
+    {
+        void operator()(float* ptr) const;
+    };
+
+    using AlignedBuffer = std::unique_ptr<float[], AlignedDeleter>;
+
+    //! The memory of a batch.
+    struct BatchBuffer
+    {
+        AlignedBuffer features;
+        AlignedBuffer labels;
+        std::size_t size = 0;
+    };
+
+    //! Allocates the memory of \p count floats aligned to ALIGNMENT.
+    //! \param count The number of floats.
+    //! \return The allocated memory.
+    static AlignedBuffer AllocateAligned(std::size_t count);
+
+    //! Reads the records of the split and queues them to the workers.
+    void ReadRecords();
+
+    //! Decodes the queued records and adds the states to the shuffle buffer.
+    void DecodeRecords();
+
+    //! Assembles the batches from the shuffle buffer.
+    void AssembleBatches();
+
+    //! Stores the exception of the current thread and stops the loader.
+    void Fail();
+
+    std::vector<std::string> m_paths;
+    TrainingDataLoaderConfig m_config;
+    DataSplit m_split;
+
+    std::mutex m_mutex;
+    std::condition_variable m_recordCV;
+    std::condition_variable m_shuffleCV;
+    std::condition_variable m_batchCV;
+
+    std::deque<Judges::Binary::GameRecord> m_records;
+    bool m_isReadDone = false;
+
+    std::vector<float> m_shuffleFeatures;
+    std::vector<float> m_shuffleLabels;
+    std::size_t m_numShuffleStates = 0;
+    std::size_t m_numActiveWorkers = 0;
+    std::size_t m_numSkippedRecords = 0;
+
+    std::vector<BatchBuffer> m_batches;
+    std::vector<BatchBuffer*> m_freeBatches;
+    std::deque<BatchBuffer*> m_readyBatches;
+    BatchBuffer* m_currentBatch = nullptr;
+    bool m_isAssembleDone = false;
+
+    bool m_isStopped = false;
+    std::exception_ptr m_exception;
+
+    std::vector<std::thread> m_threads;
+};
+}  // namespace RosettaTorch::NeuralNet
+
+#endif  // ROSETTASTONE_TORCH_NEURAL_NET_TRAINING_DATA_LOADER_HPP
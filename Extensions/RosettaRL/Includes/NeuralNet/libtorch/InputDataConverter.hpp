@@ -12,8 +12,12 @@
 
 #include <NeuralNet/IInputGetter.hpp>
 
+#include <Rosetta/Views/FeatureEncoder.hpp>
+
 #include <torch/torch.h>
 
+#include <vector>
+
 namespace RosettaTorch::NeuralNet
 {
 //!
@@ -30,12 +34,22 @@ class InputDataConverter
     //! \param data The tensor data to store using conversion.
     void Convert(const IInputGetter* getter, torch::Tensor& hero, torch::Tensor& minion, torch::Tensor& standalone);
 
+    //! Converts game data of several states to torch::Tensor that has a row
+    //! per state.
+    //! \param getters The input getters to get the value of the field.
+    //! \param hero The tensor data of heroes to store using conversion.
+    //! \param minion The tensor data of minions to store using conversion.
+    //! \param standalone The tensor data of the rest to store using
+    //! conversion.
+    void Convert(const std::vector<const IInputGetter*>& getters,
+                 torch::Tensor& hero, torch::Tensor& minion,
+                 torch::Tensor& standalone);
+
  private:
-    //! Returns the tensor data using conversion.
+    //! Writes the input data of \p getter in the layout of FeatureEncoder.
     //! \param getter The input getter to get the value of the field.
-    //! \param data The tensor data to store using conversion.
-    void GetInputData(const IInputGetter* getter, torch::Tensor& hero,
-                      torch::Tensor& minion, torch::Tensor& standalone) const;
+    //! \param data The buffer to write the input data.
+    void GetInputData(const IInputGetter* getter, float* data) const;
 
     //! Adds the hero data to the container.
     //! \param side The side of the field.
@@ -10,6 +10,7 @@
 #ifndef ROSETTASTONE_TORCH_NEURAL_NET_NEURAL_NETWORK_IMPL_HPP
 #define ROSETTASTONE_TORCH_NEURAL_NET_NEURAL_NETWORK_IMPL_HPP
 
+#include <NeuralNet/TrainingDataLoader.hpp>
 #include <NeuralNet/libtorch/CNNModel.hpp>
 #include <NeuralNet/libtorch/NeuralNetworkInputImpl.hpp>
 #include <NeuralNet/libtorch/NeuralNetworkOutputImpl.hpp>
@@ -17,6 +18,7 @@
 #include <torch/torch.h>
 
 #include <string>
+#include <vector>
 
 namespace RosettaTorch::NeuralNet
 {
@@ -58,6 +60,10 @@ class NeuralNetworkImpl
                const NeuralNetworkOutputImpl& output, std::size_t batchSize,
                std::size_t epoch);
 
+    //! Trains neural network model with all batches of \p loader.
+    //! \param loader The loader that streams the batches.
+    void Train(TrainingDataLoader& loader);
+
     //! Verifies neural network model.
     //! \param input The input features for the model.
     //! \param output The output label for the model.
@@ -65,6 +71,11 @@ class NeuralNetworkImpl
     std::pair<uint64_t, uint64_t> Verify(const NeuralNetworkInputImpl& input,
                                          const NeuralNetworkOutputImpl& output);
 
+    //! Verifies neural network model with all batches of \p loader.
+    //! \param loader The loader that streams the batches.
+    //! \return The value of correct and total.
+    std::pair<uint64_t, uint64_t> Verify(TrainingDataLoader& loader);
+
     //! Predicts neural network model.
     //! \param input The input getter to convert data type to framework's.
     //! \return The result of predict.
@@ -78,6 +89,12 @@ class NeuralNetworkImpl
     double Predict(const torch::Tensor& hero, const torch::Tensor& minion,
                    const torch::Tensor& standalone);
 
+    //! Predicts neural network model for several states in one forward pass.
+    //! \param inputs The input getters to convert data type to framework's.
+    //! \param results The container to store the results of predict.
+    void Predict(const std::vector<const IInputGetter*>& inputs,
+                 std::vector<double>& results);
+
  private:
     torch::nn::ModuleHolder<CNNModel> m_net;
     bool m_isRandom = false;
@@ -10,6 +10,7 @@
 #ifndef ROSETTASTONE_TORCH_NEURAL_NET_NEURAL_NETWORK_IMPL_HPP
 #define ROSETTASTONE_TORCH_NEURAL_NET_NEURAL_NETWORK_IMPL_HPP
 
+#include <NeuralNet/TrainingDataLoader.hpp>
 #include <NeuralNet/tiny-dnn/NeuralNetworkInputImpl.hpp>
 #include <NeuralNet/tiny-dnn/NeuralNetworkOutputImpl.hpp>
 
@@ -25,6 +26,7 @@
 #include <tiny_dnn/tiny_dnn.h>
 
 #include <string>
+#include <vector>
 
 namespace RosettaTorch::NeuralNet
 {
@@ -66,6 +68,10 @@ class NeuralNetworkImpl
                const NeuralNetworkOutputImpl& output, std::size_t batchSize,
                std::size_t epoch);
 
+    //! Trains neural network model with all batches of \p loader.
+    //! \param loader The loader that streams the batches.
+    void Train(TrainingDataLoader& loader);
+
     //! Verifies neural network model.
     //! \param input The input features for the model.
     //! \param output The output label for the model.
@@ -73,6 +79,11 @@ class NeuralNetworkImpl
     std::pair<uint64_t, uint64_t> Verify(const NeuralNetworkInputImpl& input,
                                          const NeuralNetworkOutputImpl& output);
 
+    //! Verifies neural network model with all batches of \p loader.
+    //! \param loader The loader that streams the batches.
+    //! \return The value of correct and total.
+    std::pair<uint64_t, uint64_t> Verify(TrainingDataLoader& loader);
+
     //! Predicts neural network model.
     //! \param input The input getter to convert data type to framework's.
     //! \return The result of predict.
@@ -90,6 +101,12 @@ class NeuralNetworkImpl
     //! \return The result of predict.
     void Predict(const NeuralNetworkInputImpl* input, std::vector<double>& results);
 
+    //! Predicts neural network model for several states in one forward pass.
+    //! \param inputs The input getters to convert data type to framework's.
+    //! \param results The container to store the results of predict.
+    void Predict(const std::vector<const IInputGetter*>& inputs,
+                 std::vector<double>& results);
+
  private:
     tiny_dnn::network<tiny_dnn::graph> m_net;
     bool m_isRandom = false;
@@ -8,79 +8,159 @@
 // References: https://github.com/peter1591/hearthstone-ai
 
 #include <Agents/MCTSRunner.hpp>
+#include <MCTS/Selection/NodeBudget.hpp>
+#include <MCTS/Selection/TreeSnapshot.hpp>
+#include <NeuralNet/InferenceServer.hpp>
 
 #include <Rosetta/Commons/DeckCode.hpp>
 #include <Rosetta/Games/GameRestorer.hpp>
 #include <Rosetta/Views/BoardView.hpp>
 #include <Rosetta/Views/Types/UnknownCards.hpp>
 
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
 namespace RosettaTorch::Agents
 {
-MCTSRunner::MCTSRunner(const MCTSConfig& config) : m_config(config)
+MCTSRunner::MCTSRunner(const MCTSConfig& config)
+    : m_config(config), m_statistics(std::make_unique<MCTS::Statistics<>>())
 {
-    // Do nothing
+    Trees garbage;
+    ResetTree(m_p1Tree, garbage);
+    ResetTree(m_p2Tree, garbage);
+
+    if (m_config.mcts.maxTreeNodes != 0)
+    {
+        m_config.mcts.nodeBudget =
+            std::make_shared<MCTS::NodeBudget>(m_config.mcts.maxTreeNodes);
+    }
+
+    if (m_config.inferenceBatchSize > 1 && m_config.threads > 1)
+    {
+        // A batch can't be larger than the number of threads that wait
+        const int batchSize =
+            std::min(m_config.inferenceBatchSize, m_config.threads);
+
+        NeuralNet::NeuralNetwork net;
+        net.Load(m_config.mcts.neuralNetPath, m_config.mcts.isNeuralNetRandom);
+
+        m_config.mcts.inferenceServer =
+            std::make_shared<NeuralNet::InferenceServer>(
+                std::move(net), static_cast<std::size_t>(batchSize),
+                std::chrono::microseconds(m_config.inferenceMaxWait));
+    }
 }
 
 MCTSRunner::~MCTSRunner()
 {
     WaitUntilStopped();
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_shutdownFlag = true;
+    }
+
+    m_searchCV.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+
+    if (m_releaseThread.joinable())
+    {
+        m_releaseThread.join();
+    }
 }
 
-void MCTSRunner::Run(const BoardRefView& gameState)
+void MCTSRunner::Run(const BoardRefView& view)
 {
-    m_stopFlag = false;
+    WaitUntilStopped();
 
-    for (int i = 0; i < m_config.threads; ++i)
     {
-        m_threads.emplace_back([this, gameState]() {
-            BoardView boardView;
-            Views::Types::UnknownCardsInfo p1Unknown;
-            Views::Types::UnknownCardsInfo p2Unknown;
+        std::lock_guard<std::mutex> lock(m_mutex);
 
-            const std::string INNKEEPER_EXPERT_WARLOCK =
-                "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+        // No thread touches the trees between searches
+        PrepareTrees(view);
+        m_statistics = std::make_unique<MCTS::Statistics<>>();
 
-            p1Unknown.deckCards =
-                DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
-            p2Unknown.deckCards =
-                DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+        m_gameState.emplace(view);
+        ++m_searchID;
+        m_numRunningThreads = m_config.threads;
+        m_stopFlag = false;
+        m_isIterated = false;
+    }
 
-            boardView.Parse(gameState, p1Unknown, p2Unknown);
-            auto gameRestorer =
-                GameRestorer::Prepare(boardView, p1Unknown, p2Unknown);
-            auto gameGetter = [&]() -> std::unique_ptr<Game> {
-                return gameRestorer.RestoreGame();
-            };
+    while (static_cast<int>(m_threads.size()) < m_config.threads)
+    {
+        m_threads.emplace_back([this]() { RunThread(); });
+    }
 
-            MCTS::MOMCTS mcts(m_p1Tree, m_p2Tree, m_statistics, m_config.mcts);
+    m_searchCV.notify_all();
+}
 
-            while (!m_stopFlag.load())
-            {
-                mcts.Iterate([&]() { return gameGetter(); });
+bool MCTSRunner::WaitForIterations(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
 
-                m_statistics.IterateSucceeded();
-            }
-        });
-    }
+    return m_progressCV.wait_for(lock, timeout,
+                                 [this]() { return m_isIterated.load(); });
 }
 
 const MCTS::Statistics<>& MCTSRunner::GetStatistics() const
 {
-    return m_statistics;
+    return *m_statistics;
 }
 
 const MCTS::TreeNode* MCTSRunner::GetRootNode(PlayerType playerType) const
 {
     if (playerType == PlayerType::PLAYER1)
     {
-        return &m_p1Tree;
+        return m_p1Tree.root;
     }
     else
     {
-        return &m_p2Tree;
+        return m_p2Tree.root;
     }
 }
 
+void MCTSRunner::SaveTree(PlayerType playerType, const std::string& path)
+{
+    WaitUntilStopped();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const SearchTree& tree =
+        (playerType == PlayerType::PLAYER1) ? m_p1Tree : m_p2Tree;
+
+    // The board of the last search is the board of the root for its side
+    const std::uint64_t boardHash =
+        (m_lastSide == playerType) ? m_lastBoardHash : 0;
+
+    MCTS::TreeSnapshot::Save(path, *tree.tree, tree.root,
+                             tree.redirectNodeMap, boardHash);
+}
+
+void MCTSRunner::LoadTree(PlayerType playerType, const std::string& path)
+{
+    WaitUntilStopped();
+
+    const MCTS::TreeSnapshot snapshot(path);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    SearchTree& tree =
+        (playerType == PlayerType::PLAYER1) ? m_p1Tree : m_p2Tree;
+
+    Trees garbage;
+    garbage.emplace_back(std::move(tree.tree));
+    tree.tree = snapshot.Restore(&tree.root, &tree.redirectNodeMap);
+    tree.loadedBoardHash = snapshot.GetBoardHash();
+
+    ReleaseTrees(std::move(garbage));
+}
+
 void MCTSRunner::NotifyStop()
 {
     m_stopFlag = true;
@@ -90,11 +170,337 @@ void MCTSRunner::WaitUntilStopped()
 {
     NotifyStop();
 
-    for (auto& thread : m_threads)
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_progressCV.wait(lock, [this]() { return m_numRunningThreads == 0; });
+
+    // The threads have copied the view, and its game may be gone after the
+    // search
+    m_gameState.reset();
+}
+
+void MCTSRunner::PrepareTrees(const BoardRefView& view)
+{
+    const PlayerType side = view.GetSide();
+    SearchTree& myTree = (side == PlayerType::PLAYER1) ? m_p1Tree : m_p2Tree;
+    SearchTree& opTree = (side == PlayerType::PLAYER1) ? m_p2Tree : m_p1Tree;
+
+    const bool isSameSide = m_config.reuseTree && m_lastSide == side;
+    const bool isSameTurn = isSameSide && view.GetTurn() == m_lastTurn;
+    const bool isNextTurn = isSameSide && view.GetTurn() > m_lastTurn;
+
+    // A loaded tree is searched again from the board that it was saved for
+    const bool isLoaded = myTree.loadedBoardHash != 0 &&
+                          myTree.loadedBoardHash == view.GetHash();
+    myTree.loadedBoardHash = 0;
+
+    Trees garbage;
+
+    if (!isLoaded && (!(isSameTurn || isNextTurn) ||
+                      !PromoteSubtree(myTree, view, isSameTurn, garbage)))
     {
-        thread.join();
+        ResetTree(myTree, garbage);
+    }
+
+    // The opponent's tree jumps by the board where the opponent acts next,
+    // so the root is still valid in the same turn. In the next turn, its
+    // nodes are keyed by the hands that were guessed for the opponent.
+    if (!isSameTurn)
+    {
+        ResetTree(opTree, garbage);
+    }
+
+    m_lastSide = side;
+    m_lastTurn = view.GetTurn();
+    m_lastBoardHash = view.GetHash();
+
+    if (m_config.mcts.nodeBudget)
+    {
+        PruneTrees();
+    }
+
+    ReleaseTrees(std::move(garbage));
+}
+
+bool MCTSRunner::PromoteSubtree(SearchTree& tree, const BoardRefView& view,
+                                bool isSameTurn, Trees& garbage)
+{
+    const std::uint64_t boardHash = view.GetHash();
+    MCTS::BoardNodeMap& redirectNodeMap =
+        (tree.redirectNodeMap != nullptr) ? *tree.redirectNodeMap
+                                          : tree.root->addon.boardNodeMap;
+
+    if (isSameTurn)
+    {
+        // The boards of a turn are in one map, so the nodes of the other
+        // actions are kept because they can be reached in another order
+        MCTS::TreeNode* node = redirectNodeMap.Find(boardHash);
+        if (node == nullptr)
+        {
+            return false;
+        }
+
+        tree.root = node;
+        tree.redirectNodeMap = &redirectNodeMap;
+        return true;
     }
 
-    m_threads.clear();
+    // The opponent's turn is applied to a board that ended the last turn
+    std::unique_ptr<MCTS::TreeNode> node;
+    redirectNodeMap.ForEach([&](std::uint64_t, MCTS::TreeNode* turnEnd) {
+        if (turnEnd != nullptr)
+        {
+            node = turnEnd->addon.boardNodeMap.Release(boardHash);
+        }
+        return node == nullptr;
+    });
+
+    if (node == nullptr)
+    {
+        return false;
+    }
+
+    // The leading nodes are in the last turn that is freed
+    if constexpr (MCTS::RECORD_LEADING_NODES)
+    {
+        node->addon.leadingNodes.Clear();
+    }
+
+    garbage.emplace_back(std::move(tree.tree));
+    tree.tree = std::move(node);
+    tree.root = tree.tree.get();
+    tree.redirectNodeMap = nullptr;
+
+    return true;
+}
+
+void MCTSRunner::ResetTree(SearchTree& tree, Trees& garbage)
+{
+    garbage.emplace_back(std::move(tree.tree));
+    tree.tree = std::make_unique<MCTS::TreeNode>();
+    tree.root = tree.tree.get();
+    tree.redirectNodeMap = nullptr;
+    tree.loadedBoardHash = 0;
+}
+
+void MCTSRunner::PruneTrees()
+{
+    // The nodes are listed in preorder, so the descendants of a node follow
+    // it and the subtree of nodes[i] is [i, i + sizes[i])
+    std::vector<MCTS::TreeNode*> nodes;
+    std::vector<std::size_t> parents;
+    std::vector<std::size_t> sizes;
+    std::vector<std::int64_t> visits;
+    std::vector<bool> isProtected;
+
+    std::vector<std::pair<MCTS::TreeNode*, std::size_t>> stack;
+    for (const SearchTree* tree : { &m_p1Tree, &m_p2Tree })
+    {
+        stack.emplace_back(tree->tree.get(), nodes.size());
+        while (!stack.empty())
+        {
+            const auto [node, parent] = stack.back();
+            stack.pop_back();
+
+            const std::size_t idx = nodes.size();
+            nodes.emplace_back(node);
+            parents.emplace_back(parent);
+            sizes.emplace_back(1);
+            visits.emplace_back(0);
+            isProtected.emplace_back(node == tree->root);
+
+            node->children.ForEach([&](int, const MCTS::EdgeAddon* edgeAddon,
+                                       MCTS::TreeNode* child) {
+                visits[idx] += edgeAddon->GetChosenTimes();
+                if (child != nullptr)
+                {
+                    stack.emplace_back(child, idx);
+                }
+                return true;
+            });
+            node->children.ForEachDetachedNode(
+                [&](int, MCTS::TreeNode* child) {
+                    stack.emplace_back(child, idx);
+                    return true;
+                });
+            node->addon.boardNodeMap.ForEach(
+                [&](std::uint64_t, MCTS::TreeNode* child) {
+                    if (child != nullptr)
+                    {
+                        stack.emplace_back(child, idx);
+                    }
+                    return true;
+                });
+        }
+    }
+
+    MCTS::NodeBudget& nodeBudget = *m_config.mcts.nodeBudget;
+    const std::size_t maxNodes = nodeBudget.GetMaxNodes() / 2;
+    if (nodes.size() <= maxNodes)
+    {
+        nodeBudget.SetNumNodes(nodes.size());
+        return;
+    }
+
+    for (std::size_t i = nodes.size() - 1; i > 0; --i)
+    {
+        if (parents[i] != i)
+        {
+            sizes[parents[i]] += sizes[i];
+        }
+        if (isProtected[i] && parents[i] != i)
+        {
+            isProtected[parents[i]] = true;
+        }
+    }
+
+    std::vector<std::size_t> candidates;
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        if (!isProtected[i] && sizes[i] > 1)
+        {
+            candidates.emplace_back(i);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [&](std::size_t lhs, std::size_t rhs) {
+                  return visits[lhs] < visits[rhs];
+              });
+
+    std::vector<bool> isRemoved(nodes.size(), false);
+    std::unordered_set<const MCTS::TreeNode*> prunedNodes;
+    std::size_t numNodes = nodes.size();
+
+    for (const std::size_t idx : candidates)
+    {
+        if (numNodes <= maxNodes)
+        {
+            break;
+        }
+        if (isRemoved[idx])
+        {
+            continue;
+        }
+
+        // The subtree of a removed node is removed already
+        for (std::size_t i = idx + 1; i < idx + sizes[idx];)
+        {
+            if (isRemoved[i])
+            {
+                i += sizes[i];
+                continue;
+            }
+
+            isRemoved[i] = true;
+            prunedNodes.emplace(nodes[i]);
+            --numNodes;
+            ++i;
+        }
+
+        nodes[idx]->children.Clear();
+        nodes[idx]->addon.boardNodeMap.Clear();
+        prunedNodes.emplace(nodes[idx]);
+    }
+
+    nodeBudget.SetNumNodes(numNodes);
+
+    // The edges of the collapsed nodes are freed with their children
+    if constexpr (MCTS::RECORD_LEADING_NODES)
+    {
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            if (isRemoved[i])
+            {
+                continue;
+            }
+
+            nodes[i]->addon.leadingNodes.RemoveIf(
+                [&](MCTS::TreeNode* node, MCTS::EdgeAddon*) {
+                    return prunedNodes.count(node) > 0;
+                });
+        }
+    }
+}
+
+void MCTSRunner::ReleaseTrees(Trees trees)
+{
+    if (m_releaseThread.joinable())
+    {
+        m_releaseThread.join();
+    }
+
+    // A large tree takes long to free, so the search doesn't wait for it
+    m_releaseThread =
+        std::thread([trees = std::move(trees)]() mutable { trees.clear(); });
+}
+
+void MCTSRunner::RunThread()
+{
+    std::size_t searchID = 0;
+
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_searchCV.wait(lock, [&]() {
+            return m_shutdownFlag || m_searchID != searchID;
+        });
+
+        if (m_shutdownFlag)
+        {
+            return;
+        }
+
+        searchID = m_searchID;
+        const BoardRefView gameState = *m_gameState;
+        lock.unlock();
+
+        Search(gameState);
+
+        lock.lock();
+        if (--m_numRunningThreads == 0)
+        {
+            m_progressCV.notify_all();
+        }
+    }
+}
+
+void MCTSRunner::Search(const BoardRefView& gameState)
+{
+    BoardView boardView;
+    Views::Types::UnknownCardsInfo p1Unknown;
+    Views::Types::UnknownCardsInfo p2Unknown;
+
+    const std::string INNKEEPER_EXPERT_WARLOCK =
+        "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+
+    p1Unknown.deckCards =
+        DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+    p2Unknown.deckCards =
+        DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+
+    boardView.Parse(gameState, p1Unknown, p2Unknown);
+    auto gameRestorer = GameRestorer::Prepare(boardView, p1Unknown, p2Unknown);
+    auto gameGetter = [&]() -> std::unique_ptr<Game> {
+        return gameRestorer.RestoreGame();
+    };
+
+    MCTS::MOMCTS mcts(*m_p1Tree.root, *m_p2Tree.root, *m_statistics,
+                      m_config.mcts, m_p1Tree.redirectNodeMap,
+                      m_p2Tree.redirectNodeMap);
+
+    while (!m_stopFlag.load())
+    {
+        mcts.Iterate([&]() { return gameGetter(); });
+
+        m_statistics->IterateSucceeded();
+
+        // Only the thread that reaches the target first wakes the waiters
+        if (m_statistics->GetSuccededIterates() >=
+                static_cast<std::uint64_t>(m_config.iterationsPerAction) &&
+            !m_isIterated.exchange(true))
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_progressCV.notify_all();
+        }
+    }
 }
-}  // namespace RosettaTorch::Agents
\ No newline at end of file
+}  // namespace RosettaTorch::Agents
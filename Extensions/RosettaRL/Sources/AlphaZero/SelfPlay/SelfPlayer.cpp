@@ -10,8 +10,10 @@
 #include <AlphaZero/SelfPlay/SelfPlayer.hpp>
 
 #include <Rosetta/Commons/Macros.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
 #include <fstream>
+#include <sstream>
 
 #if !defined(ROSETTASTONE_WINDOWS)
 #include <stdlib.h>
@@ -106,35 +108,40 @@ void SelfPlayer::RemoveTempFile()
     }
 }
 
-void SelfPlayer::SaveJSON(const nlohmann::json& json)
+void SelfPlayer::SaveRecord(const Judges::Binary::GameRecord& record)
 {
     if (m_config.saveDir.empty())
     {
         return;
     }
 
-    time_t now;
-    time(&now);
-
-    struct tm timeinfo
+    if (m_writer == nullptr)
     {
-    };
+        time_t now;
+        time(&now);
+
+        struct tm timeinfo
+        {
+        };
 #ifdef _MSC_VER
-    localtime_s(&timeinfo, &now);
+        localtime_s(&timeinfo, &now);
 #else
-    localtime_r(&now, &timeinfo);
+        localtime_r(&now, &timeinfo);
 #endif
 
-    char buffer[80];
-    strftime(buffer, 80, "%Y%m%d-%H%M%S", &timeinfo);
+        char buffer[80];
+        strftime(buffer, 80, "%Y%m%d-%H%M%S", &timeinfo);
 
-    std::ostringstream ss;
-    const int postfix = Random::get<int>(0, 89999) + 10000;
-    ss << m_config.saveDir << "/" << buffer << "-" << postfix << ".json";
-    const std::string fileName = ss.str();
+        // NOTE: Each self player appends to its own shards
+        std::ostringstream ss;
+        const int postfix =
+            RandomGenerator::GetThreadLocal().Get<int>(0, 89999) + 10000;
+        ss << buffer << "-" << postfix;
+
+        m_writer = std::make_shared<Judges::Binary::RecordWriter>(
+            m_config.saveDir, ss.str());
+    }
 
-    std::ofstream fs(fileName, std::ofstream::trunc);
-    fs << json;
-    fs.close();
+    m_writer->Write(record);
 }
-}  // namespace RosettaTorch::AlphaZero::SelfPlay
\ No newline at end of file
+}  // namespace RosettaTorch::AlphaZero::SelfPlay
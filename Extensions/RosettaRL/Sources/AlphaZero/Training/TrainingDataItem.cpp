@@ -13,14 +13,14 @@
 
 namespace RosettaTorch::AlphaZero
 {
-TrainingDataItem::TrainingDataItem(Judges::JSON::NeuralNetInputGetter input,
+TrainingDataItem::TrainingDataItem(Judges::Binary::NeuralNetInputGetter input,
                                    int label)
     : m_input(std::move(input)), m_label(label)
 {
     // Do nothing
 }
 
-const Judges::JSON::NeuralNetInputGetter& TrainingDataItem::GetInput() const
+const Judges::Binary::NeuralNetInputGetter& TrainingDataItem::GetInput() const
 {
     return m_input;
 }
@@ -0,0 +1,234 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Judges/Binary/GameRecord.hpp>
+
+#include <Rosetta/Actions/ActionValidGetter.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace RosettaStone;
+
+namespace RosettaTorch::Judges::Binary
+{
+namespace
+{
+struct Header
+{
+    std::uint32_t numEntries;
+    std::uint32_t numChoices;
+    std::uint32_t numSnapshots;
+    GameResult result;
+    std::uint8_t reserved[3];
+};
+
+static_assert(sizeof(Header) == 16, "The size of header must be fixed");
+
+//! Clamps \p value to the range of std::int16_t.
+std::int16_t ToInt16(int value)
+{
+    return static_cast<std::int16_t>(std::clamp(value, -32768, 32767));
+}
+
+//! Fills \p side with the fields of \p player.
+void CaptureSide(const Player* player, SideSnapshot& side)
+{
+    side.manaRemaining = ToInt16(player->GetRemainingMana());
+    side.manaTotal = ToInt16(player->GetTotalMana());
+    side.overloadOwed = ToInt16(player->GetOverloadOwed());
+    side.overloadLocked = ToInt16(player->GetOverloadLocked());
+    side.heroHealth = ToInt16(player->GetHero()->GetHealth());
+    side.heroArmor = ToInt16(player->GetHero()->GetArmor());
+
+    for (const auto& minion : player->GetFieldZone()->GetView())
+    {
+        MinionSnapshot& snapshot = side.minions[side.numMinions++];
+        snapshot.attack = ToInt16(minion->GetAttack());
+        snapshot.health = ToInt16(minion->GetHealth());
+        snapshot.maxHealth = ToInt16(minion->GetMaxHealth());
+        snapshot.flags = static_cast<std::uint8_t>(
+            (minion->GetGameTag(GameTag::TAUNT) ? TAUNT : 0) |
+            (minion->GetGameTag(GameTag::DIVINE_SHIELD) ? DIVINE_SHIELD : 0) |
+            (minion->GetGameTag(GameTag::STEALTH) ? STEALTH : 0));
+    }
+
+    for (const auto& card : player->GetHandZone()->GetView())
+    {
+        HandCardSnapshot& snapshot = side.hand[side.numHandCards++];
+        snapshot.cost = ToInt16(card->GetCost());
+    }
+}
+
+//! Checks the counts of \p side are in range.
+bool IsValidSide(const SideSnapshot& side)
+{
+    return side.numMinions <= MAX_FIELD_SIZE &&
+           side.numHandCards <= MAX_HAND_SIZE;
+}
+
+//! Copies \p count elements of \p T from \p data at \p offset to \p values.
+template <typename T>
+bool ReadArray(const char* data, std::size_t size, std::size_t& offset,
+               std::size_t count, std::vector<T>& values)
+{
+    if (count > (size - offset) / sizeof(T))
+    {
+        return false;
+    }
+
+    values.resize(count);
+    std::memcpy(values.data(), data + offset, count * sizeof(T));
+    offset += count * sizeof(T);
+
+    return true;
+}
+
+//! Appends \p values to \p data.
+template <typename T>
+void WriteArray(const std::vector<T>& values, std::string& data)
+{
+    data.append(reinterpret_cast<const char*>(values.data()),
+                values.size() * sizeof(T));
+}
+}  // namespace
+
+StateSnapshot StateSnapshot::Capture(Game& game, std::uint32_t entryIdx)
+{
+    StateSnapshot snapshot{};
+    snapshot.entryIdx = entryIdx;
+
+    const Player* curPlayer = game.GetCurrentPlayer();
+    snapshot.currentPlayer =
+        curPlayer->playerType == PlayerType::PLAYER1 ? 1 : 2;
+
+    CaptureSide(curPlayer, snapshot.current);
+    CaptureSide(game.GetOpponentPlayer(), snapshot.opponent);
+
+    // NOTE: Only the current player can play cards, use hero power and
+    // attack, like JSONSerializer does
+    ActionValidGetter getter(game);
+
+    getter.ForEachPlayableCard([&](Entity* card) {
+        const int handIdx = curPlayer->GetHandZone()->FindIndex(card);
+        snapshot.current.hand[handIdx].playable = 1;
+        return true;
+    });
+
+    snapshot.current.heroPowerPlayable =
+        static_cast<std::uint8_t>(getter.CanUseHeroPower());
+
+    getter.ForEachAttacker([&](Character* character) {
+        if (const auto minion = EntityCast<Minion>(character))
+        {
+            const int minionIdx = curPlayer->GetFieldZone()->FindIndex(minion);
+            snapshot.current.minions[minionIdx].flags |= ATTACKABLE;
+        }
+        return true;
+    });
+
+    return snapshot;
+}
+
+void GameRecord::Clear()
+{
+    entries.clear();
+    choices.clear();
+    snapshots.clear();
+    result = GameResult::INVALID;
+}
+
+void GameRecord::Serialize(std::string& data) const
+{
+    Header header{};
+    header.numEntries = static_cast<std::uint32_t>(entries.size());
+    header.numChoices = static_cast<std::uint32_t>(choices.size());
+    header.numSnapshots = static_cast<std::uint32_t>(snapshots.size());
+    header.result = result;
+
+    data.reserve(data.size() + sizeof(Header) +
+                 entries.size() * sizeof(Entry) +
+                 choices.size() * sizeof(std::int32_t) +
+                 snapshots.size() * sizeof(StateSnapshot));
+
+    data.append(reinterpret_cast<const char*>(&header), sizeof(Header));
+    WriteArray(entries, data);
+    WriteArray(choices, data);
+    WriteArray(snapshots, data);
+}
+
+bool GameRecord::Deserialize(const char* data, std::size_t size)
+{
+    Clear();
+
+    if (size < sizeof(Header))
+    {
+        return false;
+    }
+
+    Header header{};
+    std::memcpy(&header, data, sizeof(Header));
+    std::size_t offset = sizeof(Header);
+
+    if (!ReadArray(data, size, offset, header.numEntries, entries) ||
+        !ReadArray(data, size, offset, header.numChoices, choices) ||
+        !ReadArray(data, size, offset, header.numSnapshots, snapshots) ||
+        offset != size)
+    {
+        Clear();
+        return false;
+    }
+
+    // Validate the references between sections
+    std::size_t numChoices = 0;
+    for (const Entry& entry : entries)
+    {
+        numChoices += entry.numChoices;
+    }
+
+    const bool isValid =
+        numChoices == choices.size() &&
+        std::all_of(snapshots.begin(), snapshots.end(),
+                    [&](const StateSnapshot& snapshot) {
+                        return snapshot.entryIdx < entries.size() &&
+                               IsValidSide(snapshot.current) &&
+                               IsValidSide(snapshot.opponent);
+                    });
+    if (!isValid)
+    {
+        Clear();
+        return false;
+    }
+
+    result = header.result;
+    return true;
+}
+
+GameResult GameRecord::GetResult(
+    const std::tuple<PlayState, PlayState>& result)
+{
+    const auto& [p1Result, p2Result] = result;
+
+    if (p1Result == PlayState::WON && p2Result == PlayState::LOST)
+    {
+        return GameResult::PLAYER1_WIN;
+    }
+
+    if (p1Result == PlayState::LOST && p2Result == PlayState::WON)
+    {
+        return GameResult::PLAYER2_WIN;
+    }
+
+    if (p1Result == PlayState::TIED && p2Result == PlayState::TIED)
+    {
+        return GameResult::DRAW;
+    }
+
+    return GameResult::INVALID;
+}
+}  // namespace RosettaTorch::Judges::Binary
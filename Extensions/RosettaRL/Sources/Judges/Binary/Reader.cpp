@@ -0,0 +1,338 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Judges/Binary/Reader.hpp>
+
+#include <Rosetta/Views/FeatureEncoder.hpp>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace RosettaTorch::Judges::Binary
+{
+namespace
+{
+//! Returns the value of the field of \p side.
+double GetSideField(NeuralNet::FieldType fieldType, int arg,
+                    const SideSnapshot& side)
+{
+    switch (fieldType)
+    {
+        case NeuralNet::FieldType::MANA_CRYSTAL_CURRENT:
+            return side.manaRemaining;
+        case NeuralNet::FieldType::MANA_CRYSTAL_TOTAL:
+            return side.manaTotal;
+        case NeuralNet::FieldType::MANA_CRYSTAL_OVERLOAD_OWED:
+            return side.overloadOwed;
+        case NeuralNet::FieldType::MANA_CRYSTAL_OVERLOAD_LOCKED:
+            return side.overloadLocked;
+        case NeuralNet::FieldType::HERO_HEALTH:
+            return side.heroHealth;
+        case NeuralNet::FieldType::HERO_ARMOR:
+            return side.heroArmor;
+        case NeuralNet::FieldType::HERO_POWER_PLAYABLE:
+            return side.heroPowerPlayable;
+        case NeuralNet::FieldType::MINION_COUNT:
+            return side.numMinions;
+        case NeuralNet::FieldType::MINION_ATTACK:
+            return side.minions[arg].attack;
+        case NeuralNet::FieldType::MINION_HEALTH:
+            return side.minions[arg].health;
+        case NeuralNet::FieldType::MINION_MAX_HEALTH:
+            return side.minions[arg].maxHealth;
+        case NeuralNet::FieldType::MINION_ATTACKABLE:
+            return (side.minions[arg].flags & ATTACKABLE) != 0;
+        case NeuralNet::FieldType::MINION_TAUNT:
+            return (side.minions[arg].flags & TAUNT) != 0;
+        case NeuralNet::FieldType::MINION_DIVINE_SHIELD:
+            return (side.minions[arg].flags & DIVINE_SHIELD) != 0;
+        case NeuralNet::FieldType::MINION_STEALTH:
+            return (side.minions[arg].flags & STEALTH) != 0;
+        case NeuralNet::FieldType::HAND_COUNT:
+            return side.numHandCards;
+        case NeuralNet::FieldType::HAND_PLAYABLE:
+            return side.hand[arg].playable;
+        case NeuralNet::FieldType::HAND_COST:
+            return side.hand[arg].cost;
+        default:
+            throw std::runtime_error("Unknown field type");
+    }
+}
+
+//! Normalizes the value from uniform distribution to mean = 0, var = 1.
+float NormalizeFromUniformDist(double v, double min, double max)
+{
+    // Uniform dist is with variance = (max-min)^2 / 12
+    static const double sqrt12 = std::sqrt(12.0);
+
+    const double mean = (min + max) / 2;
+    const double scale = sqrt12 / (max - min);
+
+    return static_cast<float>((v - mean) * scale);
+}
+
+//! Normalizes the boolean value.
+float NormalizeBool(bool v)
+{
+    return NormalizeFromUniformDist(v ? 1.0 : -1.0, -1.0, 1.0);
+}
+
+//! Writes the features of the minions of \p side to \p data.
+void EncodeMinions(const SideSnapshot& side, float* data)
+{
+    using RosettaStone::FeatureEncoder;
+
+    for (std::size_t i = 0; i < FeatureEncoder::NUM_MAX_MINIONS; ++i)
+    {
+        if (i < side.numMinions)
+        {
+            const MinionSnapshot& minion = side.minions[i];
+
+            data[0] = NormalizeFromUniformDist(minion.health, 1.0, 7.0);
+            data[1] = NormalizeFromUniformDist(minion.maxHealth, 1.0, 7.0);
+            data[2] = NormalizeFromUniformDist(minion.attack, 0.0, 7.0);
+            data[3] = NormalizeBool((minion.flags & ATTACKABLE) != 0);
+            data[4] = NormalizeBool((minion.flags & TAUNT) != 0);
+            data[5] = NormalizeBool((minion.flags & DIVINE_SHIELD) != 0);
+            data[6] = NormalizeBool((minion.flags & STEALTH) != 0);
+        }
+        else
+        {
+            data[0] = 0.0f;
+            data[1] = 0.0f;
+            data[2] = 0.0f;
+            data[3] = NormalizeBool(false);
+            data[4] = NormalizeBool(false);
+            data[5] = NormalizeBool(false);
+            data[6] = NormalizeBool(false);
+        }
+
+        data += FeatureEncoder::NUM_MINION_FEATURES;
+    }
+}
+
+//! Converts \p side to JSON object in the format of JSONSerializer.
+nlohmann::json SideToJSON(const SideSnapshot& side)
+{
+    nlohmann::json obj;
+
+    obj["mana_crystal"]["remaining"] = side.manaRemaining;
+    obj["mana_crystal"]["total"] = side.manaTotal;
+    obj["mana_crystal"]["overload_owed"] = side.overloadOwed;
+    obj["mana_crystal"]["overload_locked"] = side.overloadLocked;
+    obj["hero"]["health"] = side.heroHealth;
+    obj["hero"]["armor"] = side.heroArmor;
+    obj["hero_power"]["playable"] = side.heroPowerPlayable;
+
+    obj["minions"] = nlohmann::json::array();
+    for (std::size_t i = 0; i < side.numMinions; ++i)
+    {
+        const MinionSnapshot& minion = side.minions[i];
+
+        nlohmann::json minionObj;
+        minionObj["attack"] = minion.attack;
+        minionObj["health"] = minion.health;
+        minionObj["max_health"] = minion.maxHealth;
+        minionObj["attackable"] = (minion.flags & ATTACKABLE) != 0 ? 1 : 0;
+        minionObj["taunt"] = (minion.flags & TAUNT) != 0 ? 1 : 0;
+        minionObj["divine_shield"] =
+            (minion.flags & DIVINE_SHIELD) != 0 ? 1 : 0;
+        minionObj["stealth"] = (minion.flags & STEALTH) != 0 ? 1 : 0;
+        obj["minions"].emplace_back(minionObj);
+    }
+
+    obj["hand"] = nlohmann::json::array();
+    for (std::size_t i = 0; i < side.numHandCards; ++i)
+    {
+        nlohmann::json cardObj;
+        cardObj["cost"] = side.hand[i].cost;
+        cardObj["playable"] = side.hand[i].playable;
+        obj["hand"].emplace_back(cardObj);
+    }
+
+    return obj;
+}
+
+//! Returns the string of the game result in the format of JSON::Recorder.
+std::string GetResultString(GameResult result)
+{
+    switch (result)
+    {
+        case GameResult::PLAYER1_WIN:
+            return "PLAYER1_WIN";
+        case GameResult::PLAYER2_WIN:
+            return "PLAYER2_WIN";
+        case GameResult::DRAW:
+            return "DRAW";
+        default:
+            return "INVALID";
+    }
+}
+
+//! Returns the string of the choices type in the format of JSON::Recorder.
+std::string GetChoicesTypeString(ChoicesType type)
+{
+    switch (type)
+    {
+        case ChoicesType::CHOOSE_FROM_NUMBERS:
+            return "CHOOSE_FROM_NUMBERS";
+        case ChoicesType::CHOOSE_FROM_CARD_IDS:
+            return "CHOOSE_FROM_CARD_IDS";
+        default:
+            return "INVALID";
+    }
+}
+}  // namespace
+
+NeuralNetInputGetter::NeuralNetInputGetter(const StateSnapshot& snapshot)
+    : m_snapshot(snapshot)
+{
+    // Do nothing
+}
+
+double NeuralNetInputGetter::GetField(NeuralNet::FieldSide fieldSide,
+                                      NeuralNet::FieldType fieldType,
+                                      int arg) const
+{
+    if (fieldSide == NeuralNet::FieldSide::CURRENT)
+    {
+        return GetSideField(fieldType, arg, m_snapshot.current);
+    }
+    if (fieldSide == NeuralNet::FieldSide::OPPONENT)
+    {
+        return GetSideField(fieldType, arg, m_snapshot.opponent);
+    }
+
+    throw std::runtime_error("Invalid side");
+}
+
+bool NeuralNetInputGetter::Encode(float* data) const
+{
+    using RosettaStone::FeatureEncoder;
+
+    const SideSnapshot& current = m_snapshot.current;
+    const SideSnapshot& opponent = m_snapshot.opponent;
+
+    // The counts index the arrays of the snapshot
+    for (const SideSnapshot* side : { &current, &opponent })
+    {
+        if (side->numMinions > RosettaStone::MAX_FIELD_SIZE ||
+            side->numHandCards > RosettaStone::MAX_HAND_SIZE)
+        {
+            return false;
+        }
+    }
+
+    data[FeatureEncoder::HERO_OFFSET] = NormalizeFromUniformDist(
+        current.heroHealth + current.heroArmor, 0.0, 30.0);
+    data[FeatureEncoder::HERO_OFFSET + 1] = NormalizeFromUniformDist(
+        opponent.heroHealth + opponent.heroArmor, 0.0, 30.0);
+
+    EncodeMinions(current, data + FeatureEncoder::MINION_OFFSET);
+    EncodeMinions(opponent, data + FeatureEncoder::MINION_OFFSET +
+                                FeatureEncoder::MINION_SIZE / 2);
+
+    float* standalone = data + FeatureEncoder::STANDALONE_OFFSET;
+
+    int numPlayables = 0;
+    for (std::size_t i = 0; i < current.numHandCards; ++i)
+    {
+        numPlayables += current.hand[i].playable;
+    }
+
+    standalone[0] = NormalizeFromUniformDist(current.manaRemaining, 0, 10);
+    standalone[1] = NormalizeFromUniformDist(current.manaTotal, 0, 10);
+    standalone[2] = NormalizeFromUniformDist(current.overloadLocked, 0, 10);
+    standalone[3] = NormalizeFromUniformDist(current.numHandCards, 0, 10);
+    standalone[4] = NormalizeFromUniformDist(numPlayables, 0, 10);
+    standalone += 5;
+
+    for (std::size_t i = 0; i < FeatureEncoder::NUM_MAX_HAND_CARDS; ++i)
+    {
+        // Empty slots are encoded as a card of cost -1
+        const int cost = i < current.numHandCards ? current.hand[i].cost : -1;
+        standalone[i] = NormalizeFromUniformDist(cost, 0, 10);
+    }
+    standalone += FeatureEncoder::NUM_MAX_HAND_CARDS;
+
+    standalone[0] = NormalizeFromUniformDist(opponent.numHandCards, 0, 10);
+    standalone[1] = NormalizeBool(current.heroPowerPlayable != 0);
+
+    return true;
+}
+
+nlohmann::json Reader::ToJSON(const GameRecord& record)
+{
+    nlohmann::json json = nlohmann::json::array();
+
+    auto snapshot = record.snapshots.begin();
+    std::size_t choiceIdx = 0;
+
+    for (std::size_t idx = 0; idx < record.entries.size(); ++idx)
+    {
+        const Entry& entry = record.entries[idx];
+        nlohmann::json obj;
+
+        switch (entry.type)
+        {
+            case EntryType::MAIN_ACTION:
+                obj["type"] = "MAIN_ACTION";
+                obj["choice"] = RosettaStone::GetMainOpString(
+                    static_cast<RosettaStone::MainOpType>(entry.value));
+
+                if (snapshot != record.snapshots.end() &&
+                    snapshot->entryIdx == idx)
+                {
+                    nlohmann::json& field = obj["field"];
+                    field["current_player_id"] =
+                        snapshot->currentPlayer == 1 ? "Player1" : "Player2";
+                    field["current_player"] = SideToJSON(snapshot->current);
+                    field["opponent_player"] = SideToJSON(snapshot->opponent);
+                    ++snapshot;
+                }
+                break;
+            case EntryType::RANDOM:
+                obj["type"] = "RANDOM";
+                obj["max_value"] = entry.value;
+                obj["choice"] = entry.choice;
+                break;
+            case EntryType::MANUAL:
+                obj["type"] = RosettaStone::GetActionTypeString(
+                    static_cast<RosettaStone::ActionType>(entry.actionType));
+                obj["choices_type"] = GetChoicesTypeString(entry.choicesType);
+                obj["choices"] = nlohmann::json::array();
+                for (std::size_t i = 0; i < entry.numChoices; ++i)
+                {
+                    obj["choices"].emplace_back(record.choices[choiceIdx++]);
+                }
+                obj["choice"] = entry.choice;
+                break;
+            case EntryType::END:
+                obj["type"] = "END";
+                obj["result"] = GetResultString(record.result);
+                break;
+        }
+
+        json.emplace_back(obj);
+    }
+
+    return json;
+}
+
+bool Reader::IsCurrentPlayerWin(const StateSnapshot& snapshot,
+                                GameResult result)
+{
+    if (result == GameResult::INVALID)
+    {
+        throw std::runtime_error("Failed to parse winning player");
+    }
+
+    // NOTE: A draw is a loss for both players like JSON::Reader
+    return (snapshot.currentPlayer == 1 &&
+            result == GameResult::PLAYER1_WIN) ||
+           (snapshot.currentPlayer == 2 && result == GameResult::PLAYER2_WIN);
+}
+}  // namespace RosettaTorch::Judges::Binary
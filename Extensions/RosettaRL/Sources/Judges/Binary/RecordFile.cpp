@@ -0,0 +1,252 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Judges/Binary/RecordFile.hpp>
+
+#include <Rosetta/Loaders/CardImage.hpp>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace RosettaTorch::Judges::Binary
+{
+namespace
+{
+constexpr char MAGIC[4] = { 'R', 'S', 'G', 'R' };
+constexpr std::uint32_t VERSION = 1;
+
+//! The size of a record that is larger than any valid one.
+constexpr std::uint32_t MAX_RECORD_SIZE = 1u << 28;
+
+struct ShardHeader
+{
+    char magic[4];
+    std::uint32_t version;
+    Compression compression;
+    std::uint32_t reserved;
+};
+
+struct Frame
+{
+    std::uint32_t size;
+    std::uint32_t rawSize;
+    std::uint64_t checksum;
+};
+
+static_assert(sizeof(ShardHeader) == 16, "The size of header must be fixed");
+static_assert(sizeof(Frame) == 16, "The size of frame must be fixed");
+
+//! Checks whether the file of \p path exists.
+bool IsFileExist(const std::string& path)
+{
+    return std::ifstream(path).good();
+}
+
+//! Creates the file of \p path. It fails with EEXIST if the file exists.
+//! \param path The path of the file.
+//! \return The flag indicates whether the file is created.
+bool CreateNewFile(const std::string& path)
+{
+    std::FILE* file = std::fopen(path.c_str(), "wbx");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    std::fclose(file);
+    return true;
+}
+}  // namespace
+
+RecordWriter::RecordWriter(std::string dirName, std::string prefix,
+                           std::size_t maxShardSize, Compression compression)
+    : m_dirName(std::move(dirName)),
+      m_prefix(std::move(prefix)),
+      m_maxShardSize(maxShardSize),
+      m_compression(compression)
+{
+    if (m_compression != Compression::NONE)
+    {
+        throw std::invalid_argument(
+            "RecordWriter::RecordWriter() - Unsupported compression!");
+    }
+
+    OpenNextShard();
+}
+
+RecordWriter::~RecordWriter()
+{
+    Flush();
+}
+
+void RecordWriter::Write(const GameRecord& record)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_buffer.clear();
+    record.Serialize(m_buffer);
+
+    if (m_shardSize > sizeof(ShardHeader) &&
+        m_shardSize + sizeof(Frame) + m_buffer.size() > m_maxShardSize)
+    {
+        OpenNextShard();
+    }
+
+    Frame frame{};
+    frame.size = static_cast<std::uint32_t>(m_buffer.size());
+    frame.rawSize = frame.size;
+    frame.checksum = RosettaStone::CardImage::ComputeChecksum(m_buffer.data(),
+                                                              m_buffer.size());
+
+    m_file.write(reinterpret_cast<const char*>(&frame), sizeof(Frame));
+    m_file.write(m_buffer.data(),
+                 static_cast<std::streamsize>(m_buffer.size()));
+    m_shardSize += sizeof(Frame) + m_buffer.size();
+
+    if (!m_file)
+    {
+        throw std::runtime_error("RecordWriter::Write() - Failed to write!");
+    }
+}
+
+void RecordWriter::Flush()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_file.flush();
+}
+
+std::string RecordWriter::GetShardPath(const std::string& dirName,
+                                       const std::string& prefix,
+                                       std::size_t idx)
+{
+    std::ostringstream ss;
+    ss << dirName << "/" << prefix << "-" << std::setw(5) << std::setfill('0')
+       << idx << ".rsgr";
+
+    return ss.str();
+}
+
+void RecordWriter::OpenNextShard()
+{
+    if (m_file.is_open())
+    {
+        m_file.close();
+        ++m_shardIdx;
+    }
+
+    // The shard is created exclusively, so the writers of other processes
+    // take the next index instead of sharing the shard
+    std::string path = GetShardPath(m_dirName, m_prefix, m_shardIdx);
+    while (!CreateNewFile(path))
+    {
+        if (errno != EEXIST)
+        {
+            throw std::runtime_error(
+                "RecordWriter::OpenNextShard() - Failed to create " + path);
+        }
+
+        path = GetShardPath(m_dirName, m_prefix, ++m_shardIdx);
+    }
+
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file.is_open())
+    {
+        throw std::runtime_error(
+            "RecordWriter::OpenNextShard() - Failed to open " + path);
+    }
+
+    ShardHeader header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.compression = m_compression;
+
+    m_file.write(reinterpret_cast<const char*>(&header), sizeof(ShardHeader));
+    m_shardSize = sizeof(ShardHeader);
+}
+
+RecordReader::RecordReader(std::vector<std::string> paths)
+    : m_paths(std::move(paths))
+{
+    // Do nothing
+}
+
+RecordReader::RecordReader(const std::string& dirName,
+                           const std::string& prefix)
+    : m_paths(FindShards(dirName, prefix))
+{
+    // Do nothing
+}
+
+bool RecordReader::Next(GameRecord& record)
+{
+    while (m_file.is_open() || OpenNextShard())
+    {
+        Frame frame{};
+        if (m_file.read(reinterpret_cast<char*>(&frame), sizeof(Frame)) &&
+            frame.size < MAX_RECORD_SIZE)
+        {
+            m_buffer.resize(frame.size);
+            if (m_file.read(m_buffer.data(),
+                            static_cast<std::streamsize>(frame.size)) &&
+                frame.rawSize == frame.size &&
+                RosettaStone::CardImage::ComputeChecksum(
+                    m_buffer.data(), m_buffer.size()) == frame.checksum &&
+                record.Deserialize(m_buffer.data(), m_buffer.size()))
+            {
+                return true;
+            }
+        }
+
+        // The end of the shard, or a record that can't be read
+        m_file.close();
+    }
+
+    return false;
+}
+
+std::vector<std::string> RecordReader::FindShards(const std::string& dirName,
+                                                  const std::string& prefix)
+{
+    std::vector<std::string> paths;
+
+    // NOTE: A writer fills the indices of shards from 0 without a gap
+    std::string path = RecordWriter::GetShardPath(dirName, prefix, 0);
+    while (IsFileExist(path))
+    {
+        paths.emplace_back(path);
+        path = RecordWriter::GetShardPath(dirName, prefix, paths.size());
+    }
+
+    return paths;
+}
+
+bool RecordReader::OpenNextShard()
+{
+    while (m_pathIdx < m_paths.size())
+    {
+        m_file.clear();
+        m_file.open(m_paths[m_pathIdx++], std::ios::binary);
+
+        ShardHeader header{};
+        if (m_file.read(reinterpret_cast<char*>(&header),
+                        sizeof(ShardHeader)) &&
+            std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) == 0 &&
+            header.version == VERSION &&
+            header.compression == Compression::NONE)
+        {
+            return true;
+        }
+
+        m_file.close();
+    }
+
+    return false;
+}
+}  // namespace RosettaTorch::Judges::Binary
@@ -0,0 +1,93 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Judges/Binary/Recorder.hpp>
+
+#include <algorithm>
+
+namespace RosettaTorch::Judges::Binary
+{
+Recorder::Recorder(std::size_t snapshotInterval)
+    : m_snapshotInterval(std::max<std::size_t>(snapshotInterval, 1))
+{
+    // Do nothing
+}
+
+void Recorder::Start()
+{
+    m_record.Clear();
+    m_numMainActions = 0;
+}
+
+const GameRecord& Recorder::GetRecord() const
+{
+    return m_record;
+}
+
+void Recorder::RecordMainAction(RosettaStone::Game& game,
+                                RosettaStone::MainOpType op)
+{
+    const auto entryIdx = static_cast<std::uint32_t>(m_record.entries.size());
+
+    Entry entry{};
+    entry.type = EntryType::MAIN_ACTION;
+    entry.value = static_cast<std::int32_t>(op);
+    m_record.entries.emplace_back(entry);
+
+    if (m_numMainActions++ % m_snapshotInterval == 0)
+    {
+        m_record.snapshots.emplace_back(StateSnapshot::Capture(game, entryIdx));
+    }
+}
+
+void Recorder::RecordRandomAction(int maxValue, int action)
+{
+    Entry entry{};
+    entry.type = EntryType::RANDOM;
+    entry.value = maxValue;
+    entry.choice = action;
+    m_record.entries.emplace_back(entry);
+}
+
+void Recorder::RecordManualAction(RosettaStone::ActionType actionType,
+                                  RosettaStone::ActionChoices choices,
+                                  int action)
+{
+    Entry entry{};
+    entry.type = EntryType::MANUAL;
+    entry.actionType = static_cast<std::uint8_t>(actionType);
+    entry.choice = action;
+
+    if (choices.CheckType<RosettaStone::ChooseFromNumbers>())
+    {
+        entry.choicesType = ChoicesType::CHOOSE_FROM_NUMBERS;
+    }
+    else if (choices.CheckType<RosettaStone::ChooseFromCardIDs>())
+    {
+        entry.choicesType = ChoicesType::CHOOSE_FROM_CARD_IDS;
+    }
+
+    for (choices.Begin(); !choices.IsEnd(); choices.StepNext())
+    {
+        m_record.choices.emplace_back(
+            static_cast<std::int32_t>(choices.Get()));
+        ++entry.numChoices;
+    }
+
+    m_record.entries.emplace_back(entry);
+}
+
+void Recorder::End(
+    std::tuple<RosettaStone::PlayState, RosettaStone::PlayState> result)
+{
+    m_record.result = GameRecord::GetResult(result);
+
+    Entry entry{};
+    entry.type = EntryType::END;
+    entry.value = static_cast<std::int32_t>(m_record.result);
+    m_record.entries.emplace_back(entry);
+}
+}  // namespace RosettaTorch::Judges::Binary
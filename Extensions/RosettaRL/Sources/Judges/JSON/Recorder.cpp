@@ -55,7 +55,7 @@ void Recorder::RecordManualAction(RosettaStone::ActionType actionType,
 {
     nlohmann::json obj;
 
-    obj["type"] = GetActionTypeString(actionType);
+    obj["type"] = RosettaStone::GetActionTypeString(actionType);
     obj["choices_type"] = GetChoiceTypeString(choices);
 
     nlohmann::json choicesObj;
@@ -83,33 +83,6 @@ void Recorder::End(
     m_json.emplace_back(obj);
 }
 
-std::string Recorder::GetActionTypeString(RosettaStone::ActionType type)
-{
-    using RosettaStone::ActionType;
-
-    switch (type)
-    {
-        case ActionType::MAIN_ACTION:
-            return "MAIN_ACTION";
-        case ActionType::CHOOSE_HAND_CARD:
-            return "CHOOSE_HAND_CARD";
-        case ActionType::CHOOSE_ATTACKER:
-            return "CHOOSE_ATTACKER";
-        case ActionType::CHOOSE_MINION_PUT_LOCATION:
-            return "CHOOSE_MINION_PUT_LOCATION";
-        case ActionType::CHOOSE_TARGET:
-            return "CHOOSE_TARGET";
-        case ActionType::CHOOSE_ONE:
-            return "CHOOSE_ONE";
-        case ActionType::RANDOM:
-            return "RANDOM";
-        case ActionType::INVALID:
-            return "INVALID";
-        default:
-            return "UNKNOWN";
-    }
-}
-
 std::string Recorder::GetChoiceTypeString(
     const RosettaStone::ActionChoices& choices)
 {
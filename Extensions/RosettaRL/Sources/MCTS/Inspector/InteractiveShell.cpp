@@ -15,6 +15,21 @@
 
 namespace RosettaTorch::MCTS
 {
+namespace
+{
+//! Returns the rate of \p chosenTimes in \p totalChosenTimes.
+std::string GetSuggestionRate(std::int64_t chosenTimes,
+                              std::uint64_t totalChosenTimes)
+{
+    const double chosenPercent = 100.0 * chosenTimes / totalChosenTimes;
+
+    std::stringstream ss;
+    ss << chosenPercent << "% (" << chosenTimes << "/" << totalChosenTimes
+       << ")";
+    return ss.str();
+}
+}  // namespace
+
 InteractiveShell::InteractiveShell(Agents::MCTSRunner* controller,
                                    StartBoardGetter startBoardGetter)
     : m_controller(controller),
@@ -59,7 +74,11 @@ void InteractiveShell::DoCommand(std::istream& is, std::ostream& os)
            << std::endl
            << "root (1 or 2): set node to root node of player 1 or 2"
            << std::endl
-           << "node (addr): set node to specified address." << std::endl;
+           << "node (addr): set node to specified address." << std::endl
+           << "save (1 or 2) (path): save the tree of player 1 or 2"
+           << std::endl
+           << "load (path): load a tree to inspect instead of the controller's"
+           << std::endl;
     }
     else if (cmd == "b" || cmd == "best")
     {
@@ -69,6 +88,14 @@ void InteractiveShell::DoCommand(std::istream& is, std::ostream& os)
     {
         DoRoot(is, os);
     }
+    else if (cmd == "save")
+    {
+        DoSave(is, os);
+    }
+    else if (cmd == "load")
+    {
+        DoLoad(is, os);
+    }
     else if (cmd == "node")
     {
         std::uint64_t v = 0;
@@ -97,13 +124,7 @@ std::string InteractiveShell::GetChoiceSuggestionRate(
     const TreeNode* node, int choice, std::uint64_t totalChosenTimes)
 {
     const auto* edgeAddon = node->children.GetEdgeAddon(choice);
-    const auto chosenTimes = edgeAddon->GetChosenTimes();
-    const double chosenPercent = 100.0 * chosenTimes / totalChosenTimes;
-
-    std::stringstream ss;
-    ss << chosenPercent << "% (" << chosenTimes << "/" << totalChosenTimes
-       << ")";
-    return ss.str();
+    return GetSuggestionRate(edgeAddon->GetChosenTimes(), totalChosenTimes);
 }
 
 std::string InteractiveShell::GetTargetString(Character* character)
@@ -119,7 +140,7 @@ std::string InteractiveShell::GetTargetString(Character* character)
         return "Opponent Hero";
     }
 
-    const auto FindInMinions = [&](const std::vector<Minion*>& minions) -> int {
+    const auto FindInMinions = [&](const auto& minions) -> int {
         for (std::size_t i = 0; i < minions.size(); ++i)
         {
             if (minions[i] == character)
@@ -262,6 +283,61 @@ bool InteractiveShell::ShowBestSubNodeInfo(
     return true;
 }
 
+void InteractiveShell::ShowBestSnapshotNodeInfo(std::ostream& os,
+                                                std::uint32_t node,
+                                                int indent,
+                                                bool onlyShowBestChoice)
+{
+    std::string indentPadding;
+    for (int i = 0; i < indent; ++i)
+    {
+        indentPadding.append("   ");
+    }
+
+    std::int64_t totalChosenTime = 0;
+    int bestChoice = -1;
+    std::int64_t bestChoiceChosenTimes = 0;
+
+    m_snapshot->ForEachEdge(node, [&](const TreeSnapshot::Edge& edge) {
+        totalChosenTime += edge.chosenTimes;
+
+        if (edge.chosenTimes > bestChoiceChosenTimes)
+        {
+            bestChoiceChosenTimes = edge.chosenTimes;
+            bestChoice = edge.choice;
+        }
+
+        return true;
+    });
+
+    // NOTE: The nodes of a snapshot have no action type, so the choices are
+    // shown by their indices
+    m_snapshot->ForEachEdge(node, [&](const TreeSnapshot::Edge& edge) {
+        if (onlyShowBestChoice && edge.choice != bestChoice)
+        {
+            return true;
+        }
+
+        os << indentPadding << "Choice " << edge.choice << ": "
+           << GetSuggestionRate(edge.chosenTimes, totalChosenTime)
+           << std::endl;
+
+        if (!onlyShowBestChoice)
+        {
+            os << indentPadding << "   Estimated win rate: "
+               << 100.0 * edge.credit / edge.total << "%" << std::endl;
+        }
+
+        if (edge.child != TreeSnapshot::NO_NODE)
+        {
+            ShowBestSnapshotNodeInfo(os, edge.child, indent + 1,
+                                     onlyShowBestChoice);
+        }
+
+        return true;
+    });
+}
+
 std::string InteractiveShell::GetChoiceString(
     [[maybe_unused]] const TreeNode* mainNode,
     const ActionValidChecker& actionChecker, const TreeNode* node, int choice,
@@ -336,6 +412,20 @@ void InteractiveShell::DoBest(std::istream& is, std::ostream& os)
 
     os << "Best action: " << std::endl;
 
+    // The loaded tree is browsed without the board that it was saved for
+    if (m_snapshot)
+    {
+        ShowBestSnapshotNodeInfo(os, m_snapshot->GetRootIndex(), 0,
+                                 !verbose);
+        return;
+    }
+
+    if (!m_controller)
+    {
+        os << "[ERROR] no controller exists." << std::endl;
+        return;
+    }
+
     const Game game = m_startBoardGetter();
     ActionValidChecker checker;
     checker.Check(game);
@@ -385,7 +475,74 @@ void InteractiveShell::DoRoot(std::istream& is, std::ostream& os)
         return;
     }
 
+    // The loaded tree has the root of the player that it was saved for
+    if (m_snapshot)
+    {
+        m_snapshotNode = m_snapshot->GetRootIndex();
+        os << "Current node set to: #" << m_snapshotNode
+           << " of the loaded tree" << std::endl;
+        return;
+    }
+
+    if (!m_controller)
+    {
+        os << "[ERROR] no controller exists." << std::endl;
+        return;
+    }
+
     m_node = m_controller->GetRootNode(side);
     os << "Current node set to: " << m_node << std::endl;
 }
+
+void InteractiveShell::DoSave(std::istream& is, std::ostream& os)
+{
+    int v = 0;
+    std::string path;
+    is >> v >> path;
+
+    if ((v != 1 && v != 2) || path.empty())
+    {
+        os << "Invalid input" << std::endl;
+        return;
+    }
+
+    if (!m_controller)
+    {
+        os << "[ERROR] no controller exists." << std::endl;
+        return;
+    }
+
+    const PlayerType side =
+        (v == 1) ? PlayerType::PLAYER1 : PlayerType::PLAYER2;
+
+    try
+    {
+        m_controller->SaveTree(side, path);
+        os << "Tree saved to: " << path << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        os << "[ERROR] " << e.what() << std::endl;
+    }
+}
+
+void InteractiveShell::DoLoad(std::istream& is, std::ostream& os)
+{
+    std::string path;
+    is >> path;
+
+    try
+    {
+        m_snapshot = std::make_unique<TreeSnapshot>(path);
+        m_snapshotNode = m_snapshot->GetRootIndex();
+
+        os << "Tree loaded with " << m_snapshot->GetNumNodes()
+           << " nodes. Current node set to: #" << m_snapshotNode
+           << std::endl;
+    }
+    catch (const std::exception& e)
+    {
+        os << "[ERROR] " << e.what() << std::endl;
+    }
+}
 }  // namespace RosettaTorch::MCTS
\ No newline at end of file
@@ -12,9 +12,10 @@
 namespace RosettaTorch::MCTS
 {
 MOMCTS::MOMCTS(TreeNode& p1Tree, TreeNode& p2Tree, Statistics<>& statistics,
-               const Config& config)
-    : m_player1(p1Tree, statistics, config),
-      m_player2(p2Tree, statistics, config)
+               const Config& config, BoardNodeMap* p1RedirectNodeMap,
+               BoardNodeMap* p2RedirectNodeMap)
+    : m_player1(p1Tree, statistics, config, p1RedirectNodeMap),
+      m_player2(p2Tree, statistics, config, p2RedirectNodeMap)
 {
     // Do nothing
 }
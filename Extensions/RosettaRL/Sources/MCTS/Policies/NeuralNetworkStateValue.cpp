@@ -12,8 +12,12 @@
 namespace RosettaTorch::MCTS
 {
 NeuralNetworkStateValue::NeuralNetworkStateValue(const Config& config)
+    : m_server(config.inferenceServer)
 {
-    m_net.Load(config.neuralNetPath, config.isNeuralNetRandom);
+    if (m_server == nullptr)
+    {
+        m_net.Load(config.neuralNetPath, config.isNeuralNetRandom);
+    }
 }
 
 StateValue NeuralNetworkStateValue::GetStateValue(const Board& board)
@@ -25,7 +29,12 @@ StateValue NeuralNetworkStateValue::GetStateValue(const Game& game)
 {
     m_curPlayerViewer.Reset(game);
 
-    float score = static_cast<float>(m_net.Predict(&m_curPlayerViewer));
+    // The viewer stays valid while this thread waits for the batch
+    const double prediction =
+        m_server != nullptr ? m_server->Predict(&m_curPlayerViewer).get()
+                            : m_net.Predict(&m_curPlayerViewer);
+
+    float score = static_cast<float>(prediction);
     score = std::clamp(score, -1.0f, 1.0f);
 
     StateValue ret;
@@ -9,9 +9,8 @@
 
 #include <MCTS/Policies/Selection/RandomPolicy.hpp>
 
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
-using Random = effolkronium::random_static;
 
 namespace RosettaTorch::MCTS
 {
@@ -28,7 +27,8 @@ int RandomPolicy::SelectChoice([[maybe_unused]] ActionType actionType,
         ++choicesIdx;
     }
 
-    const auto randIdx = Random::get<std::size_t>(0, choicesIdx - 1);
+    const auto randIdx =
+        RandomGenerator::GetThreadLocal().Get<std::size_t>(0, choicesIdx - 1);
     return choices[randIdx].choice;
 }
 }  // namespace RosettaTorch::MCTS
\ No newline at end of file
@@ -11,11 +11,10 @@
 
 #include <Rosetta/Actions/ActionParams.hpp>
 
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
 #include <tuple>
 
-using Random = effolkronium::random_static;
 
 namespace RosettaTorch::MCTS
 {
@@ -34,7 +33,7 @@ bool HeuristicPlayoutHeuristicEarlyCutoffPolicy::IsEnableCutoff()
 bool HeuristicPlayoutHeuristicEarlyCutoffPolicy::GetCutoffResult(
     const Board& board, StateValue& stateValue)
 {
-    const auto val = Random::get<double>(0.0, 1.0);
+    const auto val = RandomGenerator::GetThreadLocal().Get<double>(0.0, 1.0);
     if (val >= CUTOFF_PROBABILITY)
     {
         return false;
@@ -117,7 +116,8 @@ void HeuristicPlayoutHeuristicEarlyCutoffPolicy::DFSBestStateValue(
 
             if (actionType == ActionType::RANDOM)
             {
-                return Random::get<std::size_t>(0, total - 1);
+                return RandomGenerator::GetThreadLocal().Get<std::size_t>(
+                    0, total - 1);
             }
 
             if constexpr (RANDOMLY_PUT_MINIONS)
@@ -125,7 +125,8 @@ void HeuristicPlayoutHeuristicEarlyCutoffPolicy::DFSBestStateValue(
                 if (actionType == ActionType::CHOOSE_MINION_PUT_LOCATION)
                 {
                     const std::size_t idx =
-                        Random::get<std::size_t>(0, total - 1);
+                        RandomGenerator::GetThreadLocal().Get<std::size_t>(
+                            0, total - 1);
                     return choices.Get(idx);
                 }
             }
@@ -257,7 +258,8 @@ int HeuristicPlayoutHeuristicEarlyCutoffPolicy::GetChoiceRandomly(
 {
     const std::size_t count = getter.Size();
     std::size_t idx = 0;
-    std::size_t randIdx = Random::get<std::size_t>(0, count - 1);
+    std::size_t randIdx =
+        RandomGenerator::GetThreadLocal().Get<std::size_t>(0, count - 1);
     int result = -1;
 
     getter.ForEachChoice([&](int choice) {
@@ -9,9 +9,8 @@
 
 #include <MCTS/Policies/Simulation/RandomPlayoutHeuristicEarlyCutoffPolicy.hpp>
 
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
-using Random = effolkronium::random_static;
 
 namespace RosettaTorch::MCTS
 {
@@ -30,7 +29,7 @@ bool RandomPlayoutHeuristicEarlyCutoffPolicy::IsEnableCutoff()
 bool RandomPlayoutHeuristicEarlyCutoffPolicy::GetCutoffResult(
     const Board& board, StateValue& stateValue)
 {
-    const auto val = Random::get<double>(0.0, 1.0);
+    const auto val = RandomGenerator::GetThreadLocal().Get<double>(0.0, 1.0);
     if (val >= CUTOFF_PROBABILITY)
     {
         return false;
@@ -53,7 +52,8 @@ int RandomPlayoutHeuristicEarlyCutoffPolicy::GetChoice(
     [[maybe_unused]] ActionType actionType, const ChoiceGetter& getter)
 {
     const std::size_t count = getter.Size();
-    const auto randIdx = Random::get<std::size_t>(0, count - 1);
+    const auto randIdx =
+        RandomGenerator::GetThreadLocal().Get<std::size_t>(0, count - 1);
     const int result = getter.Get(randIdx);
 
     return result;
@@ -9,9 +9,8 @@
 
 #include <MCTS/Policies/Simulation/RandomPlayoutPolicy.hpp>
 
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
-using Random = effolkronium::random_static;
 
 namespace RosettaTorch::MCTS
 {
@@ -48,7 +47,8 @@ int RandomPlayoutPolicy::GetChoice(
     [[maybe_unused]] ActionType actionType, const ChoiceGetter& getter)
 {
     const std::size_t count = getter.Size();
-    const auto randIdx = Random::get<std::size_t>(0, count - 1);
+    const auto randIdx =
+        RandomGenerator::GetThreadLocal().Get<std::size_t>(0, count - 1);
     const int result = getter.Get(randIdx);
 
     return result;
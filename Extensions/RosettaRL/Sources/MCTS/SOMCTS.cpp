@@ -14,10 +14,11 @@
 
 namespace RosettaTorch::MCTS
 {
-SOMCTS::SOMCTS(TreeNode& tree, Statistics<>& statistics, const Config& config)
+SOMCTS::SOMCTS(TreeNode& tree, Statistics<>& statistics, const Config& config,
+               BoardNodeMap* redirectNodeMap)
     : m_actionParams(*this),
       m_stage(Stage::SELECTION),
-      m_selectionStage(tree),
+      m_selectionStage(tree, config, redirectNodeMap),
       m_simulationStage(config),
       m_statistics(statistics)
 {
@@ -7,55 +7,72 @@
 // It is based on peter1591's hearthstone-ai repository.
 // References: https://github.com/peter1591/hearthstone-ai
 
+#include <MCTS/Commons/Constants.hpp>
 #include <MCTS/Selection/BoardNodeMap.hpp>
 #include <MCTS/Selection/TreeNode.hpp>
 
+#include <stdexcept>
+#include <tuple>
+
 namespace RosettaTorch::MCTS
 {
-using MapType = std::unordered_map<ReducedBoardView, std::unique_ptr<TreeNode>>;
-
 TreeNode* BoardNodeMap::GetOrCreateNode(const Board& board,
                                         bool* newNodeCreated)
 {
-    const auto boardView = board.CreateView();
+    const std::uint64_t boardHash = board.GetHash();
 
+    auto node = m_map.Find(boardHash, boardHash);
+    if (node == nullptr)
     {
-        std::shared_lock<SharedSpinLock> lock(m_mutex);
+        bool created;
+        std::tie(created, node) = m_map.GetOrCreate(
+            boardHash, boardHash, [](std::unique_ptr<TreeNode>& item) {
+                item.reset(new TreeNode());
+            });
 
-        if (m_map)
+        if (created && newNodeCreated)
         {
-            const auto it = m_map->find(boardView);
-            if (it != m_map->end())
-            {
-                return it->second.get();
-            }
+            *newNodeCreated = true;
         }
     }
 
+    if constexpr (CHECK_BOARD_HASH_COLLISION)
     {
-        std::lock_guard<SharedSpinLock> lock(m_mutex);
-        auto& item = GetLockedMap()[boardView];
-        if (!item)
+        if (!(*node)->addon.consistencyChecker.LockAndCheckBoard(
+                board.CreateView()))
         {
+            throw std::runtime_error(
+                "BoardNodeMap::GetOrCreateNode() - Hash collision!");
+        }
+    }
+
+    return node->get();
+}
+
+TreeNode* BoardNodeMap::GetOrCreateNode(std::uint64_t boardHash)
+{
+    const auto node = m_map.GetOrCreate(
+        boardHash, boardHash, [](std::unique_ptr<TreeNode>& item) {
             item.reset(new TreeNode());
+        });
 
-            if (newNodeCreated)
-            {
-                *newNodeCreated = true;
-            }
-        }
+    return node.second->get();
+}
 
-        return item.get();
-    }
+TreeNode* BoardNodeMap::Find(std::uint64_t boardHash) const
+{
+    const auto node = m_map.Find(boardHash, boardHash);
+    return node != nullptr ? node->get() : nullptr;
 }
 
-MapType& BoardNodeMap::GetLockedMap()
+std::unique_ptr<TreeNode> BoardNodeMap::Release(std::uint64_t boardHash)
 {
-    if (!m_map)
-    {
-        m_map.reset(new MapType());
-    }
+    const auto node = m_map.Find(boardHash, boardHash);
+    return node != nullptr ? std::move(*node) : nullptr;
+}
 
-    return *m_map;
+void BoardNodeMap::Clear()
+{
+    m_map.Clear();
 }
 }  // namespace RosettaTorch::MCTS
\ No newline at end of file
@@ -50,4 +50,17 @@ std::int64_t EdgeAddon::GetTotal() const
 {
     return m_total.load();
 }
+
+std::int64_t EdgeAddon::GetCredit() const
+{
+    return m_credit.load();
+}
+
+void EdgeAddon::Set(std::int64_t chosenTimes, std::int64_t credit,
+                    std::int64_t total)
+{
+    m_chosenTimes = chosenTimes;
+    m_credit = credit;
+    m_total = total;
+}
 }  // namespace RosettaTorch::MCTS
\ No newline at end of file
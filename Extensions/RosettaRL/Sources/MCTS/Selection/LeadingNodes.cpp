@@ -7,6 +7,7 @@
 // It is based on peter1591's hearthstone-ai repository.
 // References: https://github.com/peter1591/hearthstone-ai
 
+#include <MCTS/Commons/Constants.hpp>
 #include <MCTS/Selection/LeadingNodes.hpp>
 
 namespace RosettaTorch::MCTS
@@ -32,15 +33,29 @@ bool LeadingNodesItem::operator!=(const LeadingNodesItem& rhs) const
 
 void LeadingNodes::AddLeadingNodes(TreeNode* node, EdgeAddon* edgeAddon)
 {
-    std::lock_guard<SharedSpinLock> lock(m_mutex);
-    for (const auto& item : m_items)
+    const LeadingNodesItem item{ node, edgeAddon };
+    const std::size_t hash = std::hash<LeadingNodesItem>()(item);
+
+    if (m_items.Find(item, hash) != nullptr)
     {
-        if (item.node == node && item.edgeAddon == edgeAddon)
-        {
-            return;
-        }
+        return;
     }
 
-    m_items.push_back(LeadingNodesItem{ node, edgeAddon });
+    // The threads that check at the same time can exceed the limit a little
+    if (m_numItems.load(std::memory_order_relaxed) >= MAX_LEADING_NODES)
+    {
+        return;
+    }
+
+    if (m_items.GetOrCreate(item, hash, [](bool&) {}).first)
+    {
+        m_numItems.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void LeadingNodes::Clear()
+{
+    m_items.Clear();
+    m_numItems = 0;
 }
-}  // namespace RosettaTorch::MCTS
\ No newline at end of file
+}  // namespace RosettaTorch::MCTS
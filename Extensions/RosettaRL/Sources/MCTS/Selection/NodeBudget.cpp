@@ -0,0 +1,40 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <MCTS/Selection/NodeBudget.hpp>
+
+namespace RosettaTorch::MCTS
+{
+NodeBudget::NodeBudget(std::size_t maxNodes) : m_maxNodes(maxNodes)
+{
+    // Do nothing
+}
+
+std::size_t NodeBudget::GetMaxNodes() const
+{
+    return m_maxNodes;
+}
+
+std::size_t NodeBudget::GetNumNodes() const
+{
+    return m_numNodes.load(std::memory_order_relaxed);
+}
+
+bool NodeBudget::IsFull() const
+{
+    return GetNumNodes() >= m_maxNodes;
+}
+
+void NodeBudget::AddNode()
+{
+    m_numNodes.fetch_add(1, std::memory_order_relaxed);
+}
+
+void NodeBudget::SetNumNodes(std::size_t numNodes)
+{
+    m_numNodes.store(numNodes, std::memory_order_relaxed);
+}
+}  // namespace RosettaTorch::MCTS
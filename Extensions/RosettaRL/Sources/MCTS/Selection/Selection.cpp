@@ -13,11 +13,18 @@
 #include <MCTS/Policies/StageController.hpp>
 #include <MCTS/Selection/Selection.hpp>
 
+#include <Rosetta/Commons/RandomGenerator.hpp>
+
 #include <tuple>
 
 namespace RosettaTorch::MCTS
 {
-Selection::Selection(TreeNode& tree) : m_root(tree), m_policy(new UCBPolicy())
+Selection::Selection(TreeNode& tree, const Config& config,
+                     BoardNodeMap* redirectNodeMap)
+    : m_root(tree),
+      m_rootRedirectNodeMap(redirectNodeMap),
+      m_path(config.nodeBudget.get()),
+      m_policy(new UCBPolicy())
 {
     // Do nothing
 }
@@ -31,7 +38,7 @@ void Selection::StartIteration()
 {
     m_path.Restart(&m_root);
     m_boardChanged = false;
-    m_redirectNodeMap = nullptr;
+    m_redirectNodeMap = m_rootRedirectNodeMap;
 }
 
 void Selection::StartAction(const Board& board)
@@ -43,6 +50,10 @@ void Selection::StartAction(const Board& board)
     }
 
     auto currentNode = m_path.GetCurrentNode();
+    if (currentNode == nullptr)
+    {
+        return;
+    }
 
     if (m_redirectNodeMap == nullptr)
     {
@@ -58,6 +69,13 @@ int Selection::ChooseAction(ActionType actionType, ActionChoices& choices)
     }
 
     TreeNode* currentNode = m_path.GetCurrentNode();
+    if (currentNode == nullptr)
+    {
+        const auto idx = RandomGenerator::GetThreadLocal().Get<std::size_t>(
+            0, choices.Size() - 1);
+        return static_cast<int>(choices.Get(idx));
+    }
+
     const int nextChoice = m_policy->SelectChoice(
         actionType, ChoiceIterator(choices, currentNode->children));
 
@@ -70,10 +88,20 @@ int Selection::ChooseAction(ActionType actionType, ActionChoices& choices)
 bool Selection::FinishAction(const Board& board,
                              const std::tuple<PlayState, PlayState>& result)
 {
+    // The tree is full, so the rest of the iteration is simulated
+    if (m_path.GetCurrentNode() == nullptr)
+    {
+        return true;
+    }
+
     // We tackle the randomness by using a board node map.
     // This flatten tree structure, and effectively forgot the history
     // (Note that history here referring to the parent nodes of this node)
     m_path.ConstructRedirectNode(m_redirectNodeMap, board, result);
+    if (m_path.GetCurrentNode() == nullptr)
+    {
+        return true;
+    }
 
     auto& [p1Result, p2Result] = result;
     bool switchToSimulation = false;
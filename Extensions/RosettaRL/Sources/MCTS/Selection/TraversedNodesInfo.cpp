@@ -13,8 +13,11 @@
 
 namespace RosettaTorch::MCTS
 {
-TraversedNodesInfo::TraversedNodesInfo()
-    : m_newNodeCreated(false), m_currentNode(nullptr), m_pendingChoice(-1)
+TraversedNodesInfo::TraversedNodesInfo(NodeBudget* nodeBudget)
+    : m_nodeBudget(nodeBudget),
+      m_newNodeCreated(false),
+      m_currentNode(nullptr),
+      m_pendingChoice(-1)
 {
     // Do nothing
 }
@@ -44,6 +47,12 @@ bool TraversedNodesInfo::HasCurrentNodeMadeChoice() const
 
 void TraversedNodesInfo::ConstructNode()
 {
+    if (!CanCreateNode() && !m_currentNode->children.HasChild(m_pendingChoice))
+    {
+        LeaveTree();
+        return;
+    }
+
     const auto& [newNodeCreated, edgeAddon, node] =
         m_currentNode->children.GetOrCreateNewNode(
             m_pendingChoice, std::make_unique<TreeNode>());
@@ -53,6 +62,7 @@ void TraversedNodesInfo::ConstructNode()
     if (newNodeCreated)
     {
         m_newNodeCreated = true;
+        AddCreatedNode();
     }
 }
 
@@ -60,6 +70,12 @@ void TraversedNodesInfo::ConstructRedirectNode(
     BoardNodeMap* redirectNodeMap, const Board& board,
     std::tuple<PlayState, PlayState> result)
 {
+    if (!CanCreateNode() && !m_currentNode->children.HasChild(m_pendingChoice))
+    {
+        LeaveTree();
+        return;
+    }
+
     const auto& [newNodeCreated, edgeAddon, node] =
         m_currentNode->children.GetOrCreateRedirectNode(m_pendingChoice);
 
@@ -78,16 +94,46 @@ void TraversedNodesInfo::ConstructRedirectNode(
     }
     else
     {
+        bool nodeCreated = false;
         TreeNode* nextNode =
-            redirectNodeMap->GetOrCreateNode(board, &m_newNodeCreated);
+            CanCreateNode()
+                ? redirectNodeMap->GetOrCreateNode(board, &nodeCreated)
+                : redirectNodeMap->Find(board.GetHash());
+
+        if (nodeCreated)
+        {
+            AddCreatedNode();
+        }
+
+        // The edge is credited, but the path leaves the tree
+        if (nodeCreated || nextNode == nullptr)
+        {
+            m_newNodeCreated = true;
+        }
+
         AddPathNode(m_currentNode, m_pendingChoice, edgeAddon, nextNode);
     }
 }
 
 void TraversedNodesInfo::JumpToNode(const Board& board)
 {
-    TreeNode* nextNode =
-        m_currentNode->addon.boardNodeMap.GetOrCreateNode(board);
+    BoardNodeMap& boardNodeMap = m_currentNode->addon.boardNodeMap;
+
+    bool nodeCreated = false;
+    TreeNode* nextNode = CanCreateNode()
+                             ? boardNodeMap.GetOrCreateNode(board, &nodeCreated)
+                             : boardNodeMap.Find(board.GetHash());
+    if (nodeCreated)
+    {
+        AddCreatedNode();
+    }
+
+    if (nextNode == nullptr)
+    {
+        LeaveTree();
+        return;
+    }
+
     AddPathNode(m_currentNode, -1, nullptr, nextNode);
 }
 
@@ -106,8 +152,7 @@ void TraversedNodesInfo::Update(float credit)
         }
     }
 
-    TreeUpdater updater;
-    updater.Update(m_path, credit);
+    m_updater.Update(m_path, credit);
 }
 
 const std::vector<TraversedNodeInfo>& TraversedNodesInfo::GetPath() const
@@ -120,6 +165,26 @@ bool TraversedNodesInfo::HasNewNodeCreated() const
     return m_newNodeCreated;
 }
 
+bool TraversedNodesInfo::CanCreateNode() const
+{
+    return m_nodeBudget == nullptr || !m_nodeBudget->IsFull();
+}
+
+void TraversedNodesInfo::AddCreatedNode()
+{
+    if (m_nodeBudget != nullptr)
+    {
+        m_nodeBudget->AddNode();
+    }
+}
+
+void TraversedNodesInfo::LeaveTree()
+{
+    m_currentNode = nullptr;
+    m_pendingChoice = -1;
+    m_newNodeCreated = true;
+}
+
 void TraversedNodesInfo::AddPathNode(TreeNode* node, int choice,
                                      EdgeAddon* edgeAddon, TreeNode* nextNode)
 {
@@ -21,8 +21,18 @@ const EdgeAddon* ChildNodeMap::GetEdgeAddon(int choice) const
 std::tuple<bool, EdgeAddon*, TreeNode*> ChildNodeMap::GetOrCreateNewNode(
     int choice, std::unique_ptr<TreeNode> node)
 {
-    return GetOrCreate(choice,
-                       [&](ChildType& child) { child.node = std::move(node); });
+    const auto [created, edgeAddon, childNode] = GetOrCreate(
+        choice, [&](ChildType& child) { child.node = std::move(node); });
+    if (childNode != nullptr)
+    {
+        return { created, edgeAddon, childNode };
+    }
+
+    auto [nodeCreated, detachedNode] = m_detachedNodes.GetOrCreate(
+        choice, static_cast<std::uint32_t>(choice),
+        [&](std::unique_ptr<TreeNode>& item) { item = std::move(node); });
+
+    return { nodeCreated, edgeAddon, detachedNode->get() };
 }
 
 std::tuple<bool, EdgeAddon*, TreeNode*> ChildNodeMap::GetOrCreateRedirectNode(
@@ -32,55 +42,59 @@ std::tuple<bool, EdgeAddon*, TreeNode*> ChildNodeMap::GetOrCreateRedirectNode(
         choice, [](ChildType& child) { assert(child.node.get() == nullptr); });
 }
 
-bool ChildNodeMap::HasChild(int choice) const
+void ChildNodeMap::Clear()
 {
-    std::shared_lock<SharedSpinLock> lock(m_mapMutex);
+    m_map.Clear();
+    m_detachedNodes.Clear();
+}
 
-    return (m_map.find(choice) != m_map.end());
+bool ChildNodeMap::HasChild(int choice) const
+{
+    return m_map.Find(choice, static_cast<std::uint32_t>(choice)) != nullptr;
 }
 
 std::pair<const EdgeAddon*, TreeNode*> ChildNodeMap::Get(int choice) const
 {
-    std::shared_lock<SharedSpinLock> lock(m_mapMutex);
-
-    const auto it = m_map.find(choice);
-    if (it == m_map.end())
+    const ChildType* child =
+        m_map.Find(choice, static_cast<std::uint32_t>(choice));
+    if (child == nullptr)
     {
         return { nullptr, nullptr };
     }
-    else
-    {
-        return { &it->second.edgeAddon, it->second.node.get() };
-    }
+
+    return { &child->edgeAddon, child->node.get() };
 }
 
 template <class CreateFunctor>
 std::tuple<bool, EdgeAddon*, TreeNode*> ChildNodeMap::GetOrCreate(
     int choice, CreateFunctor&& createChildFunctor)
 {
-    {
-        std::shared_lock<SharedSpinLock> lock(m_mapMutex);
+    // The choice is unique, so it is used as the hash
+    auto [created, child] =
+        m_map.GetOrCreate(choice, static_cast<std::uint32_t>(choice),
+                          std::forward<CreateFunctor>(createChildFunctor));
 
-        auto it = m_map.find(choice);
-        if (it != m_map.end())
-        {
-            return { false, &it->second.edgeAddon, it->second.node.get() };
-        }
-    }
+    return { created, &child->edgeAddon, child->node.get() };
+}
 
-    {
-        std::lock_guard<SharedSpinLock> writeLock(m_mapMutex);
+TreeNode::TreeNode()
+{
+    s_numNodes.fetch_add(1, std::memory_order_relaxed);
+}
 
-        auto it = m_map.find(choice);
-        if (it != m_map.end())
-        {
-            return { false, &it->second.edgeAddon, it->second.node.get() };
-        }
+TreeNode::~TreeNode()
+{
+    s_numNodes.fetch_sub(1, std::memory_order_relaxed);
+}
 
-        auto& child = m_map[choice];
-        createChildFunctor(child);
+std::size_t TreeNode::GetNumNodes()
+{
+    return s_numNodes.load(std::memory_order_relaxed);
+}
 
-        return { true, &child.edgeAddon, child.node.get() };
-    }
+std::size_t TreeNode::GetNumBytes()
+{
+    return GetNumNodes() * sizeof(TreeNode) +
+           ConcurrentMapBase::GetAllocatedBytes();
 }
 }  // namespace RosettaTorch::MCTS
\ No newline at end of file
@@ -0,0 +1,522 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <MCTS/Commons/Constants.hpp>
+#include <MCTS/Selection/TreeSnapshot.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace RosettaTorch::MCTS
+{
+namespace
+{
+constexpr char MAGIC[4] = { 'R', 'S', 'M', 'T' };
+
+struct Header
+{
+    char magic[4];
+    std::uint32_t version;
+    std::uint32_t actionEncodingVersion;
+    std::uint32_t numNodes;
+    std::uint32_t numEdges;
+    std::uint32_t numBoards;
+    std::uint32_t numLeadingNodes;
+    std::uint32_t rootNode;
+    std::uint32_t redirectNode;
+    std::uint32_t reserved;
+    std::uint64_t boardHash;
+};
+
+static_assert(sizeof(Header) == 48, "The size of header must be fixed");
+static_assert(sizeof(TreeSnapshot::Node) == 24,
+              "The size of node must be fixed");
+static_assert(sizeof(TreeSnapshot::Edge) == 40,
+              "The size of edge must be fixed");
+static_assert(sizeof(TreeSnapshot::Board) == 16,
+              "The size of board must be fixed");
+static_assert(sizeof(TreeSnapshot::LeadingNode) == 8,
+              "The size of leading node must be fixed");
+
+//! Checks the range of [\p first, \p first + \p count) is in the table.
+bool IsInTable(std::uint32_t first, std::uint32_t count, std::uint32_t size)
+{
+    return first <= size && count <= size - first;
+}
+
+//! Writes the elements of \p table to \p file.
+template <typename T>
+void WriteTable(std::ofstream& file, const std::vector<T>& table)
+{
+    file.write(reinterpret_cast<const char*>(table.data()),
+               static_cast<std::streamsize>(table.size() * sizeof(T)));
+}
+}  // namespace
+
+void TreeSnapshot::Save(const std::string& path, const TreeNode& tree,
+                        const TreeNode* root,
+                        const BoardNodeMap* redirectNodeMap,
+                        std::uint64_t boardHash)
+{
+    // The nodes are listed in preorder, so the owner of a node comes first
+    std::vector<const TreeNode*> nodes;
+    std::unordered_map<const TreeNode*, std::uint32_t> nodeIndices;
+
+    std::vector<const TreeNode*> stack{ &tree };
+    while (!stack.empty())
+    {
+        const TreeNode* node = stack.back();
+        stack.pop_back();
+
+        nodeIndices.emplace(node, static_cast<std::uint32_t>(nodes.size()));
+        nodes.emplace_back(node);
+
+        node->children.ForEach([&](int, const EdgeAddon*, TreeNode* child) {
+            if (child != nullptr)
+            {
+                stack.emplace_back(child);
+            }
+            return true;
+        });
+        node->children.ForEachDetachedNode([&](int, TreeNode* child) {
+            stack.emplace_back(child);
+            return true;
+        });
+        node->addon.boardNodeMap.ForEach([&](std::uint64_t, TreeNode* child) {
+            if (child != nullptr)
+            {
+                stack.emplace_back(child);
+            }
+            return true;
+        });
+    }
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.actionEncodingVersion = ACTION_ENCODING_VERSION;
+    header.numNodes = static_cast<std::uint32_t>(nodes.size());
+    header.rootNode = 0;
+    header.redirectNode = NO_NODE;
+    header.boardHash = boardHash;
+
+    if (root != nullptr)
+    {
+        const auto iter = nodeIndices.find(root);
+        if (iter == nodeIndices.end())
+        {
+            throw std::invalid_argument(
+                "TreeSnapshot::Save() - The root is not in the tree!");
+        }
+
+        header.rootNode = iter->second;
+    }
+
+    std::vector<Node> nodeTable(nodes.size());
+    std::vector<Edge> edges;
+    std::vector<Board> boards;
+    std::vector<LeadingNode> leadingNodes;
+    std::unordered_map<const EdgeAddon*, std::uint32_t> edgeIndices;
+    std::unordered_map<int, std::uint32_t> detachedNodes;
+
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        const TreeNode* node = nodes[i];
+        Node& record = nodeTable[i];
+
+        if (&node->addon.boardNodeMap == redirectNodeMap)
+        {
+            header.redirectNode = static_cast<std::uint32_t>(i);
+        }
+
+        detachedNodes.clear();
+        node->children.ForEachDetachedNode([&](int choice, TreeNode* child) {
+            detachedNodes.emplace(choice, nodeIndices.at(child));
+            return true;
+        });
+
+        record.firstEdge = static_cast<std::uint32_t>(edges.size());
+        node->children.ForEach(
+            [&](int choice, const EdgeAddon* edgeAddon, TreeNode* child) {
+                Edge edge{};
+                edge.chosenTimes = edgeAddon->GetChosenTimes();
+                edge.credit = edgeAddon->GetCredit();
+                edge.total = edgeAddon->GetTotal();
+                edge.choice = choice;
+                edge.child =
+                    (child != nullptr) ? nodeIndices.at(child) : NO_NODE;
+
+                const auto iter = detachedNodes.find(choice);
+                edge.detachedChild =
+                    (iter != detachedNodes.end()) ? iter->second : NO_NODE;
+
+                edgeIndices.emplace(edgeAddon,
+                                    static_cast<std::uint32_t>(edges.size()));
+                edges.emplace_back(edge);
+                return true;
+            });
+        record.numEdges =
+            static_cast<std::uint32_t>(edges.size()) - record.firstEdge;
+
+        record.firstBoard = static_cast<std::uint32_t>(boards.size());
+        node->addon.boardNodeMap.ForEach(
+            [&](std::uint64_t hash, TreeNode* child) {
+                if (child != nullptr)
+                {
+                    boards.push_back({ hash, nodeIndices.at(child), 0 });
+                }
+                return true;
+            });
+        record.numBoards =
+            static_cast<std::uint32_t>(boards.size()) - record.firstBoard;
+    }
+
+    if (redirectNodeMap != nullptr && header.redirectNode == NO_NODE)
+    {
+        throw std::invalid_argument(
+            "TreeSnapshot::Save() - The redirect node map is not in the "
+            "tree!");
+    }
+
+    // The leading nodes refer to the edges, so they are listed last
+    for (std::size_t i = 0; i < nodes.size(); ++i)
+    {
+        Node& record = nodeTable[i];
+        record.firstLeadingNode =
+            static_cast<std::uint32_t>(leadingNodes.size());
+
+        if constexpr (RECORD_LEADING_NODES)
+        {
+            nodes[i]->addon.leadingNodes.ForEachLeadingNode(
+                [&](TreeNode* node, EdgeAddon* edgeAddon) {
+                    const auto nodeIter = nodeIndices.find(node);
+                    const auto edgeIter = edgeIndices.find(edgeAddon);
+                    if (nodeIter != nodeIndices.end() &&
+                        edgeIter != edgeIndices.end())
+                    {
+                        leadingNodes.push_back(
+                            { nodeIter->second, edgeIter->second });
+                    }
+                    return true;
+                });
+        }
+
+        record.numLeadingNodes =
+            static_cast<std::uint32_t>(leadingNodes.size()) -
+            record.firstLeadingNode;
+    }
+
+    header.numEdges = static_cast<std::uint32_t>(edges.size());
+    header.numBoards = static_cast<std::uint32_t>(boards.size());
+    header.numLeadingNodes = static_cast<std::uint32_t>(leadingNodes.size());
+
+    // Write to a temporary file first so that a reader never sees a
+    // partially written tree
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            throw std::runtime_error(
+                "TreeSnapshot::Save() - Failed to open " + tempPath);
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        WriteTable(file, nodeTable);
+        WriteTable(file, edges);
+        WriteTable(file, boards);
+        WriteTable(file, leadingNodes);
+
+        if (!file)
+        {
+            file.close();
+            std::remove(tempPath.c_str());
+            throw std::runtime_error(
+                "TreeSnapshot::Save() - Failed to write " + tempPath);
+        }
+    }
+
+#if defined(ROSETTASTONE_WINDOWS)
+    // NOTE: rename() doesn't replace an existing file on Windows
+    std::remove(path.c_str());
+#endif
+
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tempPath.c_str());
+        throw std::runtime_error("TreeSnapshot::Save() - Failed to rename " +
+                                 tempPath);
+    }
+}
+
+TreeSnapshot::TreeSnapshot(const std::string& path) : m_file(path)
+{
+    if (m_file.GetData() == nullptr || m_file.GetSize() < sizeof(Header))
+    {
+        throw std::runtime_error(
+            "TreeSnapshot::TreeSnapshot() - Failed to read " + path);
+    }
+
+    Header header{};
+    std::memcpy(&header, m_file.GetData(), sizeof(Header));
+
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.version != VERSION)
+    {
+        throw std::runtime_error(
+            "TreeSnapshot::TreeSnapshot() - Invalid format: " + path);
+    }
+
+    if (header.actionEncodingVersion != ACTION_ENCODING_VERSION)
+    {
+        throw std::runtime_error(
+            "TreeSnapshot::TreeSnapshot() - Out of date action encoding: " +
+            path);
+    }
+
+    const std::size_t nodesSize =
+        static_cast<std::size_t>(header.numNodes) * sizeof(Node);
+    const std::size_t edgesSize =
+        static_cast<std::size_t>(header.numEdges) * sizeof(Edge);
+    const std::size_t boardsSize =
+        static_cast<std::size_t>(header.numBoards) * sizeof(Board);
+    const std::size_t leadingNodesSize =
+        static_cast<std::size_t>(header.numLeadingNodes) * sizeof(LeadingNode);
+    if (m_file.GetSize() != sizeof(Header) + nodesSize + edgesSize +
+                                boardsSize + leadingNodesSize)
+    {
+        throw std::runtime_error(
+            "TreeSnapshot::TreeSnapshot() - Truncated file: " + path);
+    }
+
+    m_numNodes = header.numNodes;
+    m_numEdges = header.numEdges;
+    m_numBoards = header.numBoards;
+    m_numLeadingNodes = header.numLeadingNodes;
+    m_rootNode = header.rootNode;
+    m_redirectNode = header.redirectNode;
+    m_boardHash = header.boardHash;
+
+    // NOTE: The mapping is aligned to a page and all tables are aligned to
+    // 8 bytes, so the records are read in place
+    const char* data = m_file.GetData() + sizeof(Header);
+    m_nodes = reinterpret_cast<const Node*>(data);
+    m_edges = reinterpret_cast<const Edge*>(data + nodesSize);
+    m_boards = reinterpret_cast<const Board*>(data + nodesSize + edgesSize);
+    m_leadingNodes = reinterpret_cast<const LeadingNode*>(
+        data + nodesSize + edgesSize + boardsSize);
+
+    if (!Validate())
+    {
+        throw std::runtime_error(
+            "TreeSnapshot::TreeSnapshot() - Corrupted file: " + path);
+    }
+}
+
+std::unique_ptr<TreeNode> TreeSnapshot::Restore(
+    TreeNode** root, BoardNodeMap** redirectNodeMap) const
+{
+    std::vector<TreeNode*> nodes(m_numNodes, nullptr);
+    std::vector<EdgeAddon*> edges(m_numEdges, nullptr);
+
+    auto tree = std::make_unique<TreeNode>();
+    nodes[0] = tree.get();
+
+    // Validate() checked that the owner of a node comes first, so the node
+    // is created before it is restored
+    for (std::uint32_t i = 0; i < m_numNodes; ++i)
+    {
+        TreeNode* node = nodes[i];
+        const Node& record = m_nodes[i];
+
+        for (std::uint32_t j = record.firstEdge;
+             j < record.firstEdge + record.numEdges; ++j)
+        {
+            const Edge& edge = m_edges[j];
+
+            bool created;
+            EdgeAddon* edgeAddon;
+            TreeNode* child;
+
+            if (edge.child != NO_NODE)
+            {
+                std::tie(created, edgeAddon, child) =
+                    node->children.GetOrCreateNewNode(
+                        edge.choice, std::make_unique<TreeNode>());
+                nodes[edge.child] = child;
+            }
+            else
+            {
+                std::tie(created, edgeAddon, child) =
+                    node->children.GetOrCreateRedirectNode(edge.choice);
+
+                if (edge.detachedChild != NO_NODE)
+                {
+                    nodes[edge.detachedChild] =
+                        std::get<2>(node->children.GetOrCreateNewNode(
+                            edge.choice, std::make_unique<TreeNode>()));
+                }
+            }
+
+            if (!created)
+            {
+                throw std::runtime_error(
+                    "TreeSnapshot::Restore() - Duplicated choice!");
+            }
+
+            edgeAddon->Set(edge.chosenTimes, edge.credit, edge.total);
+            edges[j] = edgeAddon;
+        }
+
+        for (std::uint32_t j = record.firstBoard;
+             j < record.firstBoard + record.numBoards; ++j)
+        {
+            const Board& board = m_boards[j];
+            if (node->addon.boardNodeMap.Find(board.hash) != nullptr)
+            {
+                throw std::runtime_error(
+                    "TreeSnapshot::Restore() - Duplicated board!");
+            }
+
+            nodes[board.node] =
+                node->addon.boardNodeMap.GetOrCreateNode(board.hash);
+        }
+    }
+
+    if constexpr (RECORD_LEADING_NODES)
+    {
+        for (std::uint32_t i = 0; i < m_numNodes; ++i)
+        {
+            const Node& record = m_nodes[i];
+
+            for (std::uint32_t j = record.firstLeadingNode;
+                 j < record.firstLeadingNode + record.numLeadingNodes; ++j)
+            {
+                const LeadingNode& leadingNode = m_leadingNodes[j];
+                if (edges[leadingNode.edge] != nullptr)
+                {
+                    nodes[i]->addon.leadingNodes.AddLeadingNodes(
+                        nodes[leadingNode.node], edges[leadingNode.edge]);
+                }
+            }
+        }
+    }
+
+    if (root != nullptr)
+    {
+        *root = nodes[m_rootNode];
+    }
+
+    if (redirectNodeMap != nullptr)
+    {
+        *redirectNodeMap = (m_redirectNode != NO_NODE)
+                               ? &nodes[m_redirectNode]->addon.boardNodeMap
+                               : nullptr;
+    }
+
+    return tree;
+}
+
+std::uint32_t TreeSnapshot::GetNumNodes() const
+{
+    return m_numNodes;
+}
+
+std::uint64_t TreeSnapshot::GetBoardHash() const
+{
+    return m_boardHash;
+}
+
+std::uint32_t TreeSnapshot::GetRootIndex() const
+{
+    return m_rootNode;
+}
+
+bool TreeSnapshot::Validate() const
+{
+    if (m_numNodes == 0 || m_rootNode >= m_numNodes ||
+        (m_redirectNode != NO_NODE && m_redirectNode >= m_numNodes))
+    {
+        return false;
+    }
+
+    std::vector<bool> isOwned(m_numNodes, false);
+    const auto own = [&](std::uint32_t node, std::uint32_t owner) {
+        if (node <= owner || node >= m_numNodes || isOwned[node])
+        {
+            return false;
+        }
+
+        isOwned[node] = true;
+        return true;
+    };
+
+    for (std::uint32_t i = 0; i < m_numNodes; ++i)
+    {
+        const Node& record = m_nodes[i];
+        if (!IsInTable(record.firstEdge, record.numEdges, m_numEdges) ||
+            !IsInTable(record.firstBoard, record.numBoards, m_numBoards) ||
+            !IsInTable(record.firstLeadingNode, record.numLeadingNodes,
+                       m_numLeadingNodes))
+        {
+            return false;
+        }
+
+        for (std::uint32_t j = record.firstEdge;
+             j < record.firstEdge + record.numEdges; ++j)
+        {
+            const Edge& edge = m_edges[j];
+            if (edge.child != NO_NODE)
+            {
+                // Only a redirect edge has a detached node
+                if (!own(edge.child, i) || edge.detachedChild != NO_NODE)
+                {
+                    return false;
+                }
+            }
+            else if (edge.detachedChild != NO_NODE &&
+                     !own(edge.detachedChild, i))
+            {
+                return false;
+            }
+        }
+
+        for (std::uint32_t j = record.firstBoard;
+             j < record.firstBoard + record.numBoards; ++j)
+        {
+            if (!own(m_boards[j].node, i))
+            {
+                return false;
+            }
+        }
+
+        for (std::uint32_t j = record.firstLeadingNode;
+             j < record.firstLeadingNode + record.numLeadingNodes; ++j)
+        {
+            if (m_leadingNodes[j].node >= m_numNodes ||
+                m_leadingNodes[j].edge >= m_numEdges)
+            {
+                return false;
+            }
+        }
+    }
+
+    for (std::uint32_t i = 1; i < m_numNodes; ++i)
+    {
+        if (!isOwned[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+}  // namespace RosettaTorch::MCTS
@@ -10,6 +10,7 @@
 #include <NeuralNet/GameDataBridge.hpp>
 
 #include <Rosetta/Actions/ActionValidGetter.hpp>
+#include <Rosetta/Views/FeatureEncoder.hpp>
 
 namespace RosettaTorch::NeuralNet
 {
@@ -17,6 +18,23 @@ void GameDataBridge::Reset(const RosettaStone::Game& game)
 {
     m_game = &game;
 
+    // Only GetField() needs the playables, Encode() finds them by itself
+    m_isPlayablesReady = false;
+}
+
+bool GameDataBridge::Encode(float* data) const
+{
+    RosettaStone::FeatureEncoder::Encode(*m_game, data);
+    return true;
+}
+
+void GameDataBridge::PreparePlayables() const
+{
+    if (m_isPlayablesReady)
+    {
+        return;
+    }
+
     RosettaStone::ActionValidGetter getter(*m_game);
 
     m_playableCards.clear();
@@ -26,6 +44,7 @@ void GameDataBridge::Reset(const RosettaStone::Game& game)
     });
 
     m_canUseHeroPower = getter.CanUseHeroPower();
+    m_isPlayablesReady = true;
 }
 
 double GameDataBridge::GetField(FieldSide fieldSide, FieldType fieldType,
@@ -84,11 +103,13 @@ double GameDataBridge::GetSideField(FieldType fieldType, int arg,
         case FieldType::HAND_COUNT:
             return handZone.GetCount();
         case FieldType::HAND_PLAYABLE:
+            PreparePlayables();
             return (std::find(m_playableCards.begin(), m_playableCards.end(),
                               handZone[arg]) != m_playableCards.end());
         case FieldType::HAND_COST:
             return handZone[arg]->GetCost();
         case FieldType::HERO_POWER_PLAYABLE:
+            PreparePlayables();
             return m_canUseHeroPower;
         default:
             throw std::runtime_error("Unknown field type");
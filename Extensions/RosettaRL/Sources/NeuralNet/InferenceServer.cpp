@@ -0,0 +1,143 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <NeuralNet/InferenceServer.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace RosettaTorch::NeuralNet
+{
+InferenceServer::InferenceServer(NeuralNetwork&& net,
+                                 std::size_t maxBatchSize,
+                                 std::chrono::microseconds maxWait)
+    : m_net(std::move(net)),
+      m_maxBatchSize(std::max<std::size_t>(maxBatchSize, 1)),
+      m_maxWait(maxWait)
+{
+    m_requests.reserve(m_maxBatchSize);
+    m_thread = std::thread([this]() { Run(); });
+}
+
+InferenceServer::~InferenceServer()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopFlag = true;
+    }
+
+    m_cv.notify_one();
+    m_thread.join();
+}
+
+std::future<double> InferenceServer::Predict(const IInputGetter* input)
+{
+    std::future<double> result;
+    bool needNotify;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        if (m_requests.empty())
+        {
+            m_firstRequestTime = std::chrono::steady_clock::now();
+        }
+
+        m_requests.push_back(Request{ input, std::promise<double>() });
+        result = m_requests.back().result.get_future();
+
+        // The server waits for the first request and for a full batch
+        needNotify = m_requests.size() == 1 ||
+                     m_requests.size() >= m_maxBatchSize;
+    }
+
+    if (needNotify)
+    {
+        m_cv.notify_one();
+    }
+
+    return result;
+}
+
+std::size_t InferenceServer::GetNumBatches() const
+{
+    return m_numBatches.load();
+}
+
+std::size_t InferenceServer::GetNumPredictions() const
+{
+    return m_numPredictions.load();
+}
+
+void InferenceServer::Run()
+{
+    std::vector<Request> batch;
+    std::vector<const IInputGetter*> inputs;
+    std::vector<double> results;
+
+    batch.reserve(m_maxBatchSize);
+    inputs.reserve(m_maxBatchSize);
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            m_cv.wait(lock,
+                      [this]() { return m_stopFlag || !m_requests.empty(); });
+
+            if (m_requests.empty())
+            {
+                return;
+            }
+
+            // Waits until the batch is full or the first request times out
+            m_cv.wait_until(lock, m_firstRequestTime + m_maxWait, [this]() {
+                return m_stopFlag || m_requests.size() >= m_maxBatchSize;
+            });
+
+            const std::size_t count =
+                std::min(m_requests.size(), m_maxBatchSize);
+            std::move(m_requests.begin(), m_requests.begin() + count,
+                      std::back_inserter(batch));
+            m_requests.erase(m_requests.begin(), m_requests.begin() + count);
+
+            if (!m_requests.empty())
+            {
+                m_firstRequestTime = std::chrono::steady_clock::now();
+            }
+        }
+
+        for (auto& request : batch)
+        {
+            inputs.push_back(request.input);
+        }
+
+        try
+        {
+            m_net.Predict(inputs, results);
+
+            for (std::size_t i = 0; i < batch.size(); ++i)
+            {
+                batch[i].result.set_value(results[i]);
+            }
+        }
+        catch (...)
+        {
+            for (auto& request : batch)
+            {
+                request.result.set_exception(std::current_exception());
+            }
+        }
+
+        ++m_numBatches;
+        m_numPredictions += batch.size();
+
+        batch.clear();
+        inputs.clear();
+    }
+}
+}  // namespace RosettaTorch::NeuralNet
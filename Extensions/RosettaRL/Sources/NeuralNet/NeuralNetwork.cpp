@@ -84,14 +84,31 @@ void NeuralNetwork::Train(const NeuralNetworkInput& input,
     return m_impl->Train(*input.m_impl, *output.m_impl, batchSize, epoch);
 }
 
+void NeuralNetwork::Train(TrainingDataLoader& loader) const
+{
+    return m_impl->Train(loader);
+}
+
 std::pair<uint64_t, uint64_t> NeuralNetwork::Verify(
     const NeuralNetworkInput& input, const NeuralNetworkOutput& output) const
 {
     return m_impl->Verify(*input.m_impl, *output.m_impl);
 }
 
+std::pair<uint64_t, uint64_t> NeuralNetwork::Verify(
+    TrainingDataLoader& loader) const
+{
+    return m_impl->Verify(loader);
+}
+
 double NeuralNetwork::Predict(IInputGetter* input) const
 {
     return m_impl->Predict(input);
 }
+
+void NeuralNetwork::Predict(const std::vector<const IInputGetter*>& inputs,
+                            std::vector<double>& results) const
+{
+    m_impl->Predict(inputs, results);
+}
 }  // namespace RosettaTorch::NeuralNet
\ No newline at end of file
@@ -0,0 +1,359 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Judges/Binary/Reader.hpp>
+#include <Judges/Binary/RecordFile.hpp>
+#include <NeuralNet/TrainingDataLoader.hpp>
+
+#include <Rosetta/Commons/RandomGenerator.hpp>
+#include <Rosetta/Views/FeatureEncoder.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+using RosettaStone::FeatureEncoder;
+using RosettaStone::RandomGenerator;
+
+namespace RosettaTorch::NeuralNet
+{
+TrainingDataLoader::TrainingDataLoader(std::vector<std::string> paths,
+                                       const TrainingDataLoaderConfig& config,
+                                       DataSplit split)
+    : m_paths(std::move(paths)), m_config(config), m_split(split)
+{
+    m_config.batchSize = std::max<std::size_t>(m_config.batchSize, 1);
+    m_config.shuffleBufferSize =
+        std::max(m_config.shuffleBufferSize, m_config.batchSize);
+    m_config.numWorkers = std::max<std::size_t>(m_config.numWorkers, 1);
+    m_config.numPrefetchBatches =
+        std::max<std::size_t>(m_config.numPrefetchBatches, 1);
+
+    m_shuffleFeatures.resize(m_config.shuffleBufferSize *
+                             FeatureEncoder::NUM_FEATURES);
+    m_shuffleLabels.resize(m_config.shuffleBufferSize);
+
+    // One more batch is held by the consumer
+    m_batches.resize(m_config.numPrefetchBatches + 1);
+    for (auto& batch : m_batches)
+    {
+        batch.features = AllocateAligned(m_config.batchSize *
+                                         FeatureEncoder::NUM_FEATURES);
+        batch.labels = AllocateAligned(m_config.batchSize);
+        m_freeBatches.emplace_back(&batch);
+    }
+
+    m_numActiveWorkers = m_config.numWorkers;
+
+    m_threads.emplace_back(&TrainingDataLoader::ReadRecords, this);
+    for (std::size_t i = 0; i < m_config.numWorkers; ++i)
+    {
+        m_threads.emplace_back(&TrainingDataLoader::DecodeRecords, this);
+    }
+    m_threads.emplace_back(&TrainingDataLoader::AssembleBatches, this);
+}
+
+TrainingDataLoader::~TrainingDataLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopped = true;
+    }
+
+    m_recordCV.notify_all();
+    m_shuffleCV.notify_all();
+    m_batchCV.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+bool TrainingDataLoader::Next(TrainingBatch& batch)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    if (m_currentBatch != nullptr)
+    {
+        m_freeBatches.emplace_back(m_currentBatch);
+        m_currentBatch = nullptr;
+        m_batchCV.notify_all();
+    }
+
+    m_batchCV.wait(lock, [this] {
+        return !m_readyBatches.empty() || m_isAssembleDone || m_isStopped;
+    });
+
+    if (m_exception)
+    {
+        std::rethrow_exception(m_exception);
+    }
+
+    if (m_readyBatches.empty())
+    {
+        return false;
+    }
+
+    m_currentBatch = m_readyBatches.front();
+    m_readyBatches.pop_front();
+
+    batch.size = m_currentBatch->size;
+    batch.features = m_currentBatch->features.get();
+    batch.labels = m_currentBatch->labels.get();
+
+    return true;
+}
+
+const TrainingDataLoaderConfig& TrainingDataLoader::GetConfig() const
+{
+    return m_config;
+}
+
+std::size_t TrainingDataLoader::GetNumSkippedRecords()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_numSkippedRecords;
+}
+
+void TrainingDataLoader::AlignedDeleter::operator()(float* ptr) const
+{
+    ::operator delete[](ptr, std::align_val_t(ALIGNMENT));
+}
+
+TrainingDataLoader::AlignedBuffer TrainingDataLoader::AllocateAligned(
+    std::size_t count)
+{
+    return AlignedBuffer(static_cast<float*>(::operator new[](
+        count * sizeof(float), std::align_val_t(ALIGNMENT))));
+}
+
+void TrainingDataLoader::ReadRecords()
+{
+    const RandomGenerator splitRandom(m_config.splitSeed);
+    const std::size_t maxQueuedRecords = 2 * m_config.numWorkers;
+
+    try
+    {
+        for (std::size_t epoch = 0; epoch < m_config.numEpochs; ++epoch)
+        {
+            Judges::Binary::RecordReader reader(m_paths);
+            Judges::Binary::GameRecord record;
+
+            // NOTE: A game is in the same split in every epoch because the
+            // split depends on the index of the record only
+            for (std::uint64_t recordIdx = 0; reader.Next(record);
+                 ++recordIdx)
+            {
+                const bool isValidation =
+                    splitRandom.Fork(recordIdx).Get(0.0, 1.0) <
+                    m_config.validationRate;
+                if (isValidation != (m_split == DataSplit::VALIDATION))
+                {
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_recordCV.wait(lock, [&] {
+                    return m_records.size() < maxQueuedRecords || m_isStopped;
+                });
+
+                if (m_isStopped)
+                {
+                    return;
+                }
+
+                m_records.emplace_back(std::move(record));
+                m_recordCV.notify_all();
+            }
+        }
+    }
+    catch (...)
+    {
+        Fail();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isReadDone = true;
+    m_recordCV.notify_all();
+}
+
+void TrainingDataLoader::DecodeRecords()
+{
+    Judges::Binary::Reader gameReader;
+    std::vector<float> features;
+    std::vector<float> labels;
+
+    try
+    {
+        while (true)
+        {
+            Judges::Binary::GameRecord record;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_recordCV.wait(lock, [this] {
+                    return !m_records.empty() || m_isReadDone || m_isStopped;
+                });
+
+                if (m_records.empty() || m_isStopped)
+                {
+                    break;
+                }
+
+                record = std::move(m_records.front());
+                m_records.pop_front();
+                m_recordCV.notify_all();
+            }
+
+            // Decodes the states without holding the lock
+            features.resize(record.snapshots.size() *
+                            FeatureEncoder::NUM_FEATURES);
+            labels.clear();
+            bool isEncoded = true;
+            gameReader.Parse(
+                record, [&](const Judges::Binary::NeuralNetInputGetter& input,
+                            int label) {
+                    if (!isEncoded ||
+                        !input.Encode(features.data() +
+                                      labels.size() *
+                                          FeatureEncoder::NUM_FEATURES))
+                    {
+                        isEncoded = false;
+                        return;
+                    }
+
+                    labels.emplace_back(static_cast<float>(label));
+                });
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+
+            // The features of a record that can't be encoded are incomplete
+            if (!isEncoded)
+            {
+                ++m_numSkippedRecords;
+                continue;
+            }
+
+            for (std::size_t i = 0; i < labels.size(); ++i)
+            {
+                m_shuffleCV.wait(lock, [this] {
+                    return m_numShuffleStates < m_config.shuffleBufferSize ||
+                           m_isStopped;
+                });
+
+                if (m_isStopped)
+                {
+                    return;
+                }
+
+                std::memcpy(
+                    &m_shuffleFeatures[m_numShuffleStates *
+                                       FeatureEncoder::NUM_FEATURES],
+                    &features[i * FeatureEncoder::NUM_FEATURES],
+                    FeatureEncoder::NUM_FEATURES * sizeof(float));
+                m_shuffleLabels[m_numShuffleStates] = labels[i];
+
+                // The assembler waits for a full buffer
+                if (++m_numShuffleStates == m_config.shuffleBufferSize)
+                {
+                    m_shuffleCV.notify_all();
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        Fail();
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    --m_numActiveWorkers;
+    m_shuffleCV.notify_all();
+}
+
+void TrainingDataLoader::AssembleBatches()
+{
+    RandomGenerator random(m_config.seed);
+    constexpr std::size_t rowSize = FeatureEncoder::NUM_FEATURES;
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (!m_isStopped)
+    {
+        m_batchCV.wait(lock, [this] {
+            return !m_freeBatches.empty() || m_isStopped;
+        });
+        if (m_isStopped)
+        {
+            break;
+        }
+
+        BatchBuffer* batch = m_freeBatches.back();
+        m_freeBatches.pop_back();
+        batch->size = 0;
+
+        while (batch->size < m_config.batchSize)
+        {
+            // NOTE: The states are picked from a full buffer so that the
+            // states of a game are spread over many batches
+            m_shuffleCV.wait(lock, [this] {
+                return m_numShuffleStates == m_config.shuffleBufferSize ||
+                       m_numActiveWorkers == 0 || m_isStopped;
+            });
+
+            if (m_numShuffleStates == 0 || m_isStopped)
+            {
+                break;
+            }
+
+            const std::size_t idx =
+                random.Get<std::size_t>(0, m_numShuffleStates - 1);
+            const std::size_t lastIdx = --m_numShuffleStates;
+
+            std::memcpy(&batch->features[batch->size * rowSize],
+                        &m_shuffleFeatures[idx * rowSize],
+                        rowSize * sizeof(float));
+            batch->labels[batch->size] = m_shuffleLabels[idx];
+            ++batch->size;
+
+            // Fills the hole with the last state
+            std::memcpy(&m_shuffleFeatures[idx * rowSize],
+                        &m_shuffleFeatures[lastIdx * rowSize],
+                        rowSize * sizeof(float));
+            m_shuffleLabels[idx] = m_shuffleLabels[lastIdx];
+
+            m_shuffleCV.notify_all();
+        }
+
+        if (batch->size == 0)
+        {
+            m_freeBatches.emplace_back(batch);
+            break;
+        }
+
+        m_readyBatches.emplace_back(batch);
+        m_batchCV.notify_all();
+    }
+
+    m_isAssembleDone = true;
+    m_batchCV.notify_all();
+}
+
+void TrainingDataLoader::Fail()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (!m_exception)
+    {
+        m_exception = std::current_exception();
+    }
+
+    m_isStopped = true;
+    m_recordCV.notify_all();
+    m_shuffleCV.notify_all();
+    m_batchCV.notify_all();
+}
+}  // namespace RosettaTorch::NeuralNet
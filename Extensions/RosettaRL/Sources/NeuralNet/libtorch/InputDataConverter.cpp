@@ -9,52 +9,76 @@
 
 #include <NeuralNet/libtorch/InputDataConverter.hpp>
 
+#include <algorithm>
+
 namespace RosettaTorch::NeuralNet
 {
 void InputDataConverter::Convert(const IInputGetter* getter,
                                  torch::Tensor& hero, torch::Tensor& minion,
                                  torch::Tensor& standalone)
 {
-    GetInputData(getter, hero, minion, standalone);
+    Convert(std::vector<const IInputGetter*>{ getter }, hero, minion,
+            standalone);
+
+    hero = hero[0];
+    minion = minion[0];
+    standalone = standalone[0];
+}
+
+void InputDataConverter::Convert(
+    const std::vector<const IInputGetter*>& getters, torch::Tensor& hero,
+    torch::Tensor& minion, torch::Tensor& standalone)
+{
+    using RosettaStone::FeatureEncoder;
+
+    // The features are written to the memory of the tensor directly and
+    // the blocks are the views of it
+    const torch::Tensor data = torch::empty(
+        { static_cast<std::int64_t>(getters.size()),
+          static_cast<std::int64_t>(FeatureEncoder::NUM_FEATURES) },
+        torch::kFloat32);
+
+    float* row = data.data_ptr<float>();
+    for (const auto& getter : getters)
+    {
+        GetInputData(getter, row);
+        row += FeatureEncoder::NUM_FEATURES;
+    }
+
+    hero = data.narrow(1, FeatureEncoder::HERO_OFFSET,
+                       FeatureEncoder::HERO_SIZE);
+    minion = data.narrow(1, FeatureEncoder::MINION_OFFSET,
+                         FeatureEncoder::MINION_SIZE);
+    standalone = data.narrow(1, FeatureEncoder::STANDALONE_OFFSET,
+                             FeatureEncoder::STANDALONE_SIZE);
 }
 
 void InputDataConverter::GetInputData(const IInputGetter* getter,
-                                      torch::Tensor& hero,
-                                      torch::Tensor& minion,
-                                      torch::Tensor& standalone) const
+                                      float* data) const
 {
-    std::vector<float> input1;
-    AddHeroData(FieldSide::CURRENT, getter, input1);
-    AddHeroData(FieldSide::OPPONENT, getter, input1);
+    using RosettaStone::FeatureEncoder;
 
-    const torch::Tensor tensor1 = torch::empty(input1.size(), torch::kFloat32);
-    for (std::size_t i = 0; i < input1.size(); ++i)
+    if (getter->Encode(data))
     {
-        tensor1[i] = input1[i];
+        return;
     }
 
+    std::vector<float> input1;
+    AddHeroData(FieldSide::CURRENT, getter, input1);
+    AddHeroData(FieldSide::OPPONENT, getter, input1);
+    std::copy(input1.begin(), input1.end(),
+              data + FeatureEncoder::HERO_OFFSET);
+
     std::vector<float> input2;
     AddMinionsData(FieldSide::CURRENT, getter, input2);
     AddMinionsData(FieldSide::OPPONENT, getter, input2);
-
-    const torch::Tensor tensor2 = torch::empty(input2.size(), torch::kFloat32);
-    for (std::size_t i = 0; i < input2.size(); ++i)
-    {
-        tensor2[i] = input2[i];
-    }
+    std::copy(input2.begin(), input2.end(),
+              data + FeatureEncoder::MINION_OFFSET);
 
     std::vector<float> input3;
     AddStandaloneData(getter, input3);
-
-    const torch::Tensor tensor3 = torch::empty(input3.size(), torch::kFloat32);
-    for (std::size_t i = 0; i < input3.size(); ++i)
-    {
-        tensor3[i] = input3[i];
-    }
-
-    hero = tensor1;
-    minion = tensor2;
-    standalone = tensor3;
+    std::copy(input3.begin(), input3.end(),
+              data + FeatureEncoder::STANDALONE_OFFSET);
 }
 
 void InputDataConverter::AddHeroData(FieldSide side, const IInputGetter* getter,
@@ -11,19 +11,48 @@
 #include <NeuralNet/libtorch/NeuralNetworkImpl.hpp>
 
 #include <Rosetta/Commons/Macros.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
+#include <Rosetta/Views/FeatureEncoder.hpp>
 
 #include <torch/torch.h>
-#include <effolkronium/random.hpp>
+
+#include <array>
 
 #if !defined(ROSETTASTONE_WINDOWS)
 #include <stdlib.h>
 #include <unistd.h>
 #endif
 
-using Random = effolkronium::random_static;
+using RosettaStone::FeatureEncoder;
+using RosettaStone::RandomGenerator;
 
 namespace RosettaTorch::NeuralNet
 {
+namespace
+{
+//! Returns the tensors of \p batch. The tensors are the views of the memory
+//! of the batch, so they are valid until the next batch is loaded.
+std::array<torch::Tensor, 4> GetBatchTensors(const TrainingBatch& batch)
+{
+    const auto size = static_cast<std::int64_t>(batch.size);
+
+    const torch::Tensor features = torch::from_blob(
+        const_cast<float*>(batch.features),
+        { size, static_cast<std::int64_t>(FeatureEncoder::NUM_FEATURES) },
+        torch::kFloat32);
+    const torch::Tensor labels = torch::from_blob(
+        const_cast<float*>(batch.labels), { size, 1 }, torch::kFloat32);
+
+    return { features.narrow(1, FeatureEncoder::HERO_OFFSET,
+                             FeatureEncoder::HERO_SIZE),
+             features.narrow(1, FeatureEncoder::MINION_OFFSET,
+                             FeatureEncoder::MINION_SIZE),
+             features.narrow(1, FeatureEncoder::STANDALONE_OFFSET,
+                             FeatureEncoder::STANDALONE_SIZE),
+             labels };
+}
+}  // namespace
+
 void NeuralNetworkImpl::CreateWithRandomWeights(const std::string& fileName)
 {
 }
@@ -126,6 +155,33 @@ void NeuralNetworkImpl::Train(const NeuralNetworkInputImpl& input,
     }
 }
 
+void NeuralNetworkImpl::Train(TrainingDataLoader& loader)
+{
+    torch::optim::Adam optimizer(m_net->parameters(),
+                                 torch::optim::AdamOptions(lr));
+
+    TrainingBatch batch;
+    while (loader.Next(batch))
+    {
+        const auto [hero, minion, standalone, label] = GetBatchTensors(batch);
+
+        // Resets gradients
+        optimizer.zero_grad();
+
+        // Executes the model
+        auto prediction = m_net->forward(hero, minion, standalone);
+
+        // Computes a loss value to judge the prediction of our model
+        auto loss = torch::mse_loss(prediction, label);
+
+        // Do back-propagation
+        loss.backward();
+
+        // Updates the parameters
+        optimizer.step();
+    }
+}
+
 std::pair<uint64_t, uint64_t> NeuralNetworkImpl::Verify(
     const NeuralNetworkInputImpl& input, const NeuralNetworkOutputImpl& output)
 {
@@ -151,6 +207,29 @@ std::pair<uint64_t, uint64_t> NeuralNetworkImpl::Verify(
     return { correct, total };
 }
 
+std::pair<uint64_t, uint64_t> NeuralNetworkImpl::Verify(
+    TrainingDataLoader& loader)
+{
+    std::uint64_t correct = 0, total = 0;
+
+    torch::NoGradGuard noGrad;
+
+    TrainingBatch batch;
+    while (loader.Next(batch))
+    {
+        const auto [hero, minion, standalone, label] = GetBatchTensors(batch);
+
+        const auto predictWin = m_net->forward(hero, minion, standalone) > 0.0;
+        const auto actualWin = label > 0.0;
+
+        correct += static_cast<std::uint64_t>(
+            (predictWin == actualWin).sum().item<std::int64_t>());
+        total += batch.size;
+    }
+
+    return { correct, total };
+}
+
 double NeuralNetworkImpl::Predict(IInputGetter* input)
 {
     torch::Tensor hero, minion, standalone;
@@ -164,11 +243,40 @@ double NeuralNetworkImpl::Predict(const torch::Tensor& hero,
 {
     if (m_isRandom)
     {
-        return Random::get<double>(-1.0, 1.0);
+        return RandomGenerator::GetThreadLocal().Get<double>(-1.0, 1.0);
     }
 
     const auto prediction = m_net->forward(
         hero.unsqueeze(0), minion.unsqueeze(0), standalone.unsqueeze(0));
     return prediction[0][0].item<double>();
 }
+
+void NeuralNetworkImpl::Predict(const std::vector<const IInputGetter*>& inputs,
+                                std::vector<double>& results)
+{
+    results.resize(inputs.size());
+
+    if (m_isRandom)
+    {
+        for (auto& result : results)
+        {
+            result = RandomGenerator::GetThreadLocal().Get<double>(-1.0, 1.0);
+        }
+
+        return;
+    }
+
+    torch::Tensor hero, minion, standalone;
+    InputDataConverter().Convert(inputs, hero, minion, standalone);
+
+    torch::NoGradGuard noGrad;
+    const auto prediction =
+        m_net->forward(hero, minion, standalone).to(torch::kFloat64);
+    const auto accessor = prediction.accessor<double, 2>();
+
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        results[i] = accessor[static_cast<std::int64_t>(i)][0];
+    }
+}
 }  // namespace RosettaTorch::NeuralNet
\ No newline at end of file
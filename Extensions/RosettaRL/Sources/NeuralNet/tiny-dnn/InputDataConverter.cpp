@@ -9,6 +9,10 @@
 
 #include <NeuralNet/tiny-dnn/InputDataConverter.hpp>
 
+#include <Rosetta/Views/FeatureEncoder.hpp>
+
+#include <array>
+
 namespace RosettaTorch::NeuralNet
 {
 void InputDataConverter::Convert(const IInputGetter* getter,
@@ -20,6 +24,23 @@ void InputDataConverter::Convert(const IInputGetter* getter,
 void InputDataConverter::GetInputData(const IInputGetter* getter,
                                       tiny_dnn::tensor_t& data) const
 {
+    using RosettaStone::FeatureEncoder;
+
+    std::array<float, FeatureEncoder::NUM_FEATURES> features{};
+    if (getter->Encode(features.data()))
+    {
+        const auto AddBlock = [&](std::size_t offset, std::size_t size) {
+            data.emplace_back(features.begin() + offset,
+                              features.begin() + offset + size);
+        };
+
+        AddBlock(FeatureEncoder::HERO_OFFSET, FeatureEncoder::HERO_SIZE);
+        AddBlock(FeatureEncoder::MINION_OFFSET, FeatureEncoder::MINION_SIZE);
+        AddBlock(FeatureEncoder::STANDALONE_OFFSET,
+                 FeatureEncoder::STANDALONE_SIZE);
+        return;
+    }
+
     tiny_dnn::vec_t input1;
     AddHeroData(FieldSide::CURRENT, getter, input1);
     AddHeroData(FieldSide::OPPONENT, getter, input1);
@@ -11,18 +11,47 @@
 #include <NeuralNet/tiny-dnn/NeuralNetworkImpl.hpp>
 
 #include <Rosetta/Commons/Macros.hpp>
-
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
+#include <Rosetta/Views/FeatureEncoder.hpp>
 
 #if !defined(ROSETTASTONE_WINDOWS)
 #include <stdlib.h>
 #include <unistd.h>
 #endif
 
-using Random = effolkronium::random_static;
+using RosettaStone::FeatureEncoder;
+using RosettaStone::RandomGenerator;
 
 namespace RosettaTorch::NeuralNet
 {
+namespace
+{
+//! Converts the states of \p batch to the inputs and the outputs.
+void GetBatchData(const TrainingBatch& batch,
+                  std::vector<tiny_dnn::tensor_t>& inputs,
+                  std::vector<tiny_dnn::vec_t>& outputs)
+{
+    inputs.resize(batch.size);
+    outputs.resize(batch.size);
+
+    for (std::size_t i = 0; i < batch.size; ++i)
+    {
+        const float* row = batch.features + i * FeatureEncoder::NUM_FEATURES;
+        const auto AddBlock = [&](std::size_t offset, std::size_t size) {
+            inputs[i].emplace_back(row + offset, row + offset + size);
+        };
+
+        inputs[i].clear();
+        AddBlock(FeatureEncoder::HERO_OFFSET, FeatureEncoder::HERO_SIZE);
+        AddBlock(FeatureEncoder::MINION_OFFSET, FeatureEncoder::MINION_SIZE);
+        AddBlock(FeatureEncoder::STANDALONE_OFFSET,
+                 FeatureEncoder::STANDALONE_SIZE);
+
+        outputs[i] = { batch.labels[i] };
+    }
+}
+}  // namespace
+
 void NeuralNetworkImpl::CreateWithRandomWeights(const std::string& fileName)
 {
     constexpr static int HERO_IN_DIM = 1;
@@ -143,6 +172,20 @@ void NeuralNetworkImpl::Train(const NeuralNetworkInputImpl& input,
         []() {});
 }
 
+void NeuralNetworkImpl::Train(TrainingDataLoader& loader)
+{
+    tiny_dnn::adam opt;
+    std::vector<tiny_dnn::tensor_t> inputs;
+    std::vector<tiny_dnn::vec_t> outputs;
+
+    TrainingBatch batch;
+    while (loader.Next(batch))
+    {
+        GetBatchData(batch, inputs, outputs);
+        m_net.fit<tiny_dnn::mse>(opt, inputs, outputs, batch.size, 1);
+    }
+}
+
 std::pair<uint64_t, uint64_t> NeuralNetworkImpl::Verify(
     const NeuralNetworkInputImpl& input, const NeuralNetworkOutputImpl& output)
 {
@@ -166,6 +209,36 @@ std::pair<uint64_t, uint64_t> NeuralNetworkImpl::Verify(
     return { correct, total };
 }
 
+std::pair<uint64_t, uint64_t> NeuralNetworkImpl::Verify(
+    TrainingDataLoader& loader)
+{
+    std::uint64_t correct = 0, total = 0;
+    std::vector<tiny_dnn::tensor_t> inputs;
+    std::vector<tiny_dnn::vec_t> outputs;
+
+    TrainingBatch batch;
+    while (loader.Next(batch))
+    {
+        GetBatchData(batch, inputs, outputs);
+        const auto predictions = m_net.predict(inputs);
+
+        for (std::size_t i = 0; i < batch.size; ++i)
+        {
+            const bool predictWin = predictions[i][0][0] > 0.0;
+            const bool actualWin = batch.labels[i] > 0.0;
+
+            if (predictWin == actualWin)
+            {
+                ++correct;
+            }
+        }
+
+        total += batch.size;
+    }
+
+    return { correct, total };
+}
+
 double NeuralNetworkImpl::Predict(IInputGetter* input)
 {
     tiny_dnn::tensor_t data;
@@ -177,7 +250,7 @@ double NeuralNetworkImpl::Predict(const tiny_dnn::tensor_t& data)
 {
     if (m_isRandom)
     {
-        return Random::get<double>(-1.0, 1.0);
+        return RandomGenerator::GetThreadLocal().Get<double>(-1.0, 1.0);
     }
 
     return m_net.predict(data)[0][0];
@@ -195,4 +268,32 @@ void NeuralNetworkImpl::Predict(const NeuralNetworkInputImpl* input,
         results.push_back(Predict(inputData[0]));
     }
 }
+
+void NeuralNetworkImpl::Predict(const std::vector<const IInputGetter*>& inputs,
+                                std::vector<double>& results)
+{
+    results.resize(inputs.size());
+
+    if (m_isRandom)
+    {
+        for (auto& result : results)
+        {
+            result = RandomGenerator::GetThreadLocal().Get<double>(-1.0, 1.0);
+        }
+
+        return;
+    }
+
+    std::vector<tiny_dnn::tensor_t> batch(inputs.size());
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        InputDataConverter().Convert(inputs[i], batch[i]);
+    }
+
+    const auto predictions = m_net.predict(batch);
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        results[i] = predictions[i][0][0];
+    }
+}
 }  // namespace RosettaTorch::NeuralNet
\ No newline at end of file
@@ -0,0 +1,149 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <MCTS/Selection/TreeUpdater.hpp>
+
+#include <Rosetta/Commons/RandomGenerator.hpp>
+
+#include <cstdlib>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+using namespace RosettaTorch;
+using RosettaStone::RandomGenerator;
+
+//! The shape of a transposition-rich tree. Each node of a layer is reached
+//! from FAN_IN nodes of the previous layer, so the number of paths from a
+//! leaf to the root grows by FAN_IN per layer.
+constexpr int DEPTH = 40;
+constexpr int WIDTH = 16;
+constexpr int FAN_IN = 4;
+constexpr int NUM_UPDATES = 100000;
+
+struct DAG
+{
+    std::vector<std::vector<std::unique_ptr<MCTS::TreeNode>>> layers;
+    std::vector<std::unique_ptr<MCTS::EdgeAddon>> edges;
+
+    //! The edges from the leaves. An update starts from one of them.
+    std::vector<MCTS::TraversedNodeInfo> leafPaths;
+};
+
+static void BuildDAG(DAG& dag, RandomGenerator& random)
+{
+    dag.layers.resize(DEPTH);
+    dag.layers[0].emplace_back(std::make_unique<MCTS::TreeNode>());
+
+    for (int depth = 1; depth < DEPTH; ++depth)
+    {
+        auto& prevLayer = dag.layers[depth - 1];
+        auto& layer = dag.layers[depth];
+
+        for (int i = 0; i < WIDTH; ++i)
+        {
+            layer.emplace_back(std::make_unique<MCTS::TreeNode>());
+
+            // NOTE: The same leading node can be picked again, then it is
+            // deduplicated by LeadingNodes
+            for (int j = 0; j < FAN_IN; ++j)
+            {
+                const auto idx = random.Get<std::size_t>(
+                    0, prevLayer.size() - 1);
+                dag.edges.emplace_back(std::make_unique<MCTS::EdgeAddon>());
+                layer.back()->addon.leadingNodes.AddLeadingNodes(
+                    prevLayer[idx].get(), dag.edges.back().get());
+            }
+        }
+    }
+
+    for (auto& leaf : dag.layers.back())
+    {
+        dag.edges.emplace_back(std::make_unique<MCTS::EdgeAddon>());
+        dag.leafPaths.emplace_back(leaf.get(), dag.edges.back().get(), 0);
+    }
+}
+
+//! Returns the number of paths from a leaf to the root, that is the number of
+//! credits that a backup without deduplication adds.
+static double CountPaths(const MCTS::TreeNode* leaf)
+{
+    std::vector<const MCTS::TreeNode*> nodes{ leaf };
+    std::vector<double> paths{ 1.0 };
+    double total = 0.0;
+
+    for (int depth = DEPTH - 1; depth > 0; --depth)
+    {
+        std::vector<const MCTS::TreeNode*> nextNodes;
+        std::vector<double> nextPaths;
+
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            nodes[i]->addon.leadingNodes.ForEachLeadingNode(
+                [&](MCTS::TreeNode* node, MCTS::EdgeAddon*) {
+                    total += paths[i];
+
+                    std::size_t idx = 0;
+                    while (idx < nextNodes.size() && nextNodes[idx] != node)
+                    {
+                        ++idx;
+                    }
+
+                    if (idx == nextNodes.size())
+                    {
+                        nextNodes.emplace_back(node);
+                        nextPaths.emplace_back(0.0);
+                    }
+
+                    nextPaths[idx] += paths[i];
+                    return true;
+                });
+        }
+
+        nodes = std::move(nextNodes);
+        paths = std::move(nextPaths);
+    }
+
+    return total;
+}
+
+int main()
+{
+    RandomGenerator random(0);
+
+    DAG dag;
+    BuildDAG(dag, random);
+
+    std::cout << "Nodes: " << DEPTH * WIDTH << ", edges: " << dag.edges.size()
+              << std::endl;
+    std::cout << "Paths from a leaf without deduplication: "
+              << CountPaths(dag.leafPaths.front().node) << std::endl;
+
+    MCTS::TreeUpdater updater;
+    std::vector<MCTS::TraversedNodeInfo> nodes;
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int i = 0; i < NUM_UPDATES; ++i)
+    {
+        const auto idx =
+            random.Get<std::size_t>(0, dag.leafPaths.size() - 1);
+        nodes.assign(1, dag.leafPaths[idx]);
+        updater.Update(nodes, (i % 2 == 0) ? 1.0f : 0.0f);
+    }
+
+    const auto now = std::chrono::steady_clock::now();
+    const auto us =
+        std::chrono::duration_cast<std::chrono::microseconds>(now - start)
+            .count();
+
+    std::cout << "Updates: " << NUM_UPDATES << std::endl;
+    std::cout << "Microseconds per update: "
+              << static_cast<double>(us) / NUM_UPDATES << std::endl;
+
+    return EXIT_SUCCESS;
+}
@@ -83,8 +83,8 @@ void Run(const Agents::MCTSConfig& config, Agents::MCTSRunner* controller,
 
     for (size_t j = 0; j < deck.size(); ++j)
     {
-        gameConfig.player1Deck[j] = *Cards::FindCardByID(deck[j]);
-        gameConfig.player2Deck[j] = *Cards::FindCardByID(deck[j]);
+        gameConfig.player1Deck[j] = Cards::FindCardByID(deck[j]);
+        gameConfig.player2Deck[j] = Cards::FindCardByID(deck[j]);
     }
 
     Game game(gameConfig);
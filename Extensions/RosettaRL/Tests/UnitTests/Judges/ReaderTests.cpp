@@ -0,0 +1,36 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Judges/Binary/Reader.hpp>
+
+#include <Rosetta/Views/FeatureEncoder.hpp>
+
+#include <vector>
+
+using namespace RosettaTorch::Judges::Binary;
+using RosettaStone::FeatureEncoder;
+
+TEST_CASE("[NeuralNetInputGetter] - Encode")
+{
+    std::vector<float> features(FeatureEncoder::NUM_FEATURES);
+
+    StateSnapshot snapshot{};
+    snapshot.current.numMinions = 1;
+    snapshot.current.minions[0].attack = 2;
+    snapshot.current.minions[0].health = 3;
+    snapshot.current.numHandCards = 1;
+    CHECK(NeuralNetInputGetter(snapshot).Encode(features.data()));
+
+    // The counts that are out of range aren't read
+    snapshot.current.numHandCards = RosettaStone::MAX_HAND_SIZE + 1;
+    CHECK_FALSE(NeuralNetInputGetter(snapshot).Encode(features.data()));
+
+    snapshot.current.numHandCards = 1;
+    snapshot.opponent.numMinions = RosettaStone::MAX_FIELD_SIZE + 1;
+    CHECK_FALSE(NeuralNetInputGetter(snapshot).Encode(features.data()));
+}
@@ -0,0 +1,163 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Judges/Binary/RecordFile.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+
+using namespace RosettaTorch::Judges::Binary;
+
+namespace
+{
+GameRecord MakeRecord(int value)
+{
+    GameRecord record;
+
+    Entry entry{};
+    entry.type = EntryType::MAIN_ACTION;
+    entry.value = value;
+    entry.choice = 1;
+    entry.numChoices = 2;
+    record.entries.emplace_back(entry);
+    record.choices = { 3, value };
+
+    StateSnapshot snapshot{};
+    snapshot.entryIdx = 0;
+    snapshot.current.numMinions = 1;
+    snapshot.current.minions[0].attack = 2;
+    snapshot.current.minions[0].health = 3;
+    record.snapshots.emplace_back(snapshot);
+
+    record.result = GameResult::PLAYER1_WIN;
+
+    return record;
+}
+
+std::string ReadFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file),
+                       std::istreambuf_iterator<char>());
+}
+
+void WriteFile(const std::string& path, const std::string& data)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+std::vector<int> ReadValues(RecordReader& reader)
+{
+    std::vector<int> values;
+
+    GameRecord record;
+    while (reader.Next(record))
+    {
+        values.emplace_back(record.entries[0].value);
+    }
+
+    return values;
+}
+
+void RemoveShards(const std::string& prefix)
+{
+    for (const std::string& path : RecordReader::FindShards(".", prefix))
+    {
+        std::remove(path.c_str());
+    }
+}
+}  // namespace
+
+TEST_CASE("[GameRecord] - Serialize")
+{
+    const GameRecord record = MakeRecord(7);
+
+    std::string data;
+    record.Serialize(data);
+
+    GameRecord result;
+    CHECK(result.Deserialize(data.data(), data.size()));
+    CHECK_EQ(result.entries.size(), 1u);
+    CHECK(result.entries[0].type == EntryType::MAIN_ACTION);
+    CHECK_EQ(result.entries[0].value, 7);
+    CHECK_EQ(result.entries[0].choice, 1);
+    CHECK_EQ(result.entries[0].numChoices, 2u);
+    CHECK_EQ(result.choices, (std::vector<std::int32_t>{ 3, 7 }));
+    CHECK_EQ(result.snapshots.size(), 1u);
+    CHECK_EQ(result.snapshots[0].current.numMinions, 1);
+    CHECK_EQ(result.snapshots[0].current.minions[0].attack, 2);
+    CHECK_EQ(result.snapshots[0].current.minions[0].health, 3);
+    CHECK(result.result == GameResult::PLAYER1_WIN);
+
+    // A truncated record is rejected
+    CHECK_FALSE(result.Deserialize(data.data(), data.size() - 1));
+    CHECK(result.entries.empty());
+
+    // A snapshot that refers to a missing entry is rejected
+    GameRecord invalid = MakeRecord(7);
+    invalid.snapshots[0].entryIdx = 1;
+    data.clear();
+    invalid.Serialize(data);
+    CHECK_FALSE(result.Deserialize(data.data(), data.size()));
+}
+
+TEST_CASE("[RecordWriter] - ExistingShard")
+{
+    const std::string prefix = "RecordWriterTests";
+    RemoveShards(prefix);
+
+    const std::string path0 = RecordWriter::GetShardPath(".", prefix, 0);
+    WriteFile(path0, "Owned by another writer");
+
+    {
+        RecordWriter writer(".", prefix);
+        writer.Write(MakeRecord(1));
+    }
+
+    // The writer takes the next index and keeps the existing shard
+    CHECK_EQ(ReadFile(path0), "Owned by another writer");
+
+    RecordReader reader(RecordReader::FindShards(".", prefix));
+    CHECK_EQ(ReadValues(reader), std::vector<int>{ 1 });
+
+    RemoveShards(prefix);
+}
+
+TEST_CASE("[RecordReader] - InvalidFrame")
+{
+    const std::string prefix = "RecordReaderTests";
+    RemoveShards(prefix);
+
+    // Each record goes to its own shard
+    {
+        RecordWriter writer(".", prefix, 1);
+        for (int value = 0; value < 4; ++value)
+        {
+            writer.Write(MakeRecord(value));
+        }
+    }
+
+    const std::vector<std::string> paths =
+        RecordReader::FindShards(".", prefix);
+    CHECK_EQ(paths.size(), 4u);
+
+    // A corrupted record and a truncated record end their shards
+    std::string data = ReadFile(paths[1]);
+    data[data.size() / 2] ^= 0x5A;
+    WriteFile(paths[1], data);
+
+    data = ReadFile(paths[2]);
+    WriteFile(paths[2], data.substr(0, data.size() - 1));
+
+    RecordReader reader(paths);
+    CHECK_EQ(ReadValues(reader), (std::vector<int>{ 0, 3 }));
+
+    RemoveShards(prefix);
+}
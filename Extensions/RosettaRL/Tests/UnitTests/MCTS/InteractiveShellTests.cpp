@@ -0,0 +1,63 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <MCTS/Inspector/InteractiveShell.hpp>
+#include <MCTS/Selection/TreeSnapshot.hpp>
+
+#include <cstdio>
+#include <sstream>
+
+using namespace RosettaTorch::MCTS;
+
+namespace
+{
+std::string DoCommand(InteractiveShell& shell, const std::string& command)
+{
+    std::istringstream is(command);
+    std::ostringstream os;
+    shell.DoCommand(is, os);
+
+    return os.str();
+}
+}  // namespace
+
+TEST_CASE("[InteractiveShell] - LoadedTree")
+{
+    const std::string path = "InteractiveShellTests.rsmt";
+
+    TreeNode tree;
+    auto [created1, edge1, child1] =
+        tree.children.GetOrCreateNewNode(0, std::make_unique<TreeNode>());
+    edge1->Set(3, 100, 300);
+    auto [created2, edge2, child2] =
+        tree.children.GetOrCreateNewNode(1, std::make_unique<TreeNode>());
+    edge2->Set(7, 500, 700);
+    auto [created3, edge3, child3] =
+        child2->children.GetOrCreateNewNode(2, std::make_unique<TreeNode>());
+    edge3->Set(5, 400, 500);
+    TreeSnapshot::Save(path, tree);
+
+    // The shell inspects a loaded tree without a controller
+    InteractiveShell shell;
+    CHECK_NE(DoCommand(shell, "root 1").find("no controller"),
+             std::string::npos);
+    CHECK_NE(DoCommand(shell, "load " + path).find("with 4 nodes"),
+             std::string::npos);
+    CHECK_NE(DoCommand(shell, "root 1").find("#0 of the loaded tree"),
+             std::string::npos);
+
+    const std::string best = DoCommand(shell, "best");
+    CHECK_NE(best.find("Choice 1: 70% (7/10)"), std::string::npos);
+    CHECK_NE(best.find("   Choice 2: 100% (5/5)"), std::string::npos);
+    CHECK_EQ(best.find("Choice 0"), std::string::npos);
+
+    CHECK_NE(DoCommand(shell, "best -v").find("Choice 0: 30% (3/10)"),
+             std::string::npos);
+
+    std::remove(path.c_str());
+}
@@ -0,0 +1,101 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Agents/MCTSRunner.hpp>
+#include <MCTS/Selection/NodeBudget.hpp>
+
+#include <Rosetta/Games/Game.hpp>
+
+#include <chrono>
+
+using namespace RosettaStone;
+using namespace RosettaTorch;
+
+namespace
+{
+std::size_t GetNumSearchedChoices(const MCTS::TreeNode* node)
+{
+    std::size_t numChoices = 0;
+    node->children.ForEach([&](int, const MCTS::EdgeAddon* edgeAddon,
+                               const MCTS::TreeNode*) {
+        if (edgeAddon->GetChosenTimes() > 0)
+        {
+            ++numChoices;
+        }
+        return true;
+    });
+
+    return numChoices;
+}
+}  // namespace
+
+TEST_CASE("[NodeBudget] - IsFull")
+{
+    MCTS::NodeBudget budget(3);
+    CHECK_EQ(budget.GetMaxNodes(), 3u);
+    CHECK_EQ(budget.GetNumNodes(), 0u);
+    CHECK_FALSE(budget.IsFull());
+
+    budget.AddNode();
+    budget.AddNode();
+    CHECK_FALSE(budget.IsFull());
+
+    budget.AddNode();
+    CHECK_EQ(budget.GetNumNodes(), 3u);
+    CHECK(budget.IsFull());
+
+    // Pruning sets the number of nodes that are left
+    budget.SetNumNodes(1);
+    CHECK_EQ(budget.GetNumNodes(), 1u);
+    CHECK_FALSE(budget.IsFull());
+}
+
+TEST_CASE("[NodeBudget] - TwoRunners")
+{
+    constexpr std::size_t MAX_TREE_NODES = 50;
+
+    Agents::MCTSConfig config;
+    config.threads = 1;
+    config.iterationsPerAction = 300;
+    config.reuseTree = true;
+    config.mcts.neuralNetPath = "";
+    config.mcts.isNeuralNetRandom = true;
+    config.mcts.maxTreeNodes = MAX_TREE_NODES;
+
+    GameConfig gameConfig;
+    gameConfig.player1Class = CardClass::MAGE;
+    gameConfig.player2Class = CardClass::WARRIOR;
+    gameConfig.startPlayer = PlayerType::PLAYER1;
+    gameConfig.doFillDecks = true;
+    gameConfig.skipMulligan = true;
+    gameConfig.autoRun = true;
+
+    Game game(gameConfig);
+    game.Start();
+
+    const BoardRefView view(game, game.GetCurrentPlayer()->playerType);
+    const std::size_t numNodes = MCTS::TreeNode::GetNumNodes();
+
+    // Both runners get the same config, as the agents of a game do
+    Agents::MCTSRunner runner1(config);
+    Agents::MCTSRunner runner2(config);
+
+    // The first runner uses up its budget before the second one starts
+    for (Agents::MCTSRunner* runner : { &runner1, &runner2 })
+    {
+        runner->Run(view);
+        CHECK(runner->WaitForIterations(std::chrono::seconds(60)));
+        runner->WaitUntilStopped();
+    }
+
+    CHECK(GetNumSearchedChoices(runner1.GetRootNode(view.GetSide())) > 0);
+    CHECK(GetNumSearchedChoices(runner2.GetRootNode(view.GetSide())) > 0);
+
+    // Each runner stays in its own budget
+    CHECK(MCTS::TreeNode::GetNumNodes() - numNodes <= 2 * MAX_TREE_NODES);
+}
@@ -0,0 +1,195 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Agents/MCTSRunner.hpp>
+#include <MCTS/Commons/Constants.hpp>
+#include <MCTS/Selection/TreeSnapshot.hpp>
+
+#include <Rosetta/Games/Game.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+
+using namespace RosettaStone;
+using namespace RosettaTorch;
+using namespace RosettaTorch::MCTS;
+
+namespace
+{
+const std::string PATH = "TreeSnapshotTests.rsmt";
+
+std::string ReadFile(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file),
+                       std::istreambuf_iterator<char>());
+}
+
+void WriteFile(const std::string& path, const std::string& data)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+//! Saves a tree whose root has a child, a redirect edge and a board.
+void SaveTree()
+{
+    TreeNode tree;
+
+    auto [created1, edge1, child] =
+        tree.children.GetOrCreateNewNode(0, std::make_unique<TreeNode>());
+    edge1->Set(10, 700, 1000);
+
+    auto [created2, edge2, grandChild] =
+        child->children.GetOrCreateNewNode(3, std::make_unique<TreeNode>());
+    edge2->Set(4, 100, 400);
+
+    auto [created3, edge3, redirectChild] =
+        tree.children.GetOrCreateRedirectNode(1);
+    edge3->Set(6, 250, 600);
+
+    tree.addon.boardNodeMap.GetOrCreateNode(42);
+
+    CHECK(created1);
+    CHECK(created2);
+    CHECK(created3);
+    CHECK(grandChild != nullptr);
+    CHECK(redirectChild == nullptr);
+
+    TreeSnapshot::Save(PATH, tree, child, &tree.addon.boardNodeMap, 0x1234);
+}
+}  // namespace
+
+TEST_CASE("[TreeSnapshot] - Restore")
+{
+    SaveTree();
+
+    const TreeSnapshot snapshot(PATH);
+    CHECK_EQ(snapshot.GetNumNodes(), 4u);
+    CHECK_EQ(snapshot.GetBoardHash(), 0x1234u);
+
+    // The edges of the root are read from the mapped file
+    int numEdges = 0;
+    snapshot.ForEachEdge(
+        snapshot.GetRootIndex(), [&](const TreeSnapshot::Edge& edge) {
+            CHECK_EQ(edge.choice, 3);
+            CHECK_EQ(edge.chosenTimes, 4);
+            CHECK_EQ(edge.credit, 100);
+            CHECK_EQ(edge.total, 400);
+            CHECK(edge.child != TreeSnapshot::NO_NODE);
+            ++numEdges;
+            return true;
+        });
+    CHECK_EQ(numEdges, 1);
+
+    TreeNode* root = nullptr;
+    BoardNodeMap* redirectNodeMap = nullptr;
+    const auto tree = snapshot.Restore(&root, &redirectNodeMap);
+
+    const auto [edge1, child] = tree->children.Get(0);
+    CHECK_EQ(edge1->GetChosenTimes(), 10);
+    CHECK_EQ(edge1->GetCredit(), 700);
+    CHECK_EQ(edge1->GetTotal(), 1000);
+    CHECK_EQ(root, child);
+
+    const auto [edge2, grandChild] = child->children.Get(3);
+    CHECK_EQ(edge2->GetChosenTimes(), 4);
+    CHECK_EQ(edge2->GetCredit(), 100);
+    CHECK_EQ(edge2->GetTotal(), 400);
+    CHECK(grandChild != nullptr);
+
+    const auto [edge3, redirectChild] = tree->children.Get(1);
+    CHECK_EQ(edge3->GetChosenTimes(), 6);
+    CHECK_EQ(edge3->GetCredit(), 250);
+    CHECK_EQ(edge3->GetTotal(), 600);
+    CHECK(redirectChild == nullptr);
+
+    CHECK_EQ(redirectNodeMap, &tree->addon.boardNodeMap);
+    CHECK(redirectNodeMap->Find(42) != nullptr);
+
+    std::remove(PATH.c_str());
+}
+
+TEST_CASE("[TreeSnapshot] - InvalidFile")
+{
+    SaveTree();
+    const std::string data = ReadFile(PATH);
+
+    // The size of the tables doesn't match the header
+    WriteFile(PATH, data.substr(0, data.size() - 1));
+    CHECK_THROWS_AS(TreeSnapshot snapshot(PATH), std::runtime_error);
+
+    // The version of the format follows the magic
+    std::string invalid = data;
+    const std::uint32_t version = TreeSnapshot::VERSION + 1;
+    std::memcpy(&invalid[4], &version, sizeof(version));
+    WriteFile(PATH, invalid);
+    CHECK_THROWS_AS(TreeSnapshot snapshot(PATH), std::runtime_error);
+
+    // The version of the action encoding follows the version of the format
+    invalid = data;
+    const std::uint32_t encodingVersion = ACTION_ENCODING_VERSION + 1;
+    std::memcpy(&invalid[8], &encodingVersion, sizeof(encodingVersion));
+    WriteFile(PATH, invalid);
+    CHECK_THROWS_AS(TreeSnapshot snapshot(PATH), std::runtime_error);
+
+    // The file is valid without the changes
+    WriteFile(PATH, data);
+    CHECK_NOTHROW(TreeSnapshot snapshot(PATH));
+
+    std::remove(PATH.c_str());
+}
+
+TEST_CASE("[TreeSnapshot] - SaveRunnerTree")
+{
+    Agents::MCTSConfig config;
+    config.threads = 1;
+    config.iterationsPerAction = 100;
+    config.mcts.neuralNetPath = "";
+    config.mcts.isNeuralNetRandom = true;
+
+    Agents::MCTSRunner runner(config);
+    std::uint64_t boardHash = 0;
+    PlayerType side = PlayerType::INVALID;
+
+    {
+        GameConfig gameConfig;
+        gameConfig.player1Class = CardClass::MAGE;
+        gameConfig.player2Class = CardClass::WARRIOR;
+        gameConfig.startPlayer = PlayerType::PLAYER1;
+        gameConfig.doFillDecks = true;
+        gameConfig.skipMulligan = true;
+        gameConfig.autoRun = true;
+
+        Game game(gameConfig);
+        game.Start();
+
+        const BoardRefView view(game, game.GetCurrentPlayer()->playerType);
+        boardHash = view.GetHash();
+        side = view.GetSide();
+
+        runner.Run(view);
+        CHECK(runner.WaitForIterations(std::chrono::seconds(60)));
+        runner.WaitUntilStopped();
+    }
+
+    // The board of the last search is saved after its game is gone
+    runner.SaveTree(side, PATH);
+    CHECK_EQ(TreeSnapshot(PATH).GetBoardHash(), boardHash);
+
+    runner.SaveTree(side == PlayerType::PLAYER1 ? PlayerType::PLAYER2
+                                                : PlayerType::PLAYER1,
+                    PATH);
+    CHECK_EQ(TreeSnapshot(PATH).GetBoardHash(), 0u);
+
+    std::remove(PATH.c_str());
+}
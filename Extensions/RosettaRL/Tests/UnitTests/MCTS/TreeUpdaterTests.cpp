@@ -0,0 +1,174 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <MCTS/Selection/TreeUpdater.hpp>
+
+#include <memory>
+#include <vector>
+
+using namespace RosettaTorch;
+
+namespace
+{
+struct DAG
+{
+    //! Adds a node that is reached from \p leadingNodes.
+    //! \param leadingNodes The indices of the leading nodes.
+    //! \param edgeIdx The index of the edge from the leading nodes, or -1 to
+    //! add an edge for each leading node.
+    //! \return The index of the node.
+    std::size_t AddNode(const std::vector<std::size_t>& leadingNodes,
+                        int edgeIdx = -1)
+    {
+        nodes.emplace_back(std::make_unique<MCTS::TreeNode>());
+        for (const std::size_t idx : leadingNodes)
+        {
+            if (edgeIdx < 0)
+            {
+                edges.emplace_back(std::make_unique<MCTS::EdgeAddon>());
+            }
+
+            MCTS::EdgeAddon* edge =
+                edges[edgeIdx < 0 ? edges.size() - 1 : edgeIdx].get();
+            nodes.back()->addon.leadingNodes.AddLeadingNodes(
+                nodes[idx].get(), edge);
+        }
+
+        return nodes.size() - 1;
+    }
+
+    //! Backs up \p credit from the edge to the node of \p idx.
+    //! \param updater The updater to use.
+    //! \param idx The index of the node.
+    //! \param credit The credit to back up.
+    void Update(MCTS::TreeUpdater& updater, std::size_t idx, float credit)
+    {
+        if (!leafEdge)
+        {
+            leafEdge = std::make_unique<MCTS::EdgeAddon>();
+        }
+
+        const std::vector<MCTS::TraversedNodeInfo> path{
+            { nodes[idx].get(), leafEdge.get(), 0 }
+        };
+        updater.Update(path, credit);
+    }
+
+    std::vector<std::unique_ptr<MCTS::TreeNode>> nodes;
+    std::vector<std::unique_ptr<MCTS::EdgeAddon>> edges;
+    std::unique_ptr<MCTS::EdgeAddon> leafEdge;
+};
+}  // namespace
+
+TEST_CASE("[TreeUpdater] - Diamond")
+{
+    DAG dag;
+    const std::size_t root = dag.AddNode({});
+    const std::size_t left = dag.AddNode({ root });
+    const std::size_t right = dag.AddNode({ root });
+    const std::size_t leaf = dag.AddNode({ left, right });
+
+    MCTS::TreeUpdater updater;
+    dag.Update(updater, leaf, 1.0f);
+
+    // The root is reached twice, but its edges are credited once
+    for (const auto& edge : dag.edges)
+    {
+        CHECK_EQ(edge->GetTotal(), MCTS::CREDIT_GRANULARITY);
+        CHECK_EQ(edge->GetCredit(), MCTS::CREDIT_GRANULARITY);
+    }
+    CHECK_EQ(dag.leafEdge->GetTotal(), MCTS::CREDIT_GRANULARITY);
+}
+
+TEST_CASE("[TreeUpdater] - SharedEdge")
+{
+    DAG dag;
+    const std::size_t root = dag.AddNode({});
+
+    // The boards after a random action share the edge of the action
+    const std::size_t board1 = dag.AddNode({ root });
+    const std::size_t board2 = dag.AddNode({ root }, 0);
+    const std::size_t leaf = dag.AddNode({ board1, board2 });
+
+    MCTS::TreeUpdater updater;
+    dag.Update(updater, leaf, 0.0f);
+
+    CHECK_EQ(dag.edges.size(), 3u);
+    for (const auto& edge : dag.edges)
+    {
+        CHECK_EQ(edge->GetTotal(), MCTS::CREDIT_GRANULARITY);
+        CHECK_EQ(edge->GetCredit(), 0);
+    }
+}
+
+TEST_CASE("[TreeUpdater] - Layers")
+{
+    constexpr int DEPTH = 8;
+    constexpr int WIDTH = 3;
+    constexpr int NUM_UPDATES = 10;
+
+    // Each node is reached from all nodes of the previous layer, so there
+    // are WIDTH ^ (DEPTH - 1) paths from a leaf to the root
+    DAG dag;
+    std::vector<std::size_t> layer{ dag.AddNode({}) };
+    for (int depth = 1; depth < DEPTH; ++depth)
+    {
+        std::vector<std::size_t> nextLayer;
+        for (int i = 0; i < WIDTH; ++i)
+        {
+            nextLayer.emplace_back(dag.AddNode(layer));
+        }
+        layer = std::move(nextLayer);
+    }
+
+    // The buffers of the updater are reused by the updates
+    MCTS::TreeUpdater updater;
+    for (int i = 0; i < NUM_UPDATES; ++i)
+    {
+        dag.Update(updater, layer.front(), 1.0f);
+    }
+
+    // Each edge above the leaf is credited exactly once per update
+    std::size_t numCreditedEdges = 0;
+    for (const auto& edge : dag.edges)
+    {
+        if (edge->GetTotal() != 0)
+        {
+            CHECK_EQ(edge->GetTotal(),
+                     NUM_UPDATES * MCTS::CREDIT_GRANULARITY);
+            ++numCreditedEdges;
+        }
+    }
+
+    // The edges to the other leaves aren't credited
+    CHECK_EQ(numCreditedEdges, dag.edges.size() - (WIDTH - 1) * WIDTH);
+}
+
+TEST_CASE("[TreeUpdater] - ShortPathAfterLongPath")
+{
+    constexpr std::size_t LENGTH = 200;
+
+    DAG dag;
+    std::vector<std::size_t> chain{ dag.AddNode({}) };
+    for (std::size_t i = 1; i < LENGTH; ++i)
+    {
+        chain.emplace_back(dag.AddNode({ chain.back() }));
+    }
+
+    // The long path grows the buffers, and the short path reuses them
+    MCTS::TreeUpdater updater;
+    dag.Update(updater, chain.back(), 1.0f);
+    dag.Update(updater, chain[1], 1.0f);
+    dag.Update(updater, chain[1], 1.0f);
+
+    CHECK_EQ(dag.edges.front()->GetTotal(), 3 * MCTS::CREDIT_GRANULARITY);
+    for (std::size_t i = 1; i < dag.edges.size(); ++i)
+    {
+        CHECK_EQ(dag.edges[i]->GetTotal(), MCTS::CREDIT_GRANULARITY);
+    }
+}
@@ -0,0 +1,2 @@
+#include <iostream>
+#include <doctest.h>
\ No newline at end of file
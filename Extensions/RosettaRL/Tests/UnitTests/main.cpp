@@ -0,0 +1,23 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <doctest.h>
+
+#include <Rosetta/Cards/Cards.hpp>
+
+int main()
+{
+    doctest::Context context;
+
+    // Load the cards before a test measures the trees
+    RosettaStone::Cards::GetInstance();
+
+    // Run queries, or run tests unless --no-run is specified
+    const int res = context.run();
+
+    return res;
+}
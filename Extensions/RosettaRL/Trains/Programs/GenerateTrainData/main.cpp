@@ -6,20 +6,19 @@
 
 #include <Agents/MCTSAgent.hpp>
 #include <Agents/MCTSConfig.hpp>
-#include <Judges/JSON/Recorder.hpp>
+#include <Judges/Binary/Reader.hpp>
+#include <Judges/Binary/RecordFile.hpp>
+#include <Judges/Binary/Recorder.hpp>
 #include <Judges/Judger.hpp>
 
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/DeckCode.hpp>
-
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
 #include <fstream>
 #include <iostream>
 #include <sstream>
 
-using Random = effolkronium::random_static;
-
 class AgentCallback
 {
  public:
@@ -96,7 +95,8 @@ void SaveJSON(const nlohmann::json& json)
     strftime(buffer, 80, "%Y%m%d-%H%M%S", &timeinfo);
 
     std::ostringstream ss;
-    const int postfix = Random::get<int>(0, 89999) + 10000;
+    const int postfix =
+        RandomGenerator::GetThreadLocal().Get<int>(0, 89999) + 10000;
     ss << buffer << "-" << postfix << ".json";
     const std::string fileName = ss.str();
 
@@ -111,10 +111,10 @@ int main(int argc, char* argv[])
 
     Initialize();
 
-    if (argc != 3)
+    if (argc != 3 && !(argc == 4 && std::string(argv[3]) == "--json"))
     {
         std::cout << "Usage: " << argv[0] << " (threads)"
-                  << " (iterations)" << std::endl;
+                  << " (iterations) [--json]" << std::endl;
         return EXIT_FAILURE;
     }
 
@@ -137,7 +137,7 @@ int main(int argc, char* argv[])
     std::cout << "\tIterations: " << config.iterationsPerAction << std::endl;
 
     using MCTSAgent = RosettaTorch::Agents::MCTSAgent<AgentCallback>;
-    using namespace RosettaTorch::Judges::JSON;
+    using namespace RosettaTorch::Judges::Binary;
 
     Recorder recorder;
     RosettaTorch::Judges::Judger<MCTSAgent, Recorder> judger(recorder);
@@ -158,18 +158,22 @@ int main(int argc, char* argv[])
 
     const std::string INNKEEPER_EXPERT_WARLOCK =
         "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
-    auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
-
-    for (std::size_t j = 0; j < deck.size(); ++j)
-    {
-        gameConfig.player1Deck[j] = *Cards::FindCardByID(deck[j]);
-        gameConfig.player2Deck[j] = *Cards::FindCardByID(deck[j]);
-    }
+    const auto& deck = DeckCode::GetDeck(INNKEEPER_EXPERT_WARLOCK);
+    gameConfig.player1Deck = deck;
+    gameConfig.player2Deck = deck;
 
     Game game(gameConfig);
     judger.Start(game);
 
-    SaveJSON(recorder.GetJSON());
+    // NOTE: The writer starts a new shard after the existing ones, so the
+    // games of all runs are kept
+    RecordWriter writer(".", "games");
+    writer.Write(recorder.GetRecord());
+
+    if (argc == 4)
+    {
+        SaveJSON(Reader::ToJSON(recorder.GetRecord()));
+    }
 
     return EXIT_SUCCESS;
 }
\ No newline at end of file
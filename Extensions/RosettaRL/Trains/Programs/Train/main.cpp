@@ -4,17 +4,22 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Judges/Binary/RecordFile.hpp>
 #include <Judges/JSON/Reader.hpp>
 #include <NeuralNet/NeuralNetwork.hpp>
+#include <NeuralNet/TrainingDataLoader.hpp>
 
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 #include <json/json.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 using namespace RosettaTorch;
+using RosettaStone::RandomGenerator;
 
 class Trainer
 {
@@ -85,6 +90,65 @@ class Trainer
         }
     }
 
+    void Train(const std::vector<std::string>& shards,
+               double validationRate) const
+    {
+        const std::size_t epoch = 10;
+        std::size_t totalEpoch = 0;
+
+        NeuralNet::TrainingDataLoaderConfig config;
+        config.batchSize = 32;
+        config.numWorkers = std::max(std::thread::hardware_concurrency(), 2u);
+        config.validationRate = validationRate;
+
+        while (true)
+        {
+            {
+                config.numEpochs = epoch;
+                config.seed = totalEpoch;
+
+                NeuralNet::TrainingDataLoader loader(shards, config);
+                m_net.Train(loader);
+
+                if (const auto numSkipped = loader.GetNumSkippedRecords())
+                {
+                    std::cout << "Skipped records: " << numSkipped
+                              << std::endl;
+                }
+            }
+            totalEpoch += epoch;
+
+            std::stringstream ss;
+            ss << "net_result_epoch_" << totalEpoch;
+            m_net.Save(ss.str());
+
+            // NOTE: All loaders agree on the split of each game because it
+            // depends on the seed of split only
+            config.numEpochs = 1;
+
+            {
+                NeuralNet::TrainingDataLoader loader(shards, config);
+                const auto trainVerify = m_net.Verify(loader);
+                const double rate =
+                    static_cast<double>(trainVerify.first) / trainVerify.second;
+                std::cout << "Test data correct rate: " << rate * 100.0 << "% ("
+                          << trainVerify.first << " / " << trainVerify.second
+                          << ")" << std::endl;
+            }
+
+            {
+                NeuralNet::TrainingDataLoader loader(
+                    shards, config, NeuralNet::DataSplit::VALIDATION);
+                const auto validateVerify = m_net.Verify(loader);
+                const double rate = static_cast<double>(validateVerify.first) /
+                                    validateVerify.second;
+                std::cout << "Validation data correct rate: " << rate * 100.0
+                          << "% (" << validateVerify.first << " / "
+                          << validateVerify.second << ")" << std::endl;
+            }
+        }
+    }
+
  private:
     NeuralNet::NeuralNetwork m_net;
     NeuralNet::NeuralNetworkInput m_trainInput;
@@ -93,28 +157,41 @@ class Trainer
     NeuralNet::NeuralNetworkOutput m_validateOutput;
 };
 
-using Random = effolkronium::random_static;
-
 int main(int argc, char* argv[])
 {
-    if (argc != 2)
+    if (argc != 2 && argc != 3)
     {
-        std::cout << "Usage: (program) (dir name)" << std::endl;
+        std::cout << "Usage: (program) (dir name) [shard prefix]" << std::endl;
         return EXIT_FAILURE;
     }
 
     Trainer trainer;
 
     const std::string dirName = argv[1];
-    const std::string fileListPath = dirName + "/filelist";
+    const std::string prefix = argc == 3 ? argv[2] : "games";
+    const double validationCaseRate = 0.3;  // 30% for validation
 
     std::cout << "Reading from dir: " << dirName << std::endl;
+
+    const auto shards =
+        Judges::Binary::RecordReader::FindShards(dirName, prefix);
+    if (!shards.empty())
+    {
+        std::cout << "Shards: " << shards.size() << std::endl;
+
+        // NOTE: The shards are streamed, so the data set doesn't have to fit
+        // in memory
+        trainer.Train(shards, validationCaseRate);
+
+        return EXIT_SUCCESS;
+    }
+
+    const std::string fileListPath = dirName + "/filelist";
     std::cout << "Filelist file: " << fileListPath << std::endl;
 
     std::ifstream fileList(fileListPath);
 
     int loadedFiles = 0;
-    const double validationCaseRate = 0.3;  // 30% for validation
 
     while (fileList)
     {
@@ -126,7 +203,8 @@ int main(int argc, char* argv[])
             continue;
         }
 
-        const auto randValue = Random::get<double>(0.0, 1.0);
+        const auto randValue =
+            RandomGenerator::GetThreadLocal().Get(0.0, 1.0);
         const bool forValidate = randValue < validationCaseRate;
 
         try
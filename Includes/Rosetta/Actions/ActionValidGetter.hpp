@@ -44,7 +44,7 @@ class ActionValidGetter
                              ? m_game.GetPlayer1()->GetFieldZone()
                              : m_game.GetPlayer2()->GetFieldZone();
 
-        for (auto& minion : fieldZone->GetAll())
+        for (auto& minion : fieldZone->GetView())
         {
             functor(minion);
         }
@@ -57,7 +57,7 @@ class ActionValidGetter
     {
         auto handZone = m_game.GetCurrentPlayer()->GetHandZone();
 
-        for (auto& card : handZone->GetAll())
+        for (auto& card : handZone->GetView())
         {
             if (!IsPlayable(m_game.GetCurrentPlayer(), card))
             {
@@ -78,7 +78,7 @@ class ActionValidGetter
     {
         auto fieldZone = m_game.GetCurrentPlayer()->GetFieldZone();
 
-        for (auto& minion : fieldZone->GetAll())
+        for (auto& minion : fieldZone->GetView())
         {
             if (!minion->CanAttack())
             {
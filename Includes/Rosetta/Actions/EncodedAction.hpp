@@ -0,0 +1,198 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_ENCODED_ACTION_HPP
+#define ROSETTASTONE_ENCODED_ACTION_HPP
+
+#include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Enums/ActionEnums.hpp>
+
+#include <cstdint>
+#include <string>
+
+namespace RosettaStone
+{
+//!
+//! \brief EncodedAction class.
+//!
+//! This class is a complete action of the current player packed into 32 bits.
+//! It contains the main operation, the source, the target, the position of
+//! minion and the index of choose one, so it can be executed by Game::Apply()
+//! without the dialogue of ActionParams.
+//!
+//! The source of PLAY_CARD is the zone position of the card in hand, and the
+//! source of ATTACK is the slot of the attacker. A slot is relative to the
+//! current player: 0 is no character, 1 is the hero of the current player,
+//! 2 to 8 are the minions of the current player, 9 is the hero of the
+//! opponent and 10 to 16 are the minions of the opponent.
+//!
+//! The layout is stable, so encoded actions can be stored and compared as
+//! integers.
+//!  - Bits 0-3: The main operation type.
+//!  - Bits 4-7: The index of choose one, 0 if the card has no choose one.
+//!  - Bits 8-15: The source.
+//!  - Bits 16-23: The slot of the target.
+//!  - Bits 24-31: The position of minion to summon.
+//!
+class EncodedAction
+{
+ public:
+    //! The slot of no character.
+    static constexpr int NO_SLOT = 0;
+
+    //! The slot of the hero of the current player.
+    static constexpr int HERO_SLOT = 1;
+
+    //! The slot of the hero of the opponent.
+    static constexpr int OPPONENT_HERO_SLOT = HERO_SLOT + MAX_FIELD_SIZE + 1;
+
+    //! The number of slots including no character.
+    static constexpr int NUM_SLOTS = OPPONENT_HERO_SLOT + MAX_FIELD_SIZE + 1;
+
+    //! Default constructor. It makes an invalid action.
+    constexpr EncodedAction() = default;
+
+    //! Constructs encoded action with given \p value.
+    //! \param value The value of encoded action.
+    explicit constexpr EncodedAction(std::uint32_t value) : m_value(value)
+    {
+        // Do nothing
+    }
+
+    //! Creates an action that plays a card.
+    //! \param handPos The zone position of the card in hand.
+    //! \param target The slot of the target.
+    //! \param fieldPos The position of minion to summon.
+    //! \param chooseOne The index of choose one.
+    //! \return The encoded action.
+    static constexpr EncodedAction PlayCard(int handPos, int target = NO_SLOT,
+                                            int fieldPos = 0,
+                                            int chooseOne = 0)
+    {
+        return Encode(MainOpType::PLAY_CARD, handPos, target, fieldPos,
+                      chooseOne);
+    }
+
+    //! Creates an action that attacks.
+    //! \param source The slot of the attacker.
+    //! \param target The slot of the target.
+    //! \return The encoded action.
+    static constexpr EncodedAction Attack(int source, int target)
+    {
+        return Encode(MainOpType::ATTACK, source, target, 0, 0);
+    }
+
+    //! Creates an action that uses hero power.
+    //! \param target The slot of the target.
+    //! \return The encoded action.
+    static constexpr EncodedAction HeroPower(int target = NO_SLOT)
+    {
+        return Encode(MainOpType::USE_HERO_POWER, 0, target, 0, 0);
+    }
+
+    //! Creates an action that ends turn.
+    //! \return The encoded action.
+    static constexpr EncodedAction EndTurn()
+    {
+        return Encode(MainOpType::END_TURN, 0, 0, 0, 0);
+    }
+
+    //! Returns the main operation type.
+    //! \return The main operation type.
+    constexpr MainOpType GetMainOp() const
+    {
+        return static_cast<MainOpType>(m_value & 0xF);
+    }
+
+    //! Returns the index of choose one.
+    //! \return The index of choose one.
+    constexpr int GetChooseOne() const
+    {
+        return static_cast<int>((m_value >> 4) & 0xF);
+    }
+
+    //! Returns the source.
+    //! \return The source.
+    constexpr int GetSource() const
+    {
+        return static_cast<int>((m_value >> 8) & 0xFF);
+    }
+
+    //! Returns the slot of the target.
+    //! \return The slot of the target.
+    constexpr int GetTarget() const
+    {
+        return static_cast<int>((m_value >> 16) & 0xFF);
+    }
+
+    //! Returns the position of minion to summon.
+    //! \return The position of minion to summon.
+    constexpr int GetFieldPos() const
+    {
+        return static_cast<int>((m_value >> 24) & 0xFF);
+    }
+
+    //! Returns the value of encoded action.
+    //! \return The value of encoded action.
+    constexpr std::uint32_t GetValue() const
+    {
+        return m_value;
+    }
+
+    //! Returns the string of encoded action.
+    //! \return The string of encoded action.
+    std::string ToString() const
+    {
+        return GetMainOpString(GetMainOp()) +
+               " source=" + std::to_string(GetSource()) +
+               " target=" + std::to_string(GetTarget()) +
+               " pos=" + std::to_string(GetFieldPos()) +
+               " choose=" + std::to_string(GetChooseOne());
+    }
+
+    //! Operator overloading for operator==.
+    //! \param rhs The encoded action to compare.
+    //! \return true if the actions are equal, false otherwise.
+    constexpr bool operator==(const EncodedAction& rhs) const
+    {
+        return m_value == rhs.m_value;
+    }
+
+    //! Operator overloading for operator!=.
+    //! \param rhs The encoded action to compare.
+    //! \return true if the actions are not equal, false otherwise.
+    constexpr bool operator!=(const EncodedAction& rhs) const
+    {
+        return m_value != rhs.m_value;
+    }
+
+ private:
+    //! Packs the fields of action into 32 bits.
+    //! \param op The main operation type.
+    //! \param source The source.
+    //! \param target The slot of the target.
+    //! \param fieldPos The position of minion to summon.
+    //! \param chooseOne The index of choose one.
+    //! \return The encoded action.
+    static constexpr EncodedAction Encode(MainOpType op, int source,
+                                          int target, int fieldPos,
+                                          int chooseOne)
+    {
+        return EncodedAction(
+            (static_cast<std::uint32_t>(op) & 0xF) |
+            ((static_cast<std::uint32_t>(chooseOne) & 0xF) << 4) |
+            ((static_cast<std::uint32_t>(source) & 0xFF) << 8) |
+            ((static_cast<std::uint32_t>(target) & 0xFF) << 16) |
+            ((static_cast<std::uint32_t>(fieldPos) & 0xFF) << 24));
+    }
+
+    std::uint32_t m_value = 0;
+};
+
+static_assert(sizeof(EncodedAction) == 4, "The size of action must be fixed");
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_ENCODED_ACTION_HPP
@@ -48,12 +48,27 @@ class AdaptiveEffect : public IAura
     //! \param clone The entity to clone aura effect.
     void Clone(Playable* clone) override;
 
+    //! Copies the internal state of this effect to \p clone, the instance
+    //! created by Clone() for an entity of a cloned game.
+    //! \param clone The aura effect of the cloned game.
+    //! \param context The context that maps entities to the cloned game.
+    void CloneState(IAura& clone, CloneContext& context) const override;
+
+    //! Checks whether the value of a skipped update matches the result of
+    //! computing it again.
+    //! \return true if the value matches, false otherwise.
+    bool IsConsistent() const override;
+
  private:
     //! Constructs adaptive effect with given \p prototype and \p owner.
     //! \param prototype An adaptive effect for prototype.
     //! \param owner An owner of adaptive effect.
     AdaptiveEffect(AdaptiveEffect& prototype, Playable& owner);
 
+    //! Computes the value of the effect from the current game state.
+    //! \return The value of the effect.
+    int ComputeValue() const;
+
     Playable* m_owner = nullptr;
 
     std::shared_ptr<SelfCondition> m_condition;
@@ -63,6 +78,7 @@ class AdaptiveEffect : public IAura
     EffectOperator m_operator;
 
     int m_lastValue = 0;
+    std::size_t m_updatedVersion = 0;
     bool m_turnOn = true;
     bool m_isSwitching = false;
 };
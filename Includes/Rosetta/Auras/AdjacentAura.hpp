@@ -44,6 +44,12 @@ class AdjacentAura : public IAura
     //! \param clone The entity to clone aura effect.
     void Clone(Playable* clone) override;
 
+    //! Copies the internal state of this effect to \p clone, the instance
+    //! created by Clone() for an entity of a cloned game.
+    //! \param clone The aura effect of the cloned game.
+    //! \param context The context that maps entities to the cloned game.
+    void CloneState(IAura& clone, CloneContext& context) const override;
+
     //! Sets the flag whether the field zone is changed.
     //! \param isFieldChanged The flag whether the field zone is changed.
     void SetIsFieldChanged(bool isFieldChanged);
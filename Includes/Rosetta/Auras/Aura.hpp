@@ -14,8 +14,10 @@
 #include <Rosetta/Enchants/Trigger.hpp>
 #include <Rosetta/Enums/AuraEnums.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace RosettaStone
 {
@@ -68,6 +70,17 @@ class Aura : public IAura
     //! \param clone The entity to clone aura effect.
     void Clone(Playable* clone) override;
 
+    //! Copies the internal state of this effect to \p clone, the instance
+    //! created by Clone() for an entity of a cloned game.
+    //! \param clone The aura effect of the cloned game.
+    //! \param context The context that maps entities to the cloned game.
+    void CloneState(IAura& clone, CloneContext& context) const override;
+
+    //! Checks whether the entities that a restless aura skips in the next
+    //! update match the result of evaluating its condition again.
+    //! \return true if they match, false otherwise.
+    bool IsConsistent() const override;
+
     //! Applies aura's effect(s) to target entity.
     //! \param entity The entity to apply aura's effect(s).
     virtual void Apply(Playable* entity);
@@ -88,6 +101,10 @@ class Aura : public IAura
 
     std::shared_ptr<SelfCondition> condition;
     std::pair<TriggerType, std::shared_ptr<SelfCondition>> removeTrigger;
+
+    //! The flag to indicate that the condition is evaluated on every update.
+    //! It is evaluated again only for the entities that are changed since
+    //! the last update, so it must depend on the evaluated entity only.
     bool restless = false;
 
  protected:
@@ -101,11 +118,30 @@ class Aura : public IAura
     //! \param aura The dynamically allocated Aura instance.
     void AddToGame(Playable& owner, Aura& aura);
 
+    //! Checks whether this aura is applied to \p entity.
+    //! \param entity The entity to check.
+    //! \return true if this aura is applied to \p entity, false otherwise.
+    bool IsApplied(const Playable* entity) const;
+
+    //! Adds \p entity to the list of the applied entities.
+    //! \param entity The entity to add.
+    void AddAppliedEntity(Playable* entity);
+
+    //! Removes \p entity from the list of the applied entities.
+    //! \param entity The entity to remove.
+    //! \return true if \p entity was in the list, false otherwise.
+    bool RemoveAppliedEntity(Playable* entity);
+
+    //! Clears the list of the applied entities.
+    void ClearAppliedEntities();
+
     AuraType m_type = AuraType::INVALID;
     Playable* m_owner = nullptr;
 
     PriorityQueue<AuraUpdateInstruction> m_auraUpdateInstQueue;
     std::vector<Playable*> m_appliedEntities;
+    std::vector<int> m_appliedEntityIndices;
+    std::size_t m_renewedVersion = 0;
 
     TriggerEventHandler m_removeHandler;
 
@@ -121,8 +157,18 @@ class Aura : public IAura
     //! Internal method of Remove().
     virtual void RemoveInternal();
 
-    //! Renews the condition of the applied entities.
+    //! Removes the aura if the remove trigger is satisfied.
+    //! \param source The source of the remove trigger.
+    void OnRemoveTrigger(Entity* source);
+
+    //! Renews the condition of the entities that are changed since
+    //! the last renewal.
     void RenewAll();
+
+    //! Runs \p functor on each entity whose condition is renewed.
+    //! \param functor The functor to run.
+    template <typename Functor>
+    void ForEachRenewTarget(Functor&& functor) const;
 };
 }  // namespace RosettaStone
 
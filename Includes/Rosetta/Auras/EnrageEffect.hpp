@@ -40,6 +40,12 @@ class EnrageEffect : public Aura
     //! \param clone The entity to clone aura effect.
     void Clone(Playable* clone) override;
 
+    //! Copies the internal state of this effect to \p clone, the instance
+    //! created by Clone() for an entity of a cloned game.
+    //! \param clone The aura effect of the cloned game.
+    //! \param context The context that maps entities to the cloned game.
+    void CloneState(IAura& clone, CloneContext& context) const override;
+
  private:
     //! Constructs enrage effect with given \p prototype and \p owner.
     //! \param prototype An enrage effect for prototype.
@@ -11,6 +11,7 @@
 namespace RosettaStone
 {
 class Playable;
+struct CloneContext;
 
 //!
 //! \brief IAura class.
@@ -38,6 +39,21 @@ class IAura
     //! Clones aura effect to \p clone.
     //! \param clone The entity to clone aura effect.
     virtual void Clone(Playable* clone) = 0;
+
+    //! Copies the internal state of this effect to \p clone, the instance
+    //! created by Clone() for an entity of a cloned game.
+    //! \param clone The aura effect of the cloned game.
+    //! \param context The context that maps entities to the cloned game.
+    virtual void CloneState(IAura& clone, CloneContext& context) const = 0;
+
+    //! Checks whether the state that this effect keeps between updates
+    //! matches the result of computing it again from scratch. It is used to
+    //! verify the incremental update in Game::UpdateAura().
+    //! \return true if the state matches, false otherwise.
+    virtual bool IsConsistent() const
+    {
+        return true;
+    }
 };
 }  // namespace RosettaStone
 
@@ -40,6 +40,12 @@ class SwitchingAura : public Aura
     //! Removes this effect from the game to stop affecting entities.
     void Remove() override;
 
+    //! Copies the internal state of this effect to \p clone, the instance
+    //! created by Clone() for an entity of a cloned game.
+    //! \param clone The aura effect of the cloned game.
+    //! \param context The context that maps entities to the cloned game.
+    void CloneState(IAura& clone, CloneContext& context) const override;
+
  private:
     //! Constructs switching aura with given \p prototype, \p owner.
     //! \param prototype An enrage effect for prototype.
@@ -49,6 +55,12 @@ class SwitchingAura : public Aura
     //! Internal method of Remove().
     void RemoveInternal() override;
 
+    //! Switches on the aura.
+    void TurnOn(Entity*);
+
+    //! Switches off the aura.
+    void TurnOff(Entity*);
+
     SelfCondition m_initCondition;
     TriggerType m_offTrigger;
 
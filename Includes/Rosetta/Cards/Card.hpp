@@ -12,6 +12,8 @@
 #include <Rosetta/Enums/TargetingEnums.hpp>
 #include <Rosetta/Loaders/TargetingPredicates.hpp>
 
+#include <cstdint>
+#include <limits>
 #include <map>
 #include <string>
 #include <vector>
@@ -21,6 +23,12 @@ namespace RosettaStone
 class Character;
 class Power;
 
+//! The dense index of the card in the card database.
+using CardIndex = std::uint16_t;
+
+//! The index of the card that isn't in the card database.
+constexpr CardIndex INVALID_CARD_INDEX = std::numeric_limits<CardIndex>::max();
+
 //!
 //! \brief Card class.
 //!
@@ -118,6 +126,7 @@ class Card
 
     std::string id;
     int dbfID;
+    CardIndex index = INVALID_CARD_INDEX;
     std::string name;
     std::string text;
 
@@ -8,6 +8,7 @@
 
 #include <Rosetta/Cards/CardDef.hpp>
 
+#include <functional>
 #include <map>
 #include <string>
 
@@ -37,10 +38,12 @@ class CardDefs
     //! \return A reference to instance of CardDefs class.
     static CardDefs& GetInstance();
 
-    //! Returns the card def data that matches \p cardID.
+    //! Returns the card def data that matches \p cardID. It searches the map
+    //! in O(log N) and doesn't copy the data.
     //! \param cardID The ID of the card.
-    //! \return The card def data that matches \p cardID.
-    static CardDef FindCardDefByCardID(const std::string_view& cardID);
+    //! \return The card def data that matches \p cardID, or an empty card def
+    //! if it doesn't exist.
+    static const CardDef& FindCardDefByCardID(const std::string_view& cardID);
 
  private:
     //! Constructor: Loads card data (powers and play requirements).
@@ -49,7 +52,7 @@ class CardDefs
     //! Destructor: Releases card data (powers and play requirements).
     ~CardDefs();
 
-    static std::map<std::string, CardDef> m_data;
+    static std::map<std::string, CardDef, std::less<>> m_data;
 };
 }  // namespace RosettaStone
 
@@ -10,6 +10,8 @@
 #include <Rosetta/Cards/Card.hpp>
 #include <Rosetta/Commons/Constants.hpp>
 
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace RosettaStone
@@ -88,6 +90,17 @@ class Cards
     //! \return A card that matches \p id.
     static Card* FindCardByID(const std::string_view& id);
 
+    //! Returns the index of a card that matches \p id. The index is stable
+    //! while the program is running and can be kept instead of \p id.
+    //! \param id The ID of the card.
+    //! \return The index of a card, or INVALID_CARD_INDEX if there is no card.
+    static CardIndex GetCardIndex(const std::string_view& id);
+
+    //! Returns a card that matches \p index.
+    //! \param index The index of the card.
+    //! \return A card that matches \p index.
+    static Card* GetCardByIndex(CardIndex index);
+
     //! Returns a card that matches \p dbfID.
     //! \param dbfID The dbfID of the card.
     //! \return A card that matches \p dbfID.
@@ -176,6 +189,11 @@ class Cards
     static std::vector<Card*> m_allStandardCards;
     static std::vector<Card*> m_allWildCards;
     static std::vector<Card*> m_lackeys;
+
+    // Sorted lists of (key, card index) pairs for binary search
+    static std::vector<std::pair<std::string_view, CardIndex>> m_idIndices;
+    static std::vector<std::pair<int, CardIndex>> m_dbfIDIndices;
+    static std::vector<std::pair<std::string_view, CardIndex>> m_nameIndices;
 };
 }  // namespace RosettaStone
 
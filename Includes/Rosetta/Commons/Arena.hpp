@@ -0,0 +1,197 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_ARENA_HPP
+#define ROSETTASTONE_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief Arena class.
+//!
+//! This class is a monotonic allocator that hands out memory from large
+//! blocks. Memory is never reused; it is released all at once when the arena
+//! is destroyed or Release() is called. A game owns an arena if it is enabled
+//! by GameConfig::useArena, and its entities, enchantments, triggers and
+//! tasks are allocated from it.
+//!
+class Arena
+{
+ public:
+    //! The default size of a block in bytes.
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    //!
+    //! \brief Scope class.
+    //!
+    //! This class makes the given arena the current arena of the calling
+    //! thread while it is alive. The objects derived from ArenaObject are
+    //! allocated from the current arena.
+    //!
+    class Scope
+    {
+     public:
+        //! Constructs scope with given \p arena.
+        //! \param arena The arena to make current, or nullptr to use the heap.
+        explicit Scope(Arena* arena);
+
+        //! Destructor. Restores the previous current arena.
+        ~Scope();
+
+        //! Deleted copy constructor.
+        Scope(const Scope&) = delete;
+
+        //! Deleted copy assignment operator.
+        Scope& operator=(const Scope&) = delete;
+
+     private:
+        Arena* m_prevArena = nullptr;
+    };
+
+    //! Constructs arena with given \p blockSize.
+    //! \param blockSize The size of a block in bytes.
+    explicit Arena(std::size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    //! Deleted copy constructor.
+    Arena(const Arena&) = delete;
+
+    //! Deleted copy assignment operator.
+    Arena& operator=(const Arena&) = delete;
+
+    //! Allocates memory of \p size bytes aligned to \p alignment.
+    //! \param size The size of memory in bytes.
+    //! \param alignment The alignment of memory.
+    //! \return A pointer to the allocated memory.
+    void* Allocate(std::size_t size,
+                   std::size_t alignment = alignof(std::max_align_t));
+
+    //! Releases all memory allocated from the arena.
+    void Release();
+
+    //! Returns the number of blocks that the arena owns.
+    //! \return The number of blocks.
+    std::size_t GetNumBlocks() const;
+
+    //! Returns the total size of memory allocated from the arena.
+    //! \return The total size of memory in bytes.
+    std::size_t GetAllocatedBytes() const;
+
+    //! Returns the current arena of the calling thread.
+    //! \return The current arena, or nullptr if there is no current arena.
+    static Arena* GetCurrent();
+
+ private:
+    std::vector<std::unique_ptr<std::byte[]>> m_blocks;
+    std::byte* m_cur = nullptr;
+    std::size_t m_remaining = 0;
+
+    std::size_t m_blockSize = DEFAULT_BLOCK_SIZE;
+    std::size_t m_allocatedBytes = 0;
+};
+
+//!
+//! \brief ArenaAllocator class.
+//!
+//! This class is an allocator for standard containers and
+//! std::allocate_shared. It allocates from the given arena, or from the heap
+//! if the arena is nullptr. Deallocation of arena memory does nothing.
+//!
+template <typename T>
+class ArenaAllocator
+{
+ public:
+    using value_type = T;
+
+    //! Constructs allocator with given \p arena.
+    //! \param arena The arena to allocate from, or nullptr to use the heap.
+    explicit ArenaAllocator(Arena* arena) noexcept : m_arena(arena)
+    {
+        // Do nothing
+    }
+
+    //! Constructs allocator from the allocator of other type.
+    //! \param rhs The allocator of other type.
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& rhs) noexcept
+        : m_arena(rhs.GetArena())
+    {
+        // Do nothing
+    }
+
+    //! Allocates memory for \p n objects.
+    //! \param n The number of objects.
+    //! \return A pointer to the allocated memory.
+    T* allocate(std::size_t n)
+    {
+        if (m_arena == nullptr)
+        {
+            return std::allocator<T>().allocate(n);
+        }
+
+        return static_cast<T*>(m_arena->Allocate(n * sizeof(T), alignof(T)));
+    }
+
+    //! Deallocates memory for \p n objects.
+    //! \param ptr A pointer to the memory.
+    //! \param n The number of objects.
+    void deallocate(T* ptr, std::size_t n) noexcept
+    {
+        if (m_arena == nullptr)
+        {
+            std::allocator<T>().deallocate(ptr, n);
+        }
+    }
+
+    //! Returns the arena to allocate from.
+    //! \return The arena, or nullptr if it uses the heap.
+    Arena* GetArena() const noexcept
+    {
+        return m_arena;
+    }
+
+ private:
+    Arena* m_arena = nullptr;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs)
+{
+    return lhs.GetArena() == rhs.GetArena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs)
+{
+    return !(lhs == rhs);
+}
+
+//!
+//! \brief ArenaObject class.
+//!
+//! This class provides operator new and delete that allocate objects of
+//! derived classes from the current arena (see Arena::Scope). The objects can
+//! be deleted as usual; their memory is returned to the heap only if they
+//! were allocated from the heap.
+//!
+class ArenaObject
+{
+ public:
+    //! Allocates memory from the current arena or the heap.
+    //! \param size The size of memory in bytes.
+    //! \return A pointer to the allocated memory.
+    static void* operator new(std::size_t size);
+
+    //! Frees memory if it was allocated from the heap.
+    //! \param ptr A pointer to the memory.
+    static void operator delete(void* ptr) noexcept;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_ARENA_HPP
@@ -8,6 +8,9 @@
 #define ROSETTASTONE_DECK_CODE_HPP
 
 #include <Rosetta/Accounts/DeckInfo.hpp>
+#include <Rosetta/Commons/Constants.hpp>
+
+#include <array>
 
 namespace RosettaStone
 {
@@ -18,6 +21,15 @@ class DeckCode
     //! \param deckCode The deck code generated by Hearthstone.
     //! \return The decoded deck that contains card information.
     static DeckInfo Decode(const std::string& deckCode);
+
+    //! Returns the cards of a deck code that can be assigned to the deck of
+    //! GameConfig. A deck code is decoded only once and the cards are cached,
+    //! so it is cheap to call for each game. It is safe to call from multiple
+    //! threads.
+    //! \param deckCode The deck code generated by Hearthstone.
+    //! \return The cards of the deck. Empty slots are nullptr.
+    static const std::array<Card*, START_DECK_SIZE>& GetDeck(
+        const std::string& deckCode);
 };
 }  // namespace RosettaStone
 
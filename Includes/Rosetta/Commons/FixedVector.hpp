@@ -0,0 +1,214 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_FIXED_VECTOR_HPP
+#define ROSETTASTONE_FIXED_VECTOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief FixedVector class.
+//!
+//! This class is a vector with fixed capacity that stores its elements in
+//! place, so it never allocates memory on the heap. It is used for the short
+//! lists of the simulator such as the entities of a zone or the targets of
+//! an attack. It holds up to \p N elements of \p T, which must be default
+//! constructible.
+//!
+template <typename T, std::size_t N>
+class FixedVector
+{
+ public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    //! Default constructor.
+    FixedVector() = default;
+
+    //! Constructs fixed vector with given \p list.
+    //! \param list The elements to add.
+    FixedVector(std::initializer_list<T> list)
+    {
+        for (const auto& value : list)
+        {
+            push_back(value);
+        }
+    }
+
+    //! Operator overloading for operator[].
+    //! \param idx The index of the element.
+    //! \return The element at \p idx.
+    T& operator[](std::size_t idx)
+    {
+        return m_data[idx];
+    }
+
+    //! Operator overloading for operator[].
+    //! \param idx The index of the element.
+    //! \return The element at \p idx.
+    const T& operator[](std::size_t idx) const
+    {
+        return m_data[idx];
+    }
+
+    //! Returns an iterator to the first element.
+    //! \return An iterator to the first element.
+    iterator begin()
+    {
+        return m_data.data();
+    }
+
+    //! Returns an iterator to the first element.
+    //! \return An iterator to the first element.
+    const_iterator begin() const
+    {
+        return m_data.data();
+    }
+
+    //! Returns an iterator past the last element.
+    //! \return An iterator past the last element.
+    iterator end()
+    {
+        return m_data.data() + m_size;
+    }
+
+    //! Returns an iterator past the last element.
+    //! \return An iterator past the last element.
+    const_iterator end() const
+    {
+        return m_data.data() + m_size;
+    }
+
+    //! Returns the first element.
+    //! \return The first element.
+    T& front()
+    {
+        return m_data[0];
+    }
+
+    //! Returns the last element.
+    //! \return The last element.
+    T& back()
+    {
+        return m_data[m_size - 1];
+    }
+
+    //! Returns a pointer to the elements.
+    //! \return A pointer to the elements.
+    T* data()
+    {
+        return m_data.data();
+    }
+
+    //! Returns the number of elements.
+    //! \return The number of elements.
+    std::size_t size() const
+    {
+        return m_size;
+    }
+
+    //! Returns the maximum number of elements.
+    //! \return The maximum number of elements.
+    static constexpr std::size_t capacity()
+    {
+        return N;
+    }
+
+    //! Returns a value indicating whether there are no elements.
+    //! \return true if there are no elements, false otherwise.
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    //! Adds \p value to the end.
+    //! \param value The value to add.
+    void push_back(const T& value)
+    {
+        if (m_size == N)
+        {
+            throw std::length_error(
+                "FixedVector::push_back() - The vector is full!");
+        }
+
+        m_data[m_size++] = value;
+    }
+
+    //! Adds \p value to the end.
+    //! \param value The value to add.
+    //! \return The added element.
+    T& emplace_back(const T& value)
+    {
+        push_back(value);
+        return back();
+    }
+
+    //! Removes the last element.
+    void pop_back()
+    {
+        m_data[--m_size] = T();
+    }
+
+    //! Removes the element at \p pos.
+    //! \param pos The iterator to the element to remove.
+    //! \return The iterator following the removed element.
+    iterator erase(const_iterator pos)
+    {
+        const auto idx = static_cast<std::size_t>(pos - begin());
+        std::move(begin() + idx + 1, end(), begin() + idx);
+        pop_back();
+
+        return begin() + idx;
+    }
+
+    //! Removes all elements.
+    void clear()
+    {
+        std::fill(begin(), end(), T());
+        m_size = 0;
+    }
+
+    //! Copies the elements to std::vector.
+    //! \return The vector that contains the elements.
+    std::vector<T> ToVector() const
+    {
+        return std::vector<T>(begin(), end());
+    }
+
+    //! Operator overloading for operator==.
+    //! \param rhs The fixed vector to compare.
+    //! \return true if the elements are equal, false otherwise.
+    bool operator==(const FixedVector& rhs) const
+    {
+        return std::equal(begin(), end(), rhs.begin(), rhs.end());
+    }
+
+    //! Operator overloading for operator!=.
+    //! \param rhs The fixed vector to compare.
+    //! \return true if the elements are not equal, false otherwise.
+    bool operator!=(const FixedVector& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+ private:
+    std::array<T, N> m_data{};
+    std::size_t m_size = 0;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_FIXED_VECTOR_HPP
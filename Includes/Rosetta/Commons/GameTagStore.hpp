@@ -0,0 +1,94 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_GAME_TAG_STORE_HPP
+#define ROSETTASTONE_GAME_TAG_STORE_HPP
+
+#include <Rosetta/Enums/CardEnums.hpp>
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief GameTagStore class.
+//!
+//! This class stores the values of game tags of an entity. The tags that are
+//! read and written on every action such as ATK, HEALTH and DAMAGE are kept
+//! in a fixed-size array indexed by GetDenseIndex(), and the rest of tags are
+//! kept in a small sorted vector. It doesn't allocate memory unless a rare
+//! tag is written, so it is cheap to create and copy.
+//!
+class GameTagStore
+{
+ public:
+    //! The number of game tags that are stored in the array.
+    static constexpr std::size_t NUM_DENSE_TAGS = 33;
+
+    //! Returns the index of \p tag in the array.
+    //! \param tag The game tag.
+    //! \return The index of \p tag, or -1 if it is stored in the vector.
+    static int GetDenseIndex(GameTag tag);
+
+    //! Returns a pointer to the value of \p tag.
+    //! \param tag The game tag.
+    //! \return A pointer to the value, or nullptr if \p tag isn't stored.
+    const int* Find(GameTag tag) const;
+
+    //! Sets the value of \p tag.
+    //! \param tag The game tag.
+    //! \param value The value to set.
+    void Set(GameTag tag, int value);
+
+    //! Removes \p tag from the store.
+    //! \param tag The game tag.
+    void Erase(GameTag tag);
+
+    //! Fills the array with the values of \p defaults. The tags in the array
+    //! that aren't in \p defaults are stored as 0. The tags of \p defaults
+    //! that don't fit in the array aren't copied; the owner falls back to
+    //! \p defaults when Find() returns nullptr.
+    //! \param defaults The game tags of the card.
+    void SetDefaults(const std::map<GameTag, int>& defaults);
+
+    //! Calls \p functor with each tag and value in the store.
+    //! \param functor The functor to call with (GameTag, int).
+    template <typename Functor>
+    void ForEach(Functor&& functor) const
+    {
+        for (std::size_t i = 0; i < NUM_DENSE_TAGS; ++i)
+        {
+            if ((m_denseMask >> i) & 1u)
+            {
+                functor(DENSE_TAGS[i], m_dense[i]);
+            }
+        }
+
+        for (const auto& [tag, value] : m_sparse)
+        {
+            functor(tag, value);
+        }
+    }
+
+    //! Returns the tags and values in the store as a map.
+    //! \return The map of tags and values.
+    std::map<GameTag, int> ToMap() const;
+
+ private:
+    static const std::array<GameTag, NUM_DENSE_TAGS> DENSE_TAGS;
+
+    std::array<int, NUM_DENSE_TAGS> m_dense{};
+    std::uint64_t m_denseMask = 0;
+
+    std::vector<std::pair<GameTag, int>> m_sparse;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_GAME_TAG_STORE_HPP
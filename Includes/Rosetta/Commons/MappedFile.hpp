@@ -0,0 +1,64 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_MAPPED_FILE_HPP
+#define ROSETTASTONE_MAPPED_FILE_HPP
+
+#include <Rosetta/Commons/Macros.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief MappedFile class.
+//!
+//! This class maps a file into memory for reading. It reads the whole file
+//! on platforms that don't support mmap. The data is aligned to a page, so
+//! the fixed-size records of a binary file can be read in place.
+//!
+class MappedFile
+{
+ public:
+    //! Constructs mapped file with given \p path.
+    //! \param path The path of the file.
+    explicit MappedFile(const std::string& path);
+
+    //! Destructor.
+    ~MappedFile();
+
+    //! Deleted copy constructor.
+    MappedFile(const MappedFile&) = delete;
+
+    //! Deleted move constructor.
+    MappedFile(MappedFile&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    //! Deleted move assignment operator.
+    MappedFile& operator=(MappedFile&&) noexcept = delete;
+
+    //! Returns the data of the file.
+    //! \return The data of the file, or nullptr if it can't be read.
+    const char* GetData() const;
+
+    //! Returns the size of the file.
+    //! \return The size of the file.
+    std::size_t GetSize() const;
+
+ private:
+    const char* m_data = nullptr;
+    std::size_t m_size = 0;
+#if defined(ROSETTASTONE_WINDOWS)
+    std::vector<char> m_buffer;
+#endif
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_MAPPED_FILE_HPP
@@ -86,6 +86,7 @@ class PriorityQueue
     {
         PriorityQueue<T> temp(rhs);
         std::swap(temp.m_head, m_head);
+        std::swap(temp.m_count, m_count);
         return *this;
     }
 
@@ -94,6 +95,7 @@ class PriorityQueue
     {
         PriorityQueue<T> temp(rhs);
         std::swap(temp.m_head, m_head);
+        std::swap(temp.m_count, m_count);
         return *this;
     }
 
@@ -142,6 +144,17 @@ class PriorityQueue
         return node->value;
     }
 
+    //! Runs \p functor on each element in order of priority.
+    //! \param functor The functor to run; it may modify the element.
+    template <typename Functor>
+    void ForEach(Functor&& functor)
+    {
+        for (Node* node = m_head->next; node != nullptr; node = node->next)
+        {
+            functor(node->value);
+        }
+    }
+
     //! Checks if the value of the element exists.
     //! \param value The value of the element to check.
     //! \return true if the the value of the element exists, false otherwise.
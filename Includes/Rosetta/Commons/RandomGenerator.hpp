@@ -0,0 +1,184 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_RANDOM_GENERATOR_HPP
+#define ROSETTASTONE_RANDOM_GENERATOR_HPP
+
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace RosettaStone
+{
+//!
+//! \brief RandomGenerator class.
+//!
+//! This class is a counter-based random number generator using SplitMix64.
+//! The n-th number of a stream is a function of the seed and n only, so the
+//! state is two integers and is cheap to copy and fork. Unlike the engines
+//! and distributions of the standard library, the numbers are the same on
+//! every platform, so a seed reproduces the same game anywhere. A game owns
+//! a generator that is seeded from GameConfig::seed. A generator must not be
+//! shared between threads.
+//!
+class RandomGenerator
+{
+ public:
+    using result_type = std::uint64_t;
+
+    //! Constructs random generator with a seed from the random generator of
+    //! the calling thread, so it doesn't read std::random_device.
+    RandomGenerator();
+
+    //! Constructs random generator with given \p seed.
+    //! \param seed The seed of the stream.
+    explicit RandomGenerator(std::uint64_t seed);
+
+    //! Returns the random generator of the calling thread. It is seeded from
+    //! std::random_device and is never shared with other threads.
+    //! \return The random generator of the calling thread.
+    static RandomGenerator& GetThreadLocal();
+
+    //! Returns the smallest value that operator() returns.
+    //! \return The smallest value that operator() returns.
+    static constexpr result_type min()
+    {
+        return std::numeric_limits<result_type>::min();
+    }
+
+    //! Returns the largest value that operator() returns.
+    //! \return The largest value that operator() returns.
+    static constexpr result_type max()
+    {
+        return std::numeric_limits<result_type>::max();
+    }
+
+    //! Returns the next number of the stream.
+    //! \return The next number of the stream.
+    result_type operator()()
+    {
+        return Mix(m_seed + ++m_counter * GOLDEN_GAMMA);
+    }
+
+    //! Returns the seed of the stream.
+    //! \return The seed of the stream.
+    std::uint64_t GetSeed() const
+    {
+        return m_seed;
+    }
+
+    //! Returns the number of numbers that are generated.
+    //! \return The number of numbers that are generated.
+    std::uint64_t GetCounter() const
+    {
+        return m_counter;
+    }
+
+    //! Creates an independent generator from the current state and
+    //! \p streamID. Forking the same state with the same stream ID always
+    //! makes the same generator. It doesn't advance this generator.
+    //! \param streamID The identifier of the new stream.
+    //! \return The new generator.
+    RandomGenerator Fork(std::uint64_t streamID) const
+    {
+        return RandomGenerator(
+            Mix(Mix(m_seed + m_counter * GOLDEN_GAMMA) ^ Mix(~streamID)));
+    }
+
+    //! Returns a random integer in [\p min, \p max].
+    //! \param min The minimum value.
+    //! \param max The maximum value.
+    //! \return A random integer in [\p min, \p max].
+    template <typename T>
+    std::enable_if_t<std::is_integral_v<T>, T> Get(T min, T max)
+    {
+        using U = std::make_unsigned_t<T>;
+        const std::uint64_t range =
+            static_cast<std::uint64_t>(static_cast<U>(max) -
+                                       static_cast<U>(min)) +
+            1;
+
+        return static_cast<T>(static_cast<U>(min) +
+                              static_cast<U>(GetBounded(range)));
+    }
+
+    //! Returns a random floating point number in [\p min, \p max).
+    //! \param min The minimum value.
+    //! \param max The maximum value.
+    //! \return A random floating point number in [\p min, \p max).
+    template <typename T>
+    std::enable_if_t<std::is_floating_point_v<T>, T> Get(T min, T max)
+    {
+        // The upper 53 bits make a double in [0, 1) without rounding
+        const double unit = static_cast<double>((*this)() >> 11) * 0x1.0p-53;
+        const T value = min + static_cast<T>(unit * (max - min));
+
+        // Rounding to float can reach the excluded maximum
+        return value < max ? value : min;
+    }
+
+    //! Shuffles the elements in [\p first, \p last) using Fisher-Yates.
+    //! \param first The iterator to the first element.
+    //! \param last The iterator past the last element.
+    template <typename RandomIt>
+    void Shuffle(RandomIt first, RandomIt last)
+    {
+        using Diff = typename std::iterator_traits<RandomIt>::difference_type;
+        const auto count = static_cast<std::uint64_t>(last - first);
+
+        for (std::uint64_t i = count; i > 1; --i)
+        {
+            const auto j = static_cast<Diff>(GetBounded(i));
+
+            using std::swap;
+            swap(first[static_cast<Diff>(i - 1)], first[j]);
+        }
+    }
+
+ private:
+    static constexpr std::uint64_t GOLDEN_GAMMA = 0x9e3779b97f4a7c15ULL;
+
+    //! Mixes the bits of \p z with the finalizer of SplitMix64.
+    //! \param z The value to mix.
+    //! \return The mixed value.
+    static constexpr std::uint64_t Mix(std::uint64_t z)
+    {
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+        return z ^ (z >> 31);
+    }
+
+    //! Returns an unbiased random number in [0, \p range). The full range of
+    //! 64 bits is represented by 0.
+    //! \param range The number of values.
+    //! \return A random number in [0, \p range).
+    std::uint64_t GetBounded(std::uint64_t range)
+    {
+        if (range == 0)
+        {
+            return (*this)();
+        }
+
+        // Rejects the values of the last partial block to avoid modulo bias
+        const std::uint64_t threshold = (0 - range) % range;
+
+        std::uint64_t value;
+        do
+        {
+            value = (*this)();
+        } while (value < threshold);
+
+        return value % range;
+    }
+
+    std::uint64_t m_seed = 0;
+    std::uint64_t m_counter = 0;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_RANDOM_GENERATOR_HPP
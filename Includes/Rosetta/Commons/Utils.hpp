@@ -7,15 +7,13 @@
 #ifndef ROSETTASTONE_UTILS_HPP
 #define ROSETTASTONE_UTILS_HPP
 
-#include <effolkronium/random.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 
 #include <cstddef>
 #include <functional>
 #include <string>
 #include <vector>
 
-using Random = effolkronium::random_static;
-
 //! Checks all conditions are true.
 //! \param t A value to check that it is true.
 //! \return true if all conditions are true, false otherwise.
@@ -68,11 +66,14 @@ void EraseIf(ContainerT& items, const PredicateT& predicate)
 
 //! Gets N elements from a list of distinct elements by using the default
 //! equality comparer. The source list must not have any repeated elements.
+//! \param random The random generator to choose elements.
 //! \param list A list of distinct elements to choose.
 //! \param amount The number of elements to choose.
 //! \return A list of N distinct elements.
 template <typename T>
-std::vector<T*> ChooseNElements(const std::vector<T*>& list, std::size_t amount)
+std::vector<T*> ChooseNElements(RosettaStone::RandomGenerator& random,
+                                const std::vector<T*>& list,
+                                std::size_t amount)
 {
     if (amount > list.size())
     {
@@ -92,7 +93,7 @@ std::vector<T*> ChooseNElements(const std::vector<T*>& list, std::size_t amount)
 
         do
         {
-            idx = Random::get<std::size_t>(0, list.size() - 1);
+            idx = random.Get<std::size_t>(0, list.size() - 1);
             flag = false;
 
             for (std::size_t j = 0; j < i; ++j)
@@ -55,7 +55,7 @@ class Atk : public SelfContainedIntAttr<Atk, Entity>
             }
         }
 
-        if (const auto character = dynamic_cast<Character*>(entity); character)
+        if (const auto character = EntityCast<Character>(entity); character)
         {
             SelfContainedIntAttr::Apply(character, effectOp, value);
         }
@@ -73,7 +73,7 @@ class Atk : public SelfContainedIntAttr<Atk, Entity>
     //! \return The value of the attribute of the entity.
     int GetValue(Entity* entity) override
     {
-        if (const auto hero = dynamic_cast<Hero*>(entity); hero)
+        if (const auto hero = EntityCast<Hero>(entity); hero)
         {
             if (hero->HasWeapon())
             {
@@ -83,7 +83,7 @@ class Atk : public SelfContainedIntAttr<Atk, Entity>
             return hero->GetAttack();
         }
 
-        const auto minion = dynamic_cast<Minion*>(entity);
+        const auto minion = EntityCast<Minion>(entity);
         return minion->GetAttack();
     }
 
@@ -92,7 +92,7 @@ class Atk : public SelfContainedIntAttr<Atk, Entity>
     //! \param value The value of the attribute of the entity.
     void SetValue(Entity* entity, int value) override
     {
-        auto character = dynamic_cast<Character*>(entity);
+        auto character = EntityCast<Character>(entity);
         character->SetAttack(value);
     }
 
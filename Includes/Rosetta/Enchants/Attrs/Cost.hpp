@@ -38,7 +38,7 @@ class Cost : public SelfContainedIntAttr<Cost, Entity>
     {
         SelfContainedIntAttr::Apply(entity, effectOp, value);
 
-        const auto playable = dynamic_cast<Playable*>(entity);
+        const auto playable = EntityCast<Playable>(entity);
 
         if (auto* costManager = playable->costManager; costManager)
         {
@@ -52,7 +52,7 @@ class Cost : public SelfContainedIntAttr<Cost, Entity>
     //! \param value The value to change the attribute.
     void ApplyAura(Entity* entity, EffectOperator effectOp, int value) override
     {
-        const auto playable = dynamic_cast<Playable*>(entity);
+        const auto playable = EntityCast<Playable>(entity);
 
         CostManager* costManager = playable->costManager;
         if (costManager == nullptr)
@@ -70,7 +70,7 @@ class Cost : public SelfContainedIntAttr<Cost, Entity>
     //! \param value The value to change the attribute.
     void RemoveAura(Entity* entity, EffectOperator effectOp, int value) override
     {
-        const auto playable = dynamic_cast<Playable*>(entity);
+        const auto playable = EntityCast<Playable>(entity);
 
         if (auto* costManager = playable->costManager; costManager)
         {
@@ -84,7 +84,7 @@ class Cost : public SelfContainedIntAttr<Cost, Entity>
     //! \return The value of the attribute of the entity.
     int GetValue(Entity* entity) override
     {
-        const auto playable = dynamic_cast<Playable*>(entity);
+        const auto playable = EntityCast<Playable>(entity);
         return playable->GetCost();
     }
 
@@ -93,7 +93,7 @@ class Cost : public SelfContainedIntAttr<Cost, Entity>
     //! \param value The value of the attribute of the entity.
     void SetValue(Entity* entity, int value) override
     {
-        auto playable = dynamic_cast<Playable*>(entity);
+        auto playable = EntityCast<Playable>(entity);
         playable->SetCost(value);
     }
 
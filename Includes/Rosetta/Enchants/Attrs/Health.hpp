@@ -38,7 +38,7 @@ class Health : public SelfContainedIntAttr<Health, Entity>
     {
         if (effectOp == EffectOperator::SET)
         {
-            if (auto hero = dynamic_cast<Hero*>(entity); hero)
+            if (auto hero = EntityCast<Hero>(entity); hero)
             {
                 const int heroHealth = hero->GetMaxHealth();
 
@@ -54,7 +54,7 @@ class Health : public SelfContainedIntAttr<Health, Entity>
                 return;
             }
 
-            if (auto minion = dynamic_cast<Minion*>(entity); minion)
+            if (auto minion = EntityCast<Minion>(entity); minion)
             {
                 minion->SetHealth(value);
                 return;
@@ -74,7 +74,7 @@ class Health : public SelfContainedIntAttr<Health, Entity>
 
         if (effectOp == EffectOperator::ADD)
         {
-            auto character = dynamic_cast<Character*>(entity);
+            auto character = EntityCast<Character>(entity);
             character->SetDamage(character->GetDamage() - value);
         }
     }
@@ -85,7 +85,7 @@ class Health : public SelfContainedIntAttr<Health, Entity>
     //! \return The value of the attribute of the entity.
     int GetValue(Entity* entity) override
     {
-        const auto character = dynamic_cast<Character*>(entity);
+        const auto character = EntityCast<Character>(entity);
         return character->GetHealth();
     }
 
@@ -94,7 +94,7 @@ class Health : public SelfContainedIntAttr<Health, Entity>
     //! \param value The value of the attribute of the entity.
     void SetValue(Entity* entity, int value) override
     {
-        auto character = dynamic_cast<Character*>(entity);
+        auto character = EntityCast<Character>(entity);
         character->SetHealth(value);
     }
 
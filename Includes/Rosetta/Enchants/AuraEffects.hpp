@@ -34,8 +34,9 @@ class AuraEffects
     //! Destructor.
     ~AuraEffects();
 
-    //! Deleted copy constructor.
-    AuraEffects(const AuraEffects&) = delete;
+    //! Copy constructor.
+    //! \param rhs The aura effects to copy.
+    AuraEffects(const AuraEffects& rhs);
 
     //! Deleted move constructor.
     AuraEffects(AuraEffects&&) noexcept = delete;
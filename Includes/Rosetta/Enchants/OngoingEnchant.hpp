@@ -50,6 +50,12 @@ class OngoingEnchant : public Enchant, public IAura
     //! \param clone The entity to clone aura effect.
     void Clone(Playable* clone) override;
 
+    //! Copies the internal state of this effect to \p clone, the instance
+    //! created by Clone() for an entity of a cloned game.
+    //! \param clone The aura effect of the cloned game.
+    //! \param context The context that maps entities to the cloned game.
+    void CloneState(IAura& clone, CloneContext& context) const override;
+
     //! Gets the count of ongoing enchants.
     //! \return The count of ongoing enchants.
     std::size_t GetCount() const;
@@ -49,6 +49,13 @@ class Trigger
     //! Removes this object from game and unsubscribe from the related event.
     void Remove() const;
 
+    //! Creates a copy of this trigger instance for \p owner of a cloned game.
+    //! Unlike Activate(), the copy isn't subscribed to any event and it isn't
+    //! added to the game; Game::Clone() does it in the original order.
+    //! \param owner The owner of trigger in the cloned game.
+    //! \return The copy of this trigger instance.
+    std::shared_ptr<Trigger> Clone(Playable& owner);
+
     //! Checks triggers related to the current Sequence at once before sequence
     //! starts.
     //! \param game The game.
@@ -69,6 +76,10 @@ class Trigger
     bool removeAfterTriggered = false;
 
  private:
+    //! Handles the event that the trigger is registered to.
+    //! \param source The source of trigger.
+    void OnEvent(Entity* source);
+
     //! Processes trigger to apply the effect.
     //! \param source The source of trigger.
     void Process(Entity* source);
@@ -10,6 +10,8 @@
 #ifndef ROSETTASTONE_ACTION_ENUMS_HPP
 #define ROSETTASTONE_ACTION_ENUMS_HPP
 
+#include <string>
+
 namespace RosettaStone
 {
 //! \brief An enumerator for identifying main operation type.
@@ -56,6 +58,34 @@ inline std::string GetMainOpString(MainOpType op)
             return "UNKNOWN";
     }
 }
+
+//! Returns the string of the action type.
+//! \param type The action type.
+//! \return The string of the action type.
+inline std::string GetActionTypeString(ActionType type)
+{
+    switch (type)
+    {
+        case ActionType::INVALID:
+            return "INVALID";
+        case ActionType::RANDOM:
+            return "RANDOM";
+        case ActionType::MAIN_ACTION:
+            return "MAIN_ACTION";
+        case ActionType::CHOOSE_HAND_CARD:
+            return "CHOOSE_HAND_CARD";
+        case ActionType::CHOOSE_ATTACKER:
+            return "CHOOSE_ATTACKER";
+        case ActionType::CHOOSE_MINION_PUT_LOCATION:
+            return "CHOOSE_MINION_PUT_LOCATION";
+        case ActionType::CHOOSE_TARGET:
+            return "CHOOSE_TARGET";
+        case ActionType::CHOOSE_ONE:
+            return "CHOOSE_ONE";
+        default:
+            return "UNKNOWN";
+    }
+}
 }  // namespace RosettaStone
 
 #endif  // ROSETTASTONE_ACTION_ENUMS_HPP
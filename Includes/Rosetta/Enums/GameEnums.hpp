@@ -17,6 +17,19 @@ enum class PlayerType
     PLAYER1,  //!< The first player.
     PLAYER2,  //!< The second player.
 };
+
+//! \brief An enumerator for identifying the concrete class of entity.
+enum class EntityKind : unsigned char
+{
+    INVALID,      //!< The invalid entity.
+    PLAYER,       //!< The player.
+    HERO,         //!< The hero.
+    HERO_POWER,   //!< The hero power.
+    MINION,       //!< The minion.
+    SPELL,        //!< The spell.
+    WEAPON,       //!< The weapon.
+    ENCHANTMENT,  //!< The enchantment.
+};
 }  // namespace RosettaStone
 
 #endif  // ROSETTASTONE_GAME_ENUMS_HPP
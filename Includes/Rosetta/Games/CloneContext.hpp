@@ -0,0 +1,55 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_CLONE_CONTEXT_HPP
+#define ROSETTASTONE_CLONE_CONTEXT_HPP
+
+#include <Rosetta/Managers/TriggerEventHandler.hpp>
+
+#include <unordered_map>
+
+namespace RosettaStone
+{
+class Entity;
+
+//!
+//! \brief CloneContext struct.
+//!
+//! This struct stores the mapping between objects of a source game and
+//! the corresponding objects of its deep copy. It is filled and used by
+//! Game::Clone() to fix up pointers after all objects are copied.
+//!
+struct CloneContext
+{
+    //! Returns the entity of the cloned game corresponding to \p entity.
+    //! \param entity The entity of the source game.
+    //! \return The entity of the cloned game, or nullptr if it isn't cloned.
+    template <typename T>
+    T* Get(const Entity* entity) const
+    {
+        if (entity == nullptr)
+        {
+            return nullptr;
+        }
+
+        const auto iter = entities.find(entity);
+        if (iter == entities.end())
+        {
+            return nullptr;
+        }
+
+        return static_cast<T*>(iter->second);
+    }
+
+    //! Source entity -> cloned entity.
+    std::unordered_map<const Entity*, Entity*> entities;
+
+    //! Source handler ID -> handler of the cloned trigger or aura.
+    std::unordered_map<int, const TriggerEventHandler*> handlers;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_CLONE_CONTEXT_HPP
@@ -6,6 +6,9 @@
 #ifndef ROSETTASTONE_GAME_HPP
 #define ROSETTASTONE_GAME_HPP
 
+#include <Rosetta/Actions/EncodedAction.hpp>
+#include <Rosetta/Commons/Arena.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 #include <Rosetta/Enums/CardEnums.hpp>
 #include <Rosetta/Games/GameConfig.hpp>
 #include <Rosetta/Managers/TriggerManager.hpp>
@@ -30,6 +33,11 @@ class ActionParams;
 class Game
 {
  public:
+    //! Tag type to select the constructor that makes a deep copy.
+    struct CloneTag
+    {
+    };
+
     //! Constructs game with default values.
     Game();
 
@@ -37,6 +45,13 @@ class Game
     //! \param gameConfig The game config holds all configuration values.
     explicit Game(const GameConfig& gameConfig);
 
+    //! Constructs game as a deep copy of \p rhs. All entities, enchantments,
+    //! auras and triggers are copied and pointers between them are fixed up
+    //! to refer to the copies. It must be called between actions, i.e. while
+    //! no task is pending in the task queue.
+    //! \param rhs The game to copy.
+    Game(const Game& rhs, CloneTag);
+
     //! Default destructor.
     ~Game() = default;
 
@@ -59,6 +74,10 @@ class Game
     //! \param rhs The source to copy the content.
     void RefCopyFrom(const Game& rhs);
 
+    //! Creates a deep copy of the game that can be played independently.
+    //! \return The copied game.
+    std::unique_ptr<Game> Clone() const;
+
     //! Returns the format type of the game.
     //! \return The format type of the game.
     FormatType GetFormatType() const;
@@ -115,6 +134,34 @@ class Game
     //! \return The next order of play index.
     std::size_t GetNextOOP();
 
+    //! Returns the version of the game state. It increases whenever the game
+    //! tags or the aura effects of an entity are changed.
+    //! \return The version of the game state.
+    std::size_t GetStateVersion() const;
+
+    //! Increases the version of the game state.
+    //! \return The increased version of the game state.
+    std::size_t IncreaseStateVersion();
+
+    //! Returns the random generator of the game. Everything random in the
+    //! game is drawn from it.
+    //! \return The random generator of the game.
+    RandomGenerator& GetRandom();
+
+    //! Returns the seed of the random generator of the game.
+    //! \return The seed of the random generator of the game.
+    std::uint64_t GetSeed() const;
+
+    //! Resets the random generator of the game with \p seed.
+    //! \param seed The seed of the random generator.
+    void SetSeed(std::uint64_t seed);
+
+    //! Enables or disables the verification of UpdateAura(). If it is enabled,
+    //! UpdateAura() checks that the auras it skips match the result of
+    //! computing them again and throws std::logic_error if they don't.
+    //! \param enable The flag to enable the verification.
+    static void SetAuraVerification(bool enable);
+
     //! Part of the game state.
     void BeginFirst();
 
@@ -200,10 +247,31 @@ class Game
     //! \return The result of the game (player1 and player2).
     std::tuple<PlayState, PlayState> PerformAction(ActionParams& params);
 
+    //! Returns all legal actions of the current player. The actions are
+    //! enumerated from ActionValidChecker and the valid targets, so the game
+    //! isn't run. Each action can be executed by Apply().
+    //! \return The legal actions of the current player.
+    std::vector<EncodedAction> GetLegalActions() const;
+
+    //! Fills \p actions with all legal actions of the current player.
+    //! It reuses the memory of \p actions.
+    //! \param actions The list to store the legal actions.
+    void GetLegalActions(std::vector<EncodedAction>& actions) const;
+
+    //! Performs encoded action of the current player.
+    //! \param action The encoded action to perform.
+    //! \return The result of the game (player1 and player2).
+    std::tuple<PlayState, PlayState> Apply(EncodedAction action);
+
     //! Creates board view.
     //! \return The reduced board view.
     ReducedBoardView CreateView();
 
+    //! The arena that the entities, enchantments, triggers and tasks of the
+    //! game are allocated from if GameConfig::useArena is true. It must be
+    //! declared first so that it is destroyed after all of them.
+    std::unique_ptr<Arena> arena;
+
     State state = State::INVALID;
 
     Step step = Step::INVALID;
@@ -222,7 +290,8 @@ class Game
     std::vector<std::pair<Entity*, IEffect*>> oneTurnEffects;
     std::vector<std::shared_ptr<Enchantment>> oneTurnEffectEnchantments;
     std::vector<Minion*> summonedMinions;
-    std::map<std::size_t, Minion*> deadMinions;
+    //! The minions to destroy and their order of play, sorted by the order.
+    std::vector<std::pair<std::size_t, Minion*>> deadMinions;
 
  private:
     //! Checks whether the game is over.
@@ -236,6 +305,11 @@ class Game
 
     std::size_t m_entityID = 0;
     std::size_t m_oopIndex = 0;
+    std::size_t m_stateVersion = 0;
+
+    RandomGenerator m_random;
+
+    inline static bool m_verifyAuras = false;
 
     PlayerType m_currentPlayer = PlayerType::INVALID;
 };
@@ -11,6 +11,8 @@
 #include <Rosetta/Models/Player.hpp>
 
 #include <array>
+#include <cstdint>
+#include <optional>
 
 namespace RosettaStone
 {
@@ -26,8 +28,10 @@ struct GameConfig
     CardClass player1Class = CardClass::INVALID;
     CardClass player2Class = CardClass::INVALID;
 
-    std::array<Card, START_DECK_SIZE> player1Deck;
-    std::array<Card, START_DECK_SIZE> player2Deck;
+    //! The cards of the decks. The cards are owned by Cards, so a config is
+    //! cheap to copy. An empty slot is nullptr.
+    std::array<Card*, START_DECK_SIZE> player1Deck{};
+    std::array<Card*, START_DECK_SIZE> player2Deck{};
 
     std::array<std::string, NUM_PLAYER_CLASS> fillCardIDs = {
         "UNG_028", "UNG_067", "UNG_116", "UNG_829", "UNG_934",
@@ -38,6 +42,15 @@ struct GameConfig
     bool doShuffle = true;
     bool skipMulligan = true;
     bool autoRun = true;
+
+    //! Allocates the objects of the game from an arena owned by the game.
+    //! It makes creating and destroying many short-lived games cheaper.
+    bool useArena = false;
+
+    //! The seed of the random generator of the game. The same seed and the
+    //! same actions reproduce the same game. A seed from the random generator
+    //! of the thread is used if it is not set.
+    std::optional<std::uint64_t> seed;
 };
 }  // namespace RosettaStone
 
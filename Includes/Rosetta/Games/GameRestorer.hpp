@@ -10,6 +10,7 @@
 #ifndef ROSETTASTONE_GAME_RESTORER_HPP
 #define ROSETTASTONE_GAME_RESTORER_HPP
 
+#include <Rosetta/Commons/RandomGenerator.hpp>
 #include <Rosetta/Views/BoardView.hpp>
 
 #include <memory>
@@ -20,6 +21,9 @@ namespace RosettaStone
 //! \brief GameRestorer class.
 //!
 //! This class prepares the game state from board view and restores the game.
+//! The unknown cards and the seeds of the restored games are drawn from the
+//! random generator of the restorer, so each restorer is an independent
+//! stream that must be used by one thread.
 //!
 class GameRestorer
 {
@@ -109,6 +113,8 @@ class GameRestorer
 
     Views::Types::UnknownCardsSetsManager p1UnknownCardsManager;
     Views::Types::UnknownCardsSetsManager p2UnknownCardsManager;
+
+    RandomGenerator m_random;
 };
 }  // namespace RosettaStone
 
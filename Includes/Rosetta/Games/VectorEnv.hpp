@@ -0,0 +1,202 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_VECTOR_ENV_HPP
+#define ROSETTASTONE_VECTOR_ENV_HPP
+
+#include <Rosetta/Actions/EncodedAction.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Views/FeatureEncoder.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief VectorEnv class.
+//!
+//! This class runs N games side by side as an environment of reinforcement
+//! learning. Step() takes one action per game, applies them in parallel on
+//! the worker threads and restarts the games that are over, so every game
+//! is always waiting for an action of its current player.
+//!
+//! The results of a step are stored in contiguous row-major buffers that
+//! are owned by the environment and reused between steps:
+//!   - Observations: [N, NUM_FEATURES] floats written by FeatureEncoder.
+//!   - Action masks: [N, NUM_ACTIONS] bytes, 1 if the action is legal.
+//!   - Rewards: [N] floats, +1 if the player that acted won the game,
+//!     -1 if it lost and 0 otherwise.
+//!   - Dones: [N] bytes, 1 if the game was over and has been restarted.
+//! The observation and the action mask of a restarted game belong to the
+//! new game.
+//!
+//! An action is an index in [0, NUM_ACTIONS) that maps to EncodedAction by
+//! FromActionIndex(). The indices of PLAY_CARD come first, followed by
+//! ATTACK, USE_HERO_POWER and END_TURN.
+//!
+class VectorEnv
+{
+ public:
+    //! The number of features of an observation.
+    static constexpr std::size_t NUM_FEATURES = FeatureEncoder::NUM_FEATURES;
+
+    //! The number of positions of minion to summon.
+    static constexpr int NUM_FIELD_POS = MAX_FIELD_SIZE + 1;
+
+    //! The number of indices of choose one including no choice.
+    static constexpr int NUM_CHOOSE_ONE = 3;
+
+    static constexpr int PLAY_CARD_OFFSET = 0;
+    static constexpr int PLAY_CARD_SIZE = MAX_HAND_SIZE *
+                                          EncodedAction::NUM_SLOTS *
+                                          NUM_FIELD_POS * NUM_CHOOSE_ONE;
+    static constexpr int ATTACK_OFFSET = PLAY_CARD_OFFSET + PLAY_CARD_SIZE;
+    static constexpr int ATTACK_SIZE =
+        EncodedAction::NUM_SLOTS * EncodedAction::NUM_SLOTS;
+    static constexpr int HERO_POWER_OFFSET = ATTACK_OFFSET + ATTACK_SIZE;
+    static constexpr int HERO_POWER_SIZE = EncodedAction::NUM_SLOTS;
+    static constexpr int END_TURN_OFFSET = HERO_POWER_OFFSET + HERO_POWER_SIZE;
+
+    //! The number of actions of a game.
+    static constexpr std::size_t NUM_ACTIONS = END_TURN_OFFSET + 1;
+
+    //! Constructs vector environment with given \p config, \p numEnvs and
+    //! \p numThreads. It starts all games. If the seed of \p config is set,
+    //! the seed of each game is derived from it, the index of the game and
+    //! the number of restarts.
+    //! \param config The game config of all games. The games always run
+    //! automatically and skip mulligan.
+    //! \param numEnvs The number of games.
+    //! \param numThreads The number of threads that step the games. If it is
+    //! 0, the number of hardware threads is used.
+    VectorEnv(const GameConfig& config, std::size_t numEnvs,
+              std::size_t numThreads = 0);
+
+    //! Destructor.
+    ~VectorEnv();
+
+    //! Deleted copy constructor.
+    VectorEnv(const VectorEnv&) = delete;
+
+    //! Deleted move constructor.
+    VectorEnv(VectorEnv&&) noexcept = delete;
+
+    //! Deleted copy assignment operator.
+    VectorEnv& operator=(const VectorEnv&) = delete;
+
+    //! Deleted move assignment operator.
+    VectorEnv& operator=(VectorEnv&&) noexcept = delete;
+
+    //! Restarts all games and writes their observations and action masks.
+    //! The rewards and the dones are cleared.
+    void Reset();
+
+    //! Applies \p actions to the games, one action per game, and restarts
+    //! the games that are over.
+    //! \param actions The indices of actions that has N elements.
+    void Step(const std::int32_t* actions);
+
+    //! Applies \p actions to the games, one action per game, and restarts
+    //! the games that are over.
+    //! \param actions The indices of actions that has N elements.
+    void Step(const std::vector<std::int32_t>& actions);
+
+    //! Returns the number of games.
+    //! \return The number of games.
+    std::size_t GetNumEnvs() const;
+
+    //! Returns the game at \p idx.
+    //! \param idx The index of the game.
+    //! \return The game at \p idx.
+    const Game& GetGame(std::size_t idx) const;
+
+    //! Returns the observations that has N * NUM_FEATURES elements.
+    //! \return The observations.
+    const float* GetObservations() const;
+
+    //! Returns the action masks that has N * NUM_ACTIONS elements.
+    //! \return The action masks.
+    const std::uint8_t* GetActionMasks() const;
+
+    //! Returns the rewards of the last step that has N elements.
+    //! \return The rewards of the last step.
+    const float* GetRewards() const;
+
+    //! Returns the dones of the last step that has N elements.
+    //! \return The dones of the last step.
+    const std::uint8_t* GetDones() const;
+
+    //! Converts \p action to the index of action.
+    //! \param action The encoded action to convert.
+    //! \return The index of action, or -1 if it can't be represented.
+    static int ToActionIndex(EncodedAction action);
+
+    //! Converts \p idx to encoded action.
+    //! \param idx The index of action in [0, NUM_ACTIONS).
+    //! \return The encoded action.
+    static EncodedAction FromActionIndex(int idx);
+
+ private:
+    //! Restarts the game at \p idx.
+    //! \param idx The index of the game.
+    void ResetGame(std::size_t idx);
+
+    //! Applies \p action to the game at \p idx and writes the result.
+    //! \param idx The index of the game.
+    //! \param action The index of action.
+    void StepGame(std::size_t idx, int action);
+
+    //! Writes the observation and the action mask of the game at \p idx.
+    //! \param idx The index of the game.
+    void WriteState(std::size_t idx);
+
+    //! Calls \p job with the index of each game on the worker threads and
+    //! the calling thread. It returns after all calls are done and rethrows
+    //! the first exception of them.
+    //! \param job The job to run for each game.
+    void RunParallel(const std::function<void(std::size_t)>& job);
+
+    //! Runs the jobs of RunParallel() until no game is left.
+    void RunJobs();
+
+    //! The main loop of a worker thread.
+    void WorkerLoop();
+
+    GameConfig m_config;
+    std::size_t m_numEnvs = 0;
+
+    std::vector<std::unique_ptr<Game>> m_games;
+    std::vector<std::uint64_t> m_episodes;
+    std::vector<std::vector<EncodedAction>> m_legalActions;
+
+    std::vector<float> m_observations;
+    std::vector<std::uint8_t> m_actionMasks;
+    std::vector<float> m_rewards;
+    std::vector<std::uint8_t> m_dones;
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::condition_variable m_startCond;
+    std::condition_variable m_doneCond;
+    const std::function<void(std::size_t)>* m_job = nullptr;
+    std::atomic<std::size_t> m_nextIdx{ 0 };
+    std::exception_ptr m_exception;
+    std::size_t m_generation = 0;
+    std::size_t m_numRunning = 0;
+    bool m_stop = false;
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_VECTOR_ENV_HPP
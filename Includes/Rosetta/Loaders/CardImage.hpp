@@ -0,0 +1,58 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_CARD_IMAGE_HPP
+#define ROSETTASTONE_CARD_IMAGE_HPP
+
+#include <Rosetta/Cards/Card.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief CardImage class.
+//!
+//! This class reads and writes the binary image of card data. The image has
+//! a header, a table of fixed-size card records, a table of game tags and a
+//! string pool. It is memory-mapped when it is loaded, so cards are created
+//! without parsing. The header contains the version of the format and the
+//! checksum of the source file, so an image that is out of date is rejected
+//! and the cards are loaded from cards.json instead.
+//!
+class CardImage
+{
+ public:
+    //! The version of the format. Increase it when the format is changed.
+    static constexpr std::uint32_t VERSION = 1;
+
+    //! Computes the checksum of the source data using FNV-1a.
+    //! \param data The source data.
+    //! \param size The size of \p data.
+    //! \return The checksum of the source data.
+    static std::uint64_t ComputeChecksum(const char* data, std::size_t size);
+
+    //! Loads card data from the image.
+    //! \param path The path of the image.
+    //! \param checksum The checksum of the source data.
+    //! \param cards Data storage to store added cards.
+    //! \return The flag indicates whether the image is valid and up to date.
+    static bool Load(const std::string& path, std::uint64_t checksum,
+                     std::vector<Card*>& cards);
+
+    //! Saves card data to the image.
+    //! \param path The path of the image.
+    //! \param checksum The checksum of the source data.
+    //! \param cards The cards to save.
+    //! \return The flag indicates whether the image is written.
+    static bool Save(const std::string& path, std::uint64_t checksum,
+                     const std::vector<Card*>& cards);
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_CARD_IMAGE_HPP
@@ -11,6 +11,7 @@
 
 #include <json/json.hpp>
 
+#include <string>
 #include <vector>
 
 namespace RosettaStone
@@ -18,14 +19,32 @@ namespace RosettaStone
 //!
 //! \brief CardLoader class.
 //!
-//! This class loads card data from cards.json.
+//! This class loads card data from cards.json. Parsing JSON is slow, so the
+//! card data is also saved to a binary image (see CardImage) the first time
+//! and later loads read the image if it is up to date with cards.json.
 //!
 class CardLoader
 {
  public:
-    //! Loads card data from cards.json.
+    //! Loads card data from cards.json or its image in the resources
+    //! directory.
     //! \param cards Data storage to store added cards with power.
     static void Load(std::vector<Card*>& cards);
+
+    //! Loads card data from the image at \p imagePath if it is up to date
+    //! with the JSON file at \p jsonPath, or from the JSON file otherwise.
+    //! The image is written again if it is loaded from the JSON file.
+    //! \param jsonPath The path of the JSON file.
+    //! \param imagePath The path of the binary image.
+    //! \param cards Data storage to store added cards with power.
+    static void Load(const std::string& jsonPath, const std::string& imagePath,
+                     std::vector<Card*>& cards);
+
+    //! Loads card data from the contents of JSON file.
+    //! \param json The contents of JSON file.
+    //! \param cards Data storage to store added cards with power.
+    static void LoadFromJSON(const std::string& json,
+                             std::vector<Card*>& cards);
 };
 }  // namespace RosettaStone
 
@@ -9,17 +9,19 @@
 
 #include <Rosetta/Managers/TriggerEventHandler.hpp>
 
-#include <memory>
 #include <vector>
 
 namespace RosettaStone
 {
 class Entity;
+struct CloneContext;
 
 //!
 //! \brief TriggerEvent class.
 //!
-//! This is an event class for trigger.
+//! This is an event class for trigger. The handlers are stored by value in
+//! the order of registration. The handlers removed while notifying are
+//! marked and erased after the outermost notification ends.
 //!
 class TriggerEvent
 {
@@ -44,13 +46,22 @@ class TriggerEvent
     //! \param handler A trigger event handler to remove.
     TriggerEvent& operator-=(const TriggerEventHandler& handler);
 
+    //! Replaces the handlers with the ones of \p rhs, keeping the order of
+    //! registration. Each handler is substituted with the handler that
+    //! \p context maps its ID to, and the ones pending removal or without
+    //! a substitute are skipped.
+    //! \param rhs The trigger event of the source game.
+    //! \param context The context that holds handlers of the cloned game.
+    void CloneFrom(const TriggerEvent& rhs, const CloneContext& context);
+
  private:
     //! Notifies a list of trigger handlers to run.
     //! \param entity The argument of functor.
     void NotifyHandlers(Entity* entity);
 
-    std::vector<std::unique_ptr<TriggerEventHandler>> m_handlers;
-    bool m_isNotifying = false;
+    std::vector<TriggerEventHandler> m_handlers;
+    int m_notifyDepth = 0;
+    bool m_hasRemovedHandlers = false;
 };
 }  // namespace RosettaStone
 
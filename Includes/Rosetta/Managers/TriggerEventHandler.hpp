@@ -7,7 +7,7 @@
 #ifndef ROSETTASTONE_TRIGGER_EVENT_HANDLER_HPP
 #define ROSETTASTONE_TRIGGER_EVENT_HANDLER_HPP
 
-#include <functional>
+#include <cstddef>
 
 namespace RosettaStone
 {
@@ -16,19 +16,33 @@ class Entity;
 //!
 //! \brief TriggerEventHandler class.
 //!
-//! This is an event handler class for trigger.
+//! This is an event handler class for trigger. It calls a member function of
+//! an object through a plain function pointer, so it can be copied and
+//! called without allocating memory.
 //!
 class TriggerEventHandler
 {
  public:
-    using Func = std::function<void(Entity*)>;
+    using Func = void (*)(void* object, Entity* entity);
 
     //! Default constructor.
     TriggerEventHandler();
 
-    //! Constructs trigger event handler with given \p func.
-    //! \param func A functor to run.
-    explicit TriggerEventHandler(Func func);
+    //! Constructs trigger event handler with given \p object and \p func.
+    //! \param object The object to pass to \p func.
+    //! \param func A function to run.
+    TriggerEventHandler(void* object, Func func);
+
+    //! Creates trigger event handler that calls \p Method of \p object.
+    //! \param object The object to call \p Method.
+    //! \return The trigger event handler.
+    template <typename T, void (T::*Method)(Entity*)>
+    static TriggerEventHandler Create(T* object)
+    {
+        return TriggerEventHandler(object, [](void* obj, Entity* entity) {
+            (static_cast<T*>(obj)->*Method)(entity);
+        });
+    }
 
     //! Default destructor.
     ~TriggerEventHandler() noexcept = default;
@@ -39,13 +53,13 @@ class TriggerEventHandler
     //! Default move constructor.
     TriggerEventHandler(TriggerEventHandler&& handler) noexcept = default;
 
-    //! Copy assignment operator.
-    //! \param handler A trigger event handler to assign.
-    TriggerEventHandler& operator=(const TriggerEventHandler& handler);
+    //! Default copy assignment operator.
+    TriggerEventHandler& operator=(const TriggerEventHandler& handler) =
+        default;
 
-    //! Move assignment operator.
-    //! \param handler A trigger event handler to assign.
-    TriggerEventHandler& operator=(TriggerEventHandler&& handler) noexcept;
+    //! Default move assignment operator.
+    TriggerEventHandler& operator=(TriggerEventHandler&& handler) noexcept =
+        default;
 
     //! Operator overloading: operator().
     //! \param entity The argument of functor.
@@ -63,7 +77,8 @@ class TriggerEventHandler
     bool toBeRemoved = false;
 
  private:
-    Func m_func;
+    void* m_object = nullptr;
+    Func m_func = nullptr;
 };
 }  // namespace RosettaStone
 
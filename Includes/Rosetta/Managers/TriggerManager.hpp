@@ -93,6 +93,11 @@ class TriggerManager
     //! \param sender An entity that is the source of trigger.
     void OnUseHeroPowerTrigger(Entity* sender);
 
+    //! Replaces the handlers of all trigger events with the ones of \p rhs.
+    //! \param rhs The trigger manager of the source game.
+    //! \param context The context that holds handlers of the cloned game.
+    void CloneFrom(const TriggerManager& rhs, const CloneContext& context);
+
     TriggerEvent startTurnTrigger;
     TriggerEvent endTurnTrigger;
     TriggerEvent playCardTrigger;
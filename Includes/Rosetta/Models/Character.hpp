@@ -6,6 +6,8 @@
 #ifndef ROSETTASTONE_CHARACTER_HPP
 #define ROSETTASTONE_CHARACTER_HPP
 
+#include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Commons/FixedVector.hpp>
 #include <Rosetta/Managers/TriggerEvent.hpp>
 #include <Rosetta/Models/Playable.hpp>
 
@@ -29,6 +31,11 @@ class Character : public Playable
     //! \param id The ID.
     Character(Player* player, Card* card, std::map<GameTag, int> tags, int id);
 
+    //! Constructs character with given \p player and \p rhs of another game.
+    //! \param player The owner of the card.
+    //! \param rhs The character to copy.
+    Character(Player* player, const Character& rhs);
+
     //! Default destructor.
     ~Character() = default;
 
@@ -44,6 +51,14 @@ class Character : public Playable
     //! Deleted move assignment operator.
     Character& operator=(Character&&) noexcept = delete;
 
+    //! Returns a value indicating whether an entity of \p kind is Character.
+    //! \param kind The kind of entity.
+    //! \return true if an entity of \p kind is Character, false otherwise.
+    static constexpr bool IsKindOf(EntityKind kind)
+    {
+        return kind == EntityKind::HERO || kind == EntityKind::MINION;
+    }
+
     //! Returns the value of attack.
     //! \return The value of attack.
     virtual int GetAttack() const;
@@ -146,7 +161,8 @@ class Character : public Playable
     //! Returns a list of valid target in attack.
     //! \param opponent The opponent player.
     //! \return A list of pointer to valid target.
-    std::vector<Character*> GetValidAttackTargets(Player* opponent) const;
+    FixedVector<Character*, MAX_FIELD_SIZE + 1> GetValidAttackTargets(
+        Player* opponent) const;
 
     //! Takes damage from a certain other entity.
     //! \param source An entity to give damage.
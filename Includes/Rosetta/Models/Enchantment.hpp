@@ -31,6 +31,13 @@ class Enchantment : public Playable
     Enchantment(Player* player, Card* card, std::map<GameTag, int> tags,
                 Entity* target, int id);
 
+    //! Constructs enchantment with given \p player, \p rhs of another game
+    //! and \p target.
+    //! \param player The owner of the card.
+    //! \param rhs The enchantment to copy.
+    //! \param target A target of enchantment.
+    Enchantment(Player* player, const Enchantment& rhs, Entity* target);
+
     //! Default destructor.
     ~Enchantment() = default;
 
@@ -46,6 +53,21 @@ class Enchantment : public Playable
     //! Deleted move assignment operator.
     Enchantment& operator=(Enchantment&&) noexcept = delete;
 
+    //! Returns a value indicating whether an entity of \p kind is Enchantment.
+    //! \param kind The kind of entity.
+    //! \return true if an entity of \p kind is Enchantment, false otherwise.
+    static constexpr bool IsKindOf(EntityKind kind)
+    {
+        return kind == EntityKind::ENCHANTMENT;
+    }
+
+    //! Creates a copy of this entity for the owner of a cloned game.
+    //! Triggers, auras and links to other entities are fixed up by
+    //! Game::Clone().
+    //! \param context The context that maps entities to the cloned game.
+    //! \return A pointer to the copy that is allocated dynamically.
+    Playable* Clone(const CloneContext& context) const override;
+
     //! Creates and adds a new Enchantment to the given player's game.
     //! \param player The controller of the enchantment.
     //! \param card The card from which the enchantment must be derived.
@@ -8,12 +8,16 @@
 #define ROSETTASTONE_ENTITY_HPP
 
 #include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Commons/Arena.hpp>
+#include <Rosetta/Commons/GameTagStore.hpp>
 #include <Rosetta/Enchants/AuraEffects.hpp>
+#include <Rosetta/Enums/GameEnums.hpp>
 #include <Rosetta/Managers/CostManager.hpp>
 #include <Rosetta/Zones/IZone.hpp>
 
 #include <map>
 #include <optional>
+#include <type_traits>
 
 namespace RosettaStone
 {
@@ -29,7 +33,7 @@ class Enchantment;
 //! visible or invisible objects in a RosettaStone.
 //! An entity is defined as a collection of properties, called GameTags.
 //!
-class Entity
+class Entity : public ArenaObject
 {
  public:
     //! Default constructor.
@@ -43,6 +47,12 @@ class Entity
     Entity(Game* _game, Card* _card, std::map<GameTag, int> _tags,
            int _id = -1);
 
+    //! Constructs entity with given \p _game and \p rhs of another game.
+    //! It copies the card, the ID and the game tags.
+    //! \param _game The game.
+    //! \param rhs The entity to copy.
+    Entity(Game* _game, const Entity& rhs);
+
     //! Destructor.
     virtual ~Entity();
 
@@ -58,9 +68,24 @@ class Entity
     //! Deleted move assignment operator.
     Entity& operator=(Entity&&) noexcept = delete;
 
-    //! Returns a list of game tag.
-    //! \return A list of game tag.
-    std::map<GameTag, int> GetGameTags() const;
+    //! Returns the kind of the entity, the concrete class of it.
+    //! \return The kind of the entity.
+    EntityKind GetKind() const
+    {
+        return m_kind;
+    }
+
+    //! Returns a value indicating whether an entity of \p kind is Entity.
+    //! \param kind The kind of entity.
+    //! \return true for all kinds.
+    static constexpr bool IsKindOf([[maybe_unused]] EntityKind kind)
+    {
+        return true;
+    }
+
+    //! Returns the game tags that are stored in the entity.
+    //! \return The game tags that are stored in the entity.
+    const GameTagStore& GetGameTags() const;
 
     //! Returns the value of game tag.
     //! \param tag The game tag of card.
@@ -72,6 +97,13 @@ class Entity
     //! \param value The value to set for game tag.
     virtual void SetGameTag(GameTag tag, int value);
 
+    //! Marks that the game tags or the aura effects of the entity are changed.
+    void MarkChanged();
+
+    //! Returns the state version of the game at the last change of the entity.
+    //! \return The state version of the game at the last change.
+    std::size_t GetVersion() const;
+
     //! Returns the value of card target.
     //! \return The value of card target.
     int GetCardTarget() const;
@@ -107,8 +139,36 @@ class Entity
     int id = 0;
 
  protected:
-    std::map<GameTag, int> m_gameTags;
+    GameTagStore m_gameTags;
+    std::size_t m_version = 0;
+    EntityKind m_kind = EntityKind::INVALID;
 };
+
+//! Casts \p entity to \p T using the kind of the entity. Each class of
+//! entity has IsKindOf() that accepts the kinds of its concrete classes, so
+//! the kind is checked before static_cast. It is used instead of
+//! dynamic_cast on the hot paths of the game.
+//! \param entity The entity to cast.
+//! \return A pointer to \p T, or nullptr if \p entity is nullptr or is not
+//! \p T.
+template <typename T, typename U>
+T* EntityCast(U* entity)
+{
+    using From = std::remove_const_t<U>;
+    using To = std::remove_const_t<T>;
+
+    static_assert(std::is_base_of_v<Entity, From>,
+                  "The type to cast must be an entity");
+    static_assert(std::is_base_of_v<From, To>,
+                  "The type to cast to must derive from the type to cast");
+
+    if (entity == nullptr || !To::IsKindOf(entity->GetKind()))
+    {
+        return nullptr;
+    }
+
+    return static_cast<T*>(entity);
+}
 }  // namespace RosettaStone
 
 #endif  // ROSETTASTONE_ENTITY_HPP
@@ -29,6 +29,11 @@ class Hero : public Character
     //! \param id The ID.
     Hero(Player* player, Card* card, std::map<GameTag, int> tags, int id = -1);
 
+    //! Constructs hero with given \p player and \p rhs of another game.
+    //! \param player The owner of the card.
+    //! \param rhs The hero to copy.
+    Hero(Player* player, const Hero& rhs);
+
     //! Default destructor.
     ~Hero();
 
@@ -44,6 +49,21 @@ class Hero : public Character
     //! Deleted move assignment operator.
     Hero& operator=(Hero&&) noexcept = delete;
 
+    //! Returns a value indicating whether an entity of \p kind is Hero.
+    //! \param kind The kind of entity.
+    //! \return true if an entity of \p kind is Hero, false otherwise.
+    static constexpr bool IsKindOf(EntityKind kind)
+    {
+        return kind == EntityKind::HERO;
+    }
+
+    //! Creates a copy of this entity for the owner of a cloned game.
+    //! Triggers, auras and links to other entities are fixed up by
+    //! Game::Clone().
+    //! \param context The context that maps entities to the cloned game.
+    //! \return A pointer to the copy that is allocated dynamically.
+    Playable* Clone(const CloneContext& context) const override;
+
     //! Returns the value of attack.
     //! \return The value of attack.
     int GetAttack() const override;
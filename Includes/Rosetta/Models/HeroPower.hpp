@@ -27,6 +27,11 @@ class HeroPower : public Playable
     HeroPower(Player* player, Card* card, std::map<GameTag, int> tags,
               int id = -1);
 
+    //! Constructs hero power with given \p player and \p rhs of another game.
+    //! \param player The owner of the card.
+    //! \param rhs The hero power to copy.
+    HeroPower(Player* player, const HeroPower& rhs);
+
     //! Default destructor.
     ~HeroPower() = default;
 
@@ -42,6 +47,21 @@ class HeroPower : public Playable
     //! Deleted move assignment operator.
     HeroPower& operator=(HeroPower&&) noexcept = delete;
 
+    //! Returns a value indicating whether an entity of \p kind is HeroPower.
+    //! \param kind The kind of entity.
+    //! \return true if an entity of \p kind is HeroPower, false otherwise.
+    static constexpr bool IsKindOf(EntityKind kind)
+    {
+        return kind == EntityKind::HERO_POWER;
+    }
+
+    //! Creates a copy of this entity for the owner of a cloned game.
+    //! Triggers, auras and links to other entities are fixed up by
+    //! Game::Clone().
+    //! \param context The context that maps entities to the cloned game.
+    //! \return A pointer to the copy that is allocated dynamically.
+    Playable* Clone(const CloneContext& context) const override;
+
     //! Calculates if a target is valid by testing the game state for each
     //! hardcoded requirement.
     //! \param target The proposed target.
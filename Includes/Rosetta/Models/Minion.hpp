@@ -27,6 +27,11 @@ class Minion : public Character
     Minion(Player* player, Card* card, std::map<GameTag, int> tags,
            int id = -1);
 
+    //! Constructs minion with given \p player and \p rhs of another game.
+    //! \param player The owner of the card.
+    //! \param rhs The minion to copy.
+    Minion(Player* player, const Minion& rhs);
+
     //! Default destructor.
     ~Minion() = default;
 
@@ -42,6 +47,21 @@ class Minion : public Character
     //! Deleted move assignment operator.
     Minion& operator=(Minion&&) noexcept = delete;
 
+    //! Returns a value indicating whether an entity of \p kind is Minion.
+    //! \param kind The kind of entity.
+    //! \return true if an entity of \p kind is Minion, false otherwise.
+    static constexpr bool IsKindOf(EntityKind kind)
+    {
+        return kind == EntityKind::MINION;
+    }
+
+    //! Creates a copy of this entity for the owner of a cloned game.
+    //! Triggers, auras and links to other entities are fixed up by
+    //! Game::Clone().
+    //! \param context The context that maps entities to the cloned game.
+    //! \return A pointer to the copy that is allocated dynamically.
+    Playable* Clone(const CloneContext& context) const override;
+
     //! Returns the value of last board position.
     //! \return The value of last board position.
     int GetLastBoardPos() const;
@@ -14,6 +14,7 @@
 namespace RosettaStone
 {
 class Character;
+struct CloneContext;
 
 //!
 //! \brief Playable class.
@@ -32,9 +33,29 @@ class Playable : public Entity
     Playable(Player* _player, Card* _card, std::map<GameTag, int> _tags,
              int _id);
 
+    //! Constructs entity with given \p _player and \p rhs of another game.
+    //! \param _player The player.
+    //! \param rhs The entity to copy.
+    Playable(Player* _player, const Playable& rhs);
+
     //! Destructor.
     virtual ~Playable();
 
+    //! Returns a value indicating whether an entity of \p kind is Playable.
+    //! \param kind The kind of entity.
+    //! \return true if an entity of \p kind is Playable, false otherwise.
+    static constexpr bool IsKindOf(EntityKind kind)
+    {
+        return kind != EntityKind::INVALID && kind != EntityKind::PLAYER;
+    }
+
+    //! Creates a copy of this entity for the owner of a cloned game.
+    //! Triggers, auras and links to other entities are fixed up by
+    //! Game::Clone().
+    //! \param context The context that maps entities to the cloned game.
+    //! \return A pointer to the copy that is allocated dynamically.
+    virtual Playable* Clone(const CloneContext& context) const = 0;
+
     //! Returns the value of zone type.
     //! \return The value of zone type.
     ZoneType GetZoneType() const;
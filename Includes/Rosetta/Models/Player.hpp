@@ -56,10 +56,24 @@ class Player : public Entity
     //! Default move assignment operator.
     Player& operator=(Player&&) noexcept = delete;
 
+    //! Returns a value indicating whether an entity of \p kind is Player.
+    //! \param kind The kind of entity.
+    //! \return true if an entity of \p kind is Player, false otherwise.
+    static constexpr bool IsKindOf(EntityKind kind)
+    {
+        return kind == EntityKind::PLAYER;
+    }
+
     //! Copies the contents from reference \p rhs.
     //! \param rhs The source to copy the content.
     void RefCopy(const Player& rhs);
 
+    //! Copies the contents from \p rhs of another game. The hero, the zones
+    //! and the other entities refer to the ones of the cloned game.
+    //! \param rhs The source to copy the content.
+    //! \param context The context that maps entities to the cloned game.
+    void CloneFrom(const Player& rhs, const CloneContext& context);
+
     //! Returns player's field zone.
     //! \return Player's field zone.
     FieldZone* GetFieldZone() const;
@@ -26,6 +26,11 @@ class Spell : public Playable
     //! \param id The card ID.
     Spell(Player* player, Card* card, std::map<GameTag, int> tags, int id = -1);
 
+    //! Constructs spell with given \p player and \p rhs of another game.
+    //! \param player The owner of the card.
+    //! \param rhs The spell to copy.
+    Spell(Player* player, const Spell& rhs);
+
     //! Default destructor.
     ~Spell() = default;
 
@@ -41,6 +46,21 @@ class Spell : public Playable
     //! Deleted move assignment operator.
     Spell& operator=(Spell&&) noexcept = delete;
 
+    //! Returns a value indicating whether an entity of \p kind is Spell.
+    //! \param kind The kind of entity.
+    //! \return true if an entity of \p kind is Spell, false otherwise.
+    static constexpr bool IsKindOf(EntityKind kind)
+    {
+        return kind == EntityKind::SPELL;
+    }
+
+    //! Creates a copy of this entity for the owner of a cloned game.
+    //! Triggers, auras and links to other entities are fixed up by
+    //! Game::Clone().
+    //! \param context The context that maps entities to the cloned game.
+    //! \return A pointer to the copy that is allocated dynamically.
+    Playable* Clone(const CloneContext& context) const override;
+
     //! Gets the value of quest progress.
     //! \return The value of quest progress.
     int GetQuestProgress() const;
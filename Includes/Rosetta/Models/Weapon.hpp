@@ -29,6 +29,11 @@ class Weapon : public Playable
     Weapon(Player* player, Card* card, std::map<GameTag, int> tags,
            int id = -1);
 
+    //! Constructs weapon with given \p player and \p rhs of another game.
+    //! \param player The owner of the card.
+    //! \param rhs The weapon to copy.
+    Weapon(Player* player, const Weapon& rhs);
+
     //! Destructor.
     ~Weapon();
 
@@ -44,6 +49,21 @@ class Weapon : public Playable
     //! Deleted move assignment operator.
     Weapon& operator=(Weapon&&) noexcept = delete;
 
+    //! Returns a value indicating whether an entity of \p kind is Weapon.
+    //! \param kind The kind of entity.
+    //! \return true if an entity of \p kind is Weapon, false otherwise.
+    static constexpr bool IsKindOf(EntityKind kind)
+    {
+        return kind == EntityKind::WEAPON;
+    }
+
+    //! Creates a copy of this entity for the owner of a cloned game.
+    //! Triggers, auras and links to other entities are fixed up by
+    //! Game::Clone().
+    //! \param context The context that maps entities to the cloned game.
+    //! \return A pointer to the copy that is allocated dynamically.
+    Playable* Clone(const CloneContext& context) const override;
+
     //! Returns the value of attack.
     //! \return The value of attack.
     int GetAttack() const;
@@ -23,6 +23,7 @@
 #include <Rosetta/Actions/Choose.hpp>
 #include <Rosetta/Actions/Copy.hpp>
 #include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Actions/EncodedAction.hpp>
 #include <Rosetta/Actions/Generic.hpp>
 #include <Rosetta/Actions/PlayCard.hpp>
 #include <Rosetta/Actions/Summon.hpp>
@@ -46,11 +47,15 @@
 #include <Rosetta/Cards/CardDef.hpp>
 #include <Rosetta/Cards/CardDefs.hpp>
 #include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/Arena.hpp>
 #include <Rosetta/Commons/Constants.hpp>
 #include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Commons/FixedVector.hpp>
+#include <Rosetta/Commons/GameTagStore.hpp>
 #include <Rosetta/Commons/JSONSerializer.hpp>
 #include <Rosetta/Commons/Macros.hpp>
 #include <Rosetta/Commons/PriorityQueue.hpp>
+#include <Rosetta/Commons/RandomGenerator.hpp>
 #include <Rosetta/Commons/SpinLocks.hpp>
 #include <Rosetta/Commons/Utils.hpp>
 #include <Rosetta/Conditions/RelaCondition.hpp>
@@ -83,10 +88,13 @@
 #include <Rosetta/Enums/TargetingEnums.hpp>
 #include <Rosetta/Enums/TaskEnums.hpp>
 #include <Rosetta/Enums/TriggerEnums.hpp>
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Games/GameConfig.hpp>
 #include <Rosetta/Games/GameRestorer.hpp>
+#include <Rosetta/Games/VectorEnv.hpp>
 #include <Rosetta/Loaders/AccountLoader.hpp>
+#include <Rosetta/Loaders/CardImage.hpp>
 #include <Rosetta/Loaders/CardLoader.hpp>
 #include <Rosetta/Loaders/InternalCardLoader.hpp>
 #include <Rosetta/Loaders/TargetingPredicates.hpp>
@@ -185,11 +193,13 @@
 #include <Rosetta/Views/Board.hpp>
 #include <Rosetta/Views/BoardRefView.hpp>
 #include <Rosetta/Views/BoardView.hpp>
+#include <Rosetta/Views/FeatureEncoder.hpp>
 #include <Rosetta/Views/ReducedBoardView.hpp>
 #include <Rosetta/Views/Types/CardInfo.hpp>
 #include <Rosetta/Views/Types/Player.hpp>
 #include <Rosetta/Views/Types/UnknownCards.hpp>
 #include <Rosetta/Views/ViewTypes.hpp>
+#include <Rosetta/Views/ZobristHash.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
 #include <Rosetta/Zones/FieldZone.hpp>
 #include <Rosetta/Zones/GraveyardZone.hpp>
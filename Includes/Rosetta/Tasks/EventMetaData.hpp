@@ -9,12 +9,16 @@
 
 #include <Rosetta/Models/Playable.hpp>
 
+#include <cstddef>
+
 namespace RosettaStone
 {
 //!
 //! \brief EventMetaData struct.
 //!
-//! This struct is temporary meta data for event.
+//! This struct is temporary meta data for event. It is created for every
+//! attack, damage and summon, so the memory of deleted ones is kept in a free
+//! list of the thread and reused instead of going back to the heap.
 //!
 struct EventMetaData
 {
@@ -32,6 +36,16 @@ struct EventMetaData
         // Do nothing
     }
 
+    //! Allocates memory from the free list of the thread or the heap.
+    //! \param size The size of memory in bytes.
+    //! \return A pointer to the allocated memory.
+    static void* operator new(std::size_t size);
+
+    //! Returns memory to the free list of the thread.
+    //! \param ptr A pointer to the memory.
+    //! \param size The size of memory in bytes.
+    static void operator delete(void* ptr, std::size_t size) noexcept;
+
     Playable* eventSource = nullptr;
     Playable* eventTarget = nullptr;
     int eventNumber = 0;
@@ -7,6 +7,7 @@
 #ifndef ROSETTASTONE_ITASK_HPP
 #define ROSETTASTONE_ITASK_HPP
 
+#include <Rosetta/Commons/Arena.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Tasks/TaskStatus.hpp>
 
@@ -18,7 +19,7 @@ namespace RosettaStone
 //! This class is interface of various task classes.
 //! All classes that inherit from it must implement GetTaskID and Impl methods.
 //!
-class ITask
+class ITask : public ArenaObject
 {
  public:
     template <typename T>
@@ -6,6 +6,7 @@
 #ifndef ROSETTASTONE_DISCOVER_TASK_HPP
 #define ROSETTASTONE_DISCOVER_TASK_HPP
 
+#include <Rosetta/Commons/RandomGenerator.hpp>
 #include <Rosetta/Enums/DiscoverEnums.hpp>
 #include <Rosetta/Tasks/ITask.hpp>
 
@@ -39,9 +40,11 @@ class DiscoverTask : public ITask
                           ChoiceAction choiceAction = ChoiceAction::HAND);
 
     //! Gets cards to choose from the sets.
+    //! \param random The random generator to choose cards.
     //! \param cardsToDiscover A list of cards to discover.
     //! \param numberOfChoices The number of choices.
-    std::vector<Card*> GetChoices(std::vector<Card*> cardsToDiscover,
+    std::vector<Card*> GetChoices(RandomGenerator& random,
+                                  std::vector<Card*> cardsToDiscover,
                                   std::size_t numberOfChoices);
 
  private:
@@ -28,9 +28,13 @@ class TaskQueue
     //! \return The current queue.
     std::queue<std::unique_ptr<ITask>>& GetCurrentQueue();
 
+    //! Returns the current queue.
+    //! \return The current queue.
+    const std::queue<std::unique_ptr<ITask>>& GetCurrentQueue() const;
+
     //! Returns flag that indicates task queue is empty.
     //! \return Flag that indicates task queue is empty.
-    bool IsEmpty();
+    bool IsEmpty() const;
 
     //! Starts the event.
     void StartEvent();
@@ -45,6 +45,11 @@ class Board
     //! \return The reduced board view that is created for the player type.
     ReducedBoardView CreateView() const;
 
+    //! Returns the Zobrist hash of the reduced board view for the player type
+    //! without creating the view.
+    //! \return The hash of the board for the player type.
+    std::uint64_t GetHash() const;
+
     //! Returns the board ref view for the current player.
     //! \return The board ref view for the current player.
     CurrentPlayerBoardRefView GetCurPlayerStateRefView() const;
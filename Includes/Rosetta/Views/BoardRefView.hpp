@@ -41,6 +41,10 @@ class BoardRefView
     //! \return The current player of the game.
     PlayerType GetCurrentPlayer() const;
 
+    //! Returns the Zobrist hash of the reduced board view of the side.
+    //! \return The hash of the board for the side.
+    std::uint64_t GetHash() const;
+
     //! Returns the fatigue damage of the player in the current status.
     //! \param playerType The player type to separate players.
     //! \return The fatigue damage of the player in the current status.
@@ -137,7 +141,7 @@ class BoardRefView
                              ? m_game.GetPlayer1()->GetFieldZone()
                              : m_game.GetPlayer2()->GetFieldZone();
 
-        for (auto& minion : fieldZone->GetAll())
+        for (auto& minion : fieldZone->GetView())
         {
             functor(minion);
         }
@@ -152,7 +156,7 @@ class BoardRefView
                             ? m_game.GetPlayer1()->GetHandZone()
                             : m_game.GetPlayer2()->GetHandZone();
 
-        for (auto& entity : handZone->GetAll())
+        for (auto& entity : handZone->GetView())
         {
             functor(entity->card->id);
         }
@@ -167,7 +171,7 @@ class BoardRefView
                             ? m_game.GetPlayer2()->GetHandZone()
                             : m_game.GetPlayer1()->GetHandZone();
 
-        for (auto& entity : handZone->GetAll())
+        for (auto& entity : handZone->GetView())
         {
             std::string cardID = entity->card->id;
             if (cardID == "GAME_005")
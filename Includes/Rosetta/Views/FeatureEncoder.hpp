@@ -0,0 +1,79 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_FEATURE_ENCODER_HPP
+#define ROSETTASTONE_FEATURE_ENCODER_HPP
+
+#include <Rosetta/Games/Game.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace RosettaStone
+{
+//!
+//! \brief FeatureEncoder class.
+//!
+//! This class writes the features of a game seen by the current player to
+//! a float buffer in one pass. A state takes NUM_FEATURES floats that are
+//! laid out in three blocks:
+//!   - Hero: the health plus armor of the current and the opponent hero.
+//!   - Minion: 7 features of 7 minions of the current and the opponent
+//!     player. Empty slots are filled with placeholders.
+//!   - Standalone: mana, hand and hero power of the current player and the
+//!     hand count of the opponent player.
+//! The layout changes only together with VERSION. A batch of N states is a
+//! row-major [N, NUM_FEATURES] buffer, so it can be viewed as a tensor or
+//! an array without copying.
+//!
+class FeatureEncoder
+{
+ public:
+    //! The version of the layout.
+    static constexpr int VERSION = 1;
+
+    static constexpr std::size_t NUM_MAX_MINIONS = 7;
+    static constexpr std::size_t NUM_MINION_FEATURES = 7;
+    static constexpr std::size_t NUM_MAX_HAND_CARDS = 10;
+
+    static constexpr std::size_t HERO_OFFSET = 0;
+    static constexpr std::size_t HERO_SIZE = 2;
+    static constexpr std::size_t MINION_OFFSET = HERO_OFFSET + HERO_SIZE;
+    static constexpr std::size_t MINION_SIZE =
+        2 * NUM_MAX_MINIONS * NUM_MINION_FEATURES;
+    static constexpr std::size_t STANDALONE_OFFSET =
+        MINION_OFFSET + MINION_SIZE;
+    static constexpr std::size_t STANDALONE_SIZE = 7 + NUM_MAX_HAND_CARDS;
+
+    //! The number of features of a state.
+    static constexpr std::size_t NUM_FEATURES =
+        STANDALONE_OFFSET + STANDALONE_SIZE;
+
+    //! Writes the features of \p game to \p data.
+    //! \param game The game context.
+    //! \param data The buffer that has room for NUM_FEATURES floats.
+    static void Encode(const Game& game, float* data);
+
+    //! Writes the features of \p games to \p data row by row.
+    //! \param games The game contexts.
+    //! \param data The buffer that has room for
+    //! games.size() * NUM_FEATURES floats.
+    static void Encode(const std::vector<const Game*>& games, float* data);
+
+ private:
+    //! Writes the features of the minions of \p player to \p data.
+    //! \param player The player that owns the minions.
+    //! \param data The buffer to write the features.
+    static void EncodeMinions(const Player* player, float* data);
+
+    //! Writes the standalone features of \p game to \p data.
+    //! \param game The game context.
+    //! \param data The buffer to write the features.
+    static void EncodeStandalone(const Game& game, float* data);
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_FEATURE_ENCODER_HPP
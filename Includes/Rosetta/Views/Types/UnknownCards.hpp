@@ -10,6 +10,8 @@
 #ifndef ROSETTASTONE_VIEWS_TYPES_UNKNOWN_CARDS_HPP
 #define ROSETTASTONE_VIEWS_TYPES_UNKNOWN_CARDS_HPP
 
+#include <Rosetta/Commons/RandomGenerator.hpp>
+
 #include <map>
 #include <string>
 #include <vector>
@@ -155,7 +157,8 @@ class UnknownCardsSetsManager
     void Setup(UnknownCardsSets& data);
 
     //! Prepares the unknown cards sets manager.
-    void Prepare();
+    //! \param random The random generator to choose unknown cards.
+    void Prepare(RandomGenerator& random);
 
     //! Returns the card ID in a set of unknown cards.
     //! \param setIdx The index of unknown cards set.
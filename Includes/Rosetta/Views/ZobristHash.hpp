@@ -0,0 +1,100 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef ROSETTASTONE_ZOBRIST_HASH_HPP
+#define ROSETTASTONE_ZOBRIST_HASH_HPP
+
+#include <Rosetta/Games/Game.hpp>
+
+#include <cstdint>
+
+namespace RosettaStone
+{
+//!
+//! \brief ZobristHash class.
+//!
+//! This class computes a 64-bit Zobrist hash of the game seen by a player.
+//! It covers the same fields as ReducedBoardView, so the games that have
+//! equal reduced board views have the same hash. The fields are read from
+//! the game directly, so no card ID is copied and no view is built.
+//! Each field contributes a key that is derived from the field, its slot
+//! and its value, and the keys are combined with XOR. A change of a field
+//! can be applied to a hash by XORing the old and the new key.
+//!
+class ZobristHash
+{
+ public:
+    //! The fields of the hash.
+    enum class Field : std::uint8_t
+    {
+        TURN,
+        SIDE,
+        HERO_ATTACK,
+        HERO_HEALTH,
+        HERO_ARMOR,
+        HERO_STEALTH,
+        HERO_IMMUNE,
+        HERO_ATTACKABLE,
+        HERO_POWER_CARD,
+        HERO_POWER_EXHAUSTED,
+        WEAPON_CARD,
+        WEAPON_ATTACK,
+        WEAPON_DURABILITY,
+        MANA_REMAINING,
+        MANA_TOTAL,
+        MANA_OVERLOAD_OWED,
+        MANA_OVERLOAD_LOCKED,
+        MINION_COUNT,
+        MINION_CARD,
+        MINION_ATTACK,
+        MINION_HEALTH,
+        MINION_SILENCED,
+        MINION_TAUNT,
+        MINION_CANT_ATTACK_HEROES,
+        MINION_STEALTH,
+        MINION_IMMUNE,
+        MINION_ATTACKABLE,
+        HAND_COUNT,
+        HAND_CARD,
+        HAND_COST,
+        HAND_ATTACK,
+        HAND_HEALTH,
+        DECK_COUNT
+    };
+
+    //! Returns the hash of \p game seen by \p playerType.
+    //! \param game The game context.
+    //! \param playerType The player who sees the game.
+    //! \return The hash of the game.
+    static std::uint64_t Compute(const Game& game, PlayerType playerType);
+
+    //! Returns the key of \p value of \p field at \p slot.
+    //! \param field The field of the hash.
+    //! \param slot The slot of the field, e.g. the side and the position of
+    //! a minion.
+    //! \param value The value of the field.
+    //! \return The key of the value.
+    static std::uint64_t GetKey(Field field, std::uint32_t slot,
+                                std::uint64_t value);
+
+    //! Returns the value of the card that is used for the key. It is the
+    //! FNV-1a hash of the card ID, so it doesn't depend on the platform.
+    //! \param card The card.
+    //! \return The value of the card.
+    static std::uint64_t GetCardValue(const Card* card);
+
+ private:
+    //! Adds the keys of the player of \p player to \p hash.
+    //! \param player The player to add.
+    //! \param side The slot of the side, 0 for the player who sees the game
+    //! and 1 for the opponent player.
+    //! \param hash The hash to add the keys.
+    static void AddPlayer(const Player* player, std::uint32_t side,
+                          std::uint64_t& hash);
+};
+}  // namespace RosettaStone
+
+#endif  // ROSETTASTONE_ZOBRIST_HASH_HPP
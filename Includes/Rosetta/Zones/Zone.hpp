@@ -7,10 +7,14 @@
 #define ROSETTASTONE_ZONE_HPP
 
 #include <Rosetta/Auras/Aura.hpp>
+#include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Commons/FixedVector.hpp>
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Zones/IZone.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <stdexcept>
 
 namespace RosettaStone
@@ -173,6 +177,19 @@ class UnlimitedZone : public Zone<Playable>
         return m_entities.size();
     }
 
+    //! Moves the entities of the cloned game corresponding to the ones in
+    //! \p rhs to this zone in the same order. Unlike Add(), it doesn't
+    //! notify any aura.
+    //! \param rhs The zone of the source game.
+    //! \param context The context that maps entities to the cloned game.
+    void CloneFrom(const UnlimitedZone& rhs, const CloneContext& context)
+    {
+        for (auto& entity : rhs.m_entities)
+        {
+            MoveTo(context.Get<Playable>(entity), -1);
+        }
+    }
+
     //! Returns a value indicating whether this zone is full.
     //! \return true if this zone is full, false otherwise.
     bool IsFull() const override
@@ -195,6 +212,114 @@ class UnlimitedZone : public Zone<Playable>
     std::vector<Playable*> m_entities;
 };
 
+//!
+//! \brief ZoneView class.
+//!
+//! This class is a view of the entities of a limited zone that are not
+//! destroyed. Destroyed entities are skipped while iterating, so it doesn't
+//! copy anything. The zone must not be changed while it is iterated; use
+//! LimitedZone::GetAll() to iterate over a snapshot in that case.
+//!
+template <typename T>
+class ZoneView
+{
+ public:
+    //!
+    //! \brief Iterator class.
+    //!
+    //! This class is a forward iterator that skips destroyed entities.
+    //!
+    class Iterator
+    {
+     public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T*;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T* const*;
+        using reference = T* const&;
+
+        //! Constructs iterator with given \p cur and \p end.
+        //! \param cur The current position.
+        //! \param end The end position.
+        Iterator(T* const* cur, T* const* end) : m_cur(cur), m_end(end)
+        {
+            Skip();
+        }
+
+        //! Operator overloading for operator*.
+        //! \return The current entity.
+        T* const& operator*() const
+        {
+            return *m_cur;
+        }
+
+        //! Operator overloading for prefix operator++.
+        //! \return The iterator to the next entity.
+        Iterator& operator++()
+        {
+            ++m_cur;
+            Skip();
+            return *this;
+        }
+
+        //! Operator overloading for operator==.
+        //! \param rhs The iterator to compare.
+        //! \return true if both point the same position, false otherwise.
+        bool operator==(const Iterator& rhs) const
+        {
+            return m_cur == rhs.m_cur;
+        }
+
+        //! Operator overloading for operator!=.
+        //! \param rhs The iterator to compare.
+        //! \return true if both point different positions, false otherwise.
+        bool operator!=(const Iterator& rhs) const
+        {
+            return m_cur != rhs.m_cur;
+        }
+
+     private:
+        //! Moves to the first entity that is not destroyed.
+        void Skip()
+        {
+            while (m_cur != m_end && (*m_cur == nullptr ||
+                                      static_cast<bool>((*m_cur)->isDestroyed)))
+            {
+                ++m_cur;
+            }
+        }
+
+        T* const* m_cur;
+        T* const* m_end;
+    };
+
+    //! Constructs zone view with given \p first and \p last.
+    //! \param first The first entity of the zone.
+    //! \param last The position past the last entity of the zone.
+    ZoneView(T* const* first, T* const* last) : m_first(first), m_last(last)
+    {
+        // Do nothing
+    }
+
+    //! Returns an iterator to the first entity.
+    //! \return An iterator to the first entity.
+    Iterator begin() const
+    {
+        return Iterator(m_first, m_last);
+    }
+
+    //! Returns an iterator past the last entity.
+    //! \return An iterator past the last entity.
+    Iterator end() const
+    {
+        return Iterator(m_last, m_last);
+    }
+
+ private:
+    T* const* m_first;
+    T* const* m_last;
+};
+
 //!
 //! \brief LimitedZone class.
 //!
@@ -204,12 +329,22 @@ template <typename T = Playable>
 class LimitedZone : public Zone<T>
 {
  public:
+    //! The list of entities that GetAll() returns. The capacity is the size
+    //! of the largest zone, so it never allocates memory.
+    using Entities = FixedVector<T*, MAX_DECK_SIZE>;
+
     //! Constructs limited zone with given \p type and \p size.
     //! \param type The type of zone.
     //! \param maxSize The maximum size of zone.
     explicit LimitedZone(ZoneType type, int maxSize)
         : Zone<T>(type), m_maxSize(maxSize)
     {
+        if (m_maxSize > static_cast<int>(Entities::capacity()))
+        {
+            throw std::logic_error(
+                "LimitedZone::LimitedZone() - The size of zone is too big!");
+        }
+
         m_entities = new T*[m_maxSize];
 
         for (int i = 0; i < m_maxSize; ++i)
@@ -281,7 +416,7 @@ class LimitedZone : public Zone<T>
         int pos;
         for (pos = m_count - 1; pos >= 0; --pos)
         {
-            if (entity == dynamic_cast<Playable*>(m_entities[pos]))
+            if (entity == m_entities[pos])
             {
                 break;
             }
@@ -333,8 +468,8 @@ class LimitedZone : public Zone<T>
 
         ++m_count;
 
-        dynamic_cast<Playable*>(entity)->zone = this;
-        dynamic_cast<Playable*>(entity)->SetZoneType(Zone<T>::m_type);
+        entity->zone = this;
+        entity->SetZoneType(Zone<T>::m_type);
     }
 
     //! Returns the number of entities in this zone.
@@ -344,6 +479,19 @@ class LimitedZone : public Zone<T>
         return m_count;
     }
 
+    //! Moves the entities of the cloned game corresponding to the ones in
+    //! \p rhs to this zone in the same order. Unlike Add(), it doesn't
+    //! notify any aura.
+    //! \param rhs The zone of the source game.
+    //! \param context The context that maps entities to the cloned game.
+    void CloneFrom(const LimitedZone& rhs, const CloneContext& context)
+    {
+        for (int i = 0; i < rhs.m_count; ++i)
+        {
+            MoveTo(context.Get<T>(rhs.m_entities[i]));
+        }
+    }
+
     //! Returns a value indicating whether this zone is full.
     //! \return true if this zone is full, false otherwise.
     bool IsFull() const override
@@ -351,46 +499,27 @@ class LimitedZone : public Zone<T>
         return m_count == m_maxSize;
     }
 
-    //! Returns all entities in this zone (non-const).
+    //! Returns a snapshot of all entities in this zone that are not
+    //! destroyed. It is safe to change the zone while iterating over it.
     //! \return All entities in this zone.
-    virtual std::vector<T*> GetAll()
+    virtual Entities GetAll() const
     {
-        std::vector<T*> result;
-        result.reserve(m_count);
+        Entities result;
 
-        for (int i = 0; i < m_count; ++i)
+        for (T* entity : GetView())
         {
-            if (m_entities[i] == nullptr ||
-                static_cast<bool>(m_entities[i]->isDestroyed))
-            {
-                continue;
-            }
-
-            result.emplace_back(m_entities[i]);
+            result.push_back(entity);
         }
 
         return result;
     }
 
-    //! Returns all entities in this zone (const).
-    //! \return All entities in this zone.
-    virtual std::vector<T*> GetAll() const
+    //! Returns a view of all entities in this zone that are not destroyed.
+    //! It doesn't copy, but the zone must not be changed while iterating.
+    //! \return A view of all entities in this zone.
+    ZoneView<T> GetView() const
     {
-        std::vector<T*> result;
-        result.reserve(m_count);
-
-        for (int i = 0; i < m_count; ++i)
-        {
-            if (m_entities[i] == nullptr ||
-                static_cast<bool>(m_entities[i]->isDestroyed))
-            {
-                continue;
-            }
-
-            result.emplace_back(m_entities[i]);
-        }
-
-        return result;
+        return ZoneView<T>(m_entities, m_entities + m_count);
     }
 
     //! Runs \p functor on each entity of the zone.
@@ -517,16 +646,14 @@ class PositioningZone : public LimitedZone<T>
     {
         if (zonePos < 0)
         {
-            dynamic_cast<Playable*>(
-                LimitedZone<T>::m_entities[LimitedZone<T>::m_count - 1])
+            LimitedZone<T>::m_entities[LimitedZone<T>::m_count - 1]
                 ->SetZonePosition(LimitedZone<T>::m_count - 1);
             return;
         }
 
         for (int i = LimitedZone<T>::m_count - 1; i >= zonePos; --i)
         {
-            dynamic_cast<Playable*>(LimitedZone<T>::m_entities[i])
-                ->SetZonePosition(i);
+            LimitedZone<T>::m_entities[i]->SetZonePosition(i);
         }
     }
 };
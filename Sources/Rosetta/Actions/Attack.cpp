@@ -48,7 +48,7 @@ void Attack(Player* player, Character* source, Character* target)
     }
 
     auto realTarget =
-        dynamic_cast<Character*>(player->game->currentEventData->eventTarget);
+        EntityCast<Character>(player->game->currentEventData->eventTarget);
 
     // Set game step to MAIN_COMBAT
     player->game->step = Step::MAIN_COMBAT;
@@ -100,7 +100,7 @@ void Attack(Player* player, Character* source, Character* target)
     }
 
     // Remove durability from weapon if hero attack
-    Hero* hero = dynamic_cast<Hero*>(source);
+    Hero* hero = EntityCast<Hero>(source);
     if (hero != nullptr && hero->weapon != nullptr &&
         hero->weapon->GetGameTag(GameTag::IMMUNE) == 0)
     {
@@ -110,14 +110,14 @@ Playable* Copy(Player* player, Playable* source, ZoneType targetZone,
 
             if (deathrattle)
             {
-                position = dynamic_cast<Minion*>(source)->GetLastBoardPos();
+                position = EntityCast<Minion>(source)->GetLastBoardPos();
                 if (position > player->GetFieldZone()->GetCount())
                 {
                     position = player->GetFieldZone()->GetCount();
                 }
             }
 
-            Summon(dynamic_cast<Minion*>(copiedEntity), position, source);
+            Summon(EntityCast<Minion>(copiedEntity), position, source);
             break;
         }
         case ZoneType::SETASIDE:
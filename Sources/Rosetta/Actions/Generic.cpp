@@ -15,6 +15,8 @@
 #include <Rosetta/Zones/SecretZone.hpp>
 #include <Rosetta/Zones/SetasideZone.hpp>
 
+#include <cmath>
+
 namespace RosettaStone::Generic
 {
 void TakeDamageToCharacter(Playable* source, Character* target, int amount,
@@ -31,7 +33,7 @@ void TakeDamageToCharacter(Playable* source, Character* target, int amount,
             amount *= static_cast<int>(std::pow(2.0, value));
         }
     }
-    else if (dynamic_cast<HeroPower*>(source))
+    else if (EntityCast<HeroPower>(source))
     {
         // TODO: Process GameTag::HEROPOWER_DAMAGE
     }
@@ -57,7 +59,7 @@ void AddEnchantment(Card* enchantmentCard, Playable* creator, Entity* target,
 {
     Power& power = enchantmentCard->power;
 
-    const auto playable = dynamic_cast<Playable*>(target);
+    const auto playable = EntityCast<Playable>(target);
     if (playable)
     {
         if (auto ongoingEnchant =
@@ -146,7 +148,7 @@ void ChangeManaCrystal(Player* player, int amount, bool fill)
 void TransformMinion(Player* player, Minion* oldMinion, Card* card)
 {
     const auto newMinion =
-        dynamic_cast<Minion*>(Entity::GetFromCard(player, card));
+        EntityCast<Minion>(Entity::GetFromCard(player, card));
     if (newMinion == nullptr)
     {
         return;
@@ -23,7 +23,7 @@ void PlayCard(Player* player, Playable* source, Character* target, int fieldPos,
     }
 
     // Check battlefield is full
-    if (dynamic_cast<Minion*>(source) != nullptr &&
+    if (EntityCast<Minion>(source) != nullptr &&
         player->GetFieldZone()->IsFull())
     {
         return;
@@ -80,25 +80,25 @@ void PlayCard(Player* player, Playable* source, Character* target, int fieldPos,
     {
         case CardType::HERO:
         {
-            const auto hero = dynamic_cast<Hero*>(source);
+            const auto hero = EntityCast<Hero>(source);
             PlayHero(player, hero, target, chooseOne);
             break;
         }
         case CardType::MINION:
         {
-            const auto minion = dynamic_cast<Minion*>(source);
+            const auto minion = EntityCast<Minion>(source);
             PlayMinion(player, minion, target, fieldPos, chooseOne);
             break;
         }
         case CardType::SPELL:
         {
-            const auto spell = dynamic_cast<Spell*>(source);
+            const auto spell = EntityCast<Spell>(source);
             PlaySpell(player, spell, target, chooseOne);
             break;
         }
         case CardType::WEAPON:
         {
-            const auto weapon = dynamic_cast<Weapon*>(source);
+            const auto weapon = EntityCast<Weapon>(source);
             PlayWeapon(player, weapon, target);
             break;
         }
@@ -127,7 +127,7 @@ void PlayHero(Player* player, Hero* hero, Character* target, int chooseOne)
     player->GetSetasideZone()->Add(oldHero);
     hero->weapon = oldHero->weapon;
     player->GetSetasideZone()->Add(oldHero->heroPower);
-    hero->heroPower = dynamic_cast<HeroPower*>(Entity::GetFromCard(
+    hero->heroPower = EntityCast<HeroPower>(Entity::GetFromCard(
         player, Cards::FindCardByDbfID(hero->GetGameTag(GameTag::HERO_POWER))));
     if (auto trigger = hero->heroPower->card->power.GetTrigger(); trigger)
     {
@@ -195,7 +195,7 @@ void PlayMinion(Player* player, Minion* minion, Character* target, int fieldPos,
 
         if (minion->GetCardTarget() != target->id)
         {
-            target = dynamic_cast<Character*>(
+            target = EntityCast<Character>(
                 minion->game->entityList[minion->GetCardTarget()]);
         }
     }
@@ -260,7 +260,7 @@ void PlaySpell(Player* player, Spell* spell, Character* target, int chooseOne)
 
             if (spell->GetCardTarget() == target->id)
             {
-                target = dynamic_cast<Character*>(
+                target = EntityCast<Character>(
                     spell->game->entityList[spell->GetCardTarget()]);
             }
         }
@@ -305,7 +305,7 @@ void PlayWeapon(Player* player, Weapon* weapon, Character* target)
 
         if (weapon->GetCardTarget() != target->id)
         {
-            target = dynamic_cast<Character*>(
+            target = EntityCast<Character>(
                 weapon->game->entityList[weapon->GetCardTarget()]);
         }
     }
@@ -28,7 +28,7 @@ void Summon(Minion* minion, int fieldPos, Entity* summoner)
     if (summoner != nullptr)
     {
         game->currentEventData = std::make_unique<EventMetaData>(
-            dynamic_cast<Playable*>(summoner), minion);
+            EntityCast<Playable>(summoner), minion);
     }
     game->triggerManager.OnAfterSummonTrigger(minion);
     game->ProcessTasks();
@@ -40,9 +40,9 @@ void Summon(Minion* minion, int fieldPos, Entity* summoner)
 void SummonReborn(Minion* minion)
 {
     const int zonePos = SummonTask::GetPosition(minion, SummonSide::RIGHT);
-    const auto copy = dynamic_cast<Minion*>(
-        Entity::GetFromCard(minion->player, minion->card, minion->GetGameTags(),
-                            minion->player->GetFieldZone()));
+    const auto copy = EntityCast<Minion>(Entity::GetFromCard(
+        minion->player, minion->card, minion->GetGameTags().ToMap(),
+        minion->player->GetFieldZone()));
 
     // When the minion is first destroyed, it loses the visual effect but
     // retains the keyword. The keyword is then functionally meaningless.
@@ -87,6 +87,13 @@ void AdaptiveCostEffect::Clone(Playable* clone)
     Activate(clone, true);
 }
 
+void AdaptiveCostEffect::CloneState(
+    [[maybe_unused]] IAura& clone,
+    [[maybe_unused]] CloneContext& context) const
+{
+    // Do nothing
+}
+
 AdaptiveCostEffect::AdaptiveCostEffect(AdaptiveCostEffect& prototype,
                                        Playable& owner)
 {
@@ -35,7 +35,7 @@ void AdaptiveEffect::Activate(Playable* owner, [[maybe_unused]] bool cloning)
 
     if (!m_isSwitching)
     {
-        if (const auto weapon = dynamic_cast<Weapon*>(owner); weapon)
+        if (const auto weapon = EntityCast<Weapon>(owner); weapon)
         {
             if (weapon->player->GetHero()->auraEffects != nullptr)
             {
@@ -57,29 +57,24 @@ void AdaptiveEffect::Update()
 {
     if (m_turnOn)
     {
-        int value;
-
-        if (m_isSwitching)
+        // Skips the update if nothing is changed since the last one.
+        Game* game = m_owner->game;
+        if (m_updatedVersion != 0 &&
+            m_updatedVersion == game->GetStateVersion())
         {
-            value = m_condition->Evaluate(m_owner) ? 1 : 0;
+            return;
+        }
 
-            if (value == m_lastValue)
-            {
-                return;
-            }
+        const int value = ComputeValue();
 
-            Effect(m_tag, m_operator, m_lastValue).RemoveFrom(m_owner);
-            Effect(m_tag, m_operator, value).ApplyTo(m_owner);
-        }
-        else
+        if (!m_isSwitching || value != m_lastValue)
         {
-            value = m_valueFunc(m_owner);
-
             Effect(m_tag, m_operator, m_lastValue).RemoveFrom(m_owner);
             Effect(m_tag, m_operator, value).ApplyTo(m_owner);
         }
 
         m_lastValue = value;
+        m_updatedVersion = game->GetStateVersion();
     }
     else
     {
@@ -108,6 +103,26 @@ void AdaptiveEffect::Clone(Playable* clone)
     Activate(clone);
 }
 
+void AdaptiveEffect::CloneState(IAura& clone,
+                                [[maybe_unused]] CloneContext& context) const
+{
+    auto& effect = static_cast<AdaptiveEffect&>(clone);
+
+    effect.m_lastValue = m_lastValue;
+    effect.m_updatedVersion = m_updatedVersion;
+    effect.m_turnOn = m_turnOn;
+}
+
+bool AdaptiveEffect::IsConsistent() const
+{
+    if (!m_turnOn || m_updatedVersion != m_owner->game->GetStateVersion())
+    {
+        return true;
+    }
+
+    return ComputeValue() == m_lastValue;
+}
+
 AdaptiveEffect::AdaptiveEffect(AdaptiveEffect& prototype, Playable& owner)
 {
     m_owner = &owner;
@@ -122,4 +137,14 @@ AdaptiveEffect::AdaptiveEffect(AdaptiveEffect& prototype, Playable& owner)
     m_turnOn = prototype.m_turnOn;
     m_isSwitching = prototype.m_isSwitching;
 }
+
+int AdaptiveEffect::ComputeValue() const
+{
+    if (m_isSwitching)
+    {
+        return m_condition->Evaluate(m_owner) ? 1 : 0;
+    }
+
+    return m_valueFunc(m_owner);
+}
 }  // namespace RosettaStone
@@ -6,6 +6,7 @@
 #include <Rosetta/Auras/AdjacentAura.hpp>
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/Utils.hpp>
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Models/Enchantment.hpp>
 #include <Rosetta/Models/Minion.hpp>
@@ -21,7 +22,7 @@ AdjacentAura::AdjacentAura(std::string&& enchantmentID)
 
 void AdjacentAura::Activate(Playable* owner, [[maybe_unused]] bool cloning)
 {
-    new AdjacentAura(*this, *dynamic_cast<Minion*>(owner), false);
+    new AdjacentAura(*this, *EntityCast<Minion>(owner), false);
 }
 
 void AdjacentAura::Update()
@@ -106,7 +107,17 @@ void AdjacentAura::Remove()
 
 void AdjacentAura::Clone(Playable* clone)
 {
-    new AdjacentAura(*this, *dynamic_cast<Minion*>(clone), true);
+    new AdjacentAura(*this, *EntityCast<Minion>(clone), true);
+}
+
+void AdjacentAura::CloneState(IAura& clone, CloneContext& context) const
+{
+    auto& aura = static_cast<AdjacentAura&>(clone);
+
+    aura.m_left = context.Get<Minion>(m_left);
+    aura.m_right = context.Get<Minion>(m_right);
+    aura.m_isFieldChanged = m_isFieldChanged;
+    aura.m_toBeRemoved = m_toBeRemoved;
 }
 
 void AdjacentAura::SetIsFieldChanged(bool isFieldChanged)
@@ -6,12 +6,12 @@
 #include <Rosetta/Auras/Aura.hpp>
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/Utils.hpp>
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Models/Enchantment.hpp>
 #include <Rosetta/Zones/FieldZone.hpp>
 #include <Rosetta/Zones/HandZone.hpp>
 
-#include <algorithm>
 #include <utility>
 
 namespace RosettaStone
@@ -171,7 +171,7 @@ void Aura::Remove()
             break;
     }
 
-    if (auto enchantment = dynamic_cast<Enchantment*>(m_owner))
+    if (auto enchantment = EntityCast<Enchantment>(m_owner))
     {
         enchantment->Remove();
     }
@@ -182,6 +182,59 @@ void Aura::Clone(Playable* clone)
     Activate(clone, true);
 }
 
+void Aura::CloneState(IAura& clone, CloneContext& context) const
+{
+    auto& aura = static_cast<Aura&>(clone);
+
+    aura.m_turnOn = m_turnOn;
+
+    aura.m_auraUpdateInstQueue = m_auraUpdateInstQueue;
+    aura.m_auraUpdateInstQueue.ForEach([&](AuraUpdateInstruction& inst) {
+        inst.source = context.Get<Playable>(inst.source);
+    });
+
+    aura.ClearAppliedEntities();
+    for (auto& entity : m_appliedEntities)
+    {
+        if (const auto copy = context.Get<Playable>(entity); copy)
+        {
+            aura.AddAppliedEntity(copy);
+        }
+    }
+    aura.m_renewedVersion = m_renewedVersion;
+
+    context.handlers[m_removeHandler.id] = &aura.m_removeHandler;
+}
+
+bool Aura::IsConsistent() const
+{
+    for (std::size_t i = 0; i < m_appliedEntities.size(); ++i)
+    {
+        const auto id = static_cast<std::size_t>(m_appliedEntities[i]->id);
+        if (id >= m_appliedEntityIndices.size() ||
+            m_appliedEntityIndices[id] != static_cast<int>(i))
+        {
+            return false;
+        }
+    }
+
+    if (!restless || !m_turnOn || condition == nullptr)
+    {
+        return true;
+    }
+
+    bool isConsistent = true;
+    ForEachRenewTarget([&](Playable* playable) {
+        if (playable->GetVersion() <= m_renewedVersion &&
+            condition->Evaluate(playable) != IsApplied(playable))
+        {
+            isConsistent = false;
+        }
+    });
+
+    return isConsistent;
+}
+
 void Aura::Apply(Playable* entity)
 {
     if (condition != nullptr)
@@ -210,19 +263,12 @@ void Aura::Apply(Playable* entity)
         }
     }
 
-    m_appliedEntities.emplace_back(entity);
+    AddAppliedEntity(entity);
 }
 
 void Aura::Disapply(Playable* entity)
 {
-    const auto iter =
-        std::find(m_appliedEntities.begin(), m_appliedEntities.end(), entity);
-
-    if (iter != m_appliedEntities.end())
-    {
-        m_appliedEntities.erase(iter);
-    }
-    else
+    if (!RemoveAppliedEntity(entity))
     {
         return;
     }
@@ -296,25 +342,8 @@ Aura::Aura(Aura& prototype, Playable& owner)
         m_auraUpdateInstQueue = prototype.m_auraUpdateInstQueue;
     }
 
-    auto removeFunc = [this](Entity* source) {
-        if (removeTrigger.second != nullptr)
-        {
-            if (dynamic_cast<Player*>(source))
-            {
-                source = m_owner;
-            }
-
-            if (!removeTrigger.second->Evaluate(
-                    dynamic_cast<Playable*>(source)))
-            {
-                return;
-            }
-        }
-
-        Remove();
-    };
-
-    m_removeHandler = TriggerEventHandler(removeFunc);
+    m_removeHandler =
+        TriggerEventHandler::Create<Aura, &Aura::OnRemoveTrigger>(this);
 }
 
 void Aura::AddToGame(Playable& owner, Aura& aura)
@@ -348,6 +377,57 @@ void Aura::AddToGame(Playable& owner, Aura& aura)
     }
 }
 
+bool Aura::IsApplied(const Playable* entity) const
+{
+    const auto id = static_cast<std::size_t>(entity->id);
+
+    return id < m_appliedEntityIndices.size() &&
+           m_appliedEntityIndices[id] >= 0;
+}
+
+void Aura::AddAppliedEntity(Playable* entity)
+{
+    if (IsApplied(entity))
+    {
+        return;
+    }
+
+    const auto id = static_cast<std::size_t>(entity->id);
+    if (id >= m_appliedEntityIndices.size())
+    {
+        m_appliedEntityIndices.resize(id + 1, -1);
+    }
+
+    m_appliedEntityIndices[id] = static_cast<int>(m_appliedEntities.size());
+    m_appliedEntities.emplace_back(entity);
+}
+
+bool Aura::RemoveAppliedEntity(Playable* entity)
+{
+    if (!IsApplied(entity))
+    {
+        return false;
+    }
+
+    // Moves the last entity into the slot of the removed one.
+    const auto id = static_cast<std::size_t>(entity->id);
+    const int index = m_appliedEntityIndices[id];
+    Playable* last = m_appliedEntities.back();
+
+    m_appliedEntities[index] = last;
+    m_appliedEntityIndices[last->id] = index;
+    m_appliedEntities.pop_back();
+    m_appliedEntityIndices[id] = -1;
+
+    return true;
+}
+
+void Aura::ClearAppliedEntities()
+{
+    m_appliedEntities.clear();
+    m_appliedEntityIndices.clear();
+}
+
 void Aura::UpdateInternal()
 {
     if (!m_turnOn)
@@ -450,6 +530,24 @@ void Aura::UpdateInternal()
     }
 }
 
+void Aura::OnRemoveTrigger(Entity* source)
+{
+    if (removeTrigger.second != nullptr)
+    {
+        if (EntityCast<Player>(source))
+        {
+            source = m_owner;
+        }
+
+        if (!removeTrigger.second->Evaluate(EntityCast<Playable>(source)))
+        {
+            return;
+        }
+    }
+
+    Remove();
+}
+
 void Aura::RemoveInternal()
 {
     if (m_type == AuraType::PLAYER)
@@ -497,53 +595,68 @@ void Aura::RemoveInternal()
     }
 }
 
-void Aura::RenewAll()
+template <typename Functor>
+void Aura::ForEachRenewTarget(Functor&& functor) const
 {
-    auto Renew = [this](Playable* playable) {
-        const auto iter = std::find(m_appliedEntities.begin(),
-                                    m_appliedEntities.end(), playable);
-
-        if (condition->Evaluate(playable))
-        {
-            if (iter == m_appliedEntities.end())
-            {
-                Apply(playable);
-            }
-        }
-        else
-        {
-            if (iter != m_appliedEntities.end())
-            {
-                Disapply(playable);
-            }
-        }
-    };
-
     switch (m_type)
     {
         case AuraType::FIELD:
-            m_owner->player->GetFieldZone()->ForEach(Renew);
+            m_owner->player->GetFieldZone()->ForEach(functor);
             break;
         case AuraType::HANDS:
-            m_owner->player->GetHandZone()->ForEach(Renew);
-            m_owner->player->opponent->GetHandZone()->ForEach(Renew);
+            m_owner->player->GetHandZone()->ForEach(functor);
+            m_owner->player->opponent->GetHandZone()->ForEach(functor);
             break;
         case AuraType::WEAPON:
             if (!m_owner->player->GetHero()->HasWeapon())
             {
                 break;
             }
-            Renew(m_owner->player->GetHero()->weapon);
+            functor(m_owner->player->GetHero()->weapon);
             break;
         case AuraType::HERO:
-            Renew(m_owner->player->GetHero());
+            functor(m_owner->player->GetHero());
             break;
         case AuraType::SELF:
-            Renew(m_owner);
+            functor(m_owner);
             break;
         default:
             throw std::invalid_argument(
                 "Aura::RenewAll() - Invalid aura type!");
     }
 }
+
+void Aura::RenewAll()
+{
+    // Skips the renewal if nothing is changed since the last one.
+    Game* game = m_owner->game;
+    if (m_renewedVersion != 0 && m_renewedVersion == game->GetStateVersion())
+    {
+        return;
+    }
+
+    const std::size_t renewedVersion = m_renewedVersion;
+
+    ForEachRenewTarget([this, renewedVersion](Playable* playable) {
+        // The condition of an unchanged entity is the same as before.
+        if (renewedVersion != 0 && playable->GetVersion() <= renewedVersion)
+        {
+            return;
+        }
+
+        if (condition->Evaluate(playable))
+        {
+            if (!IsApplied(playable))
+            {
+                Apply(playable);
+            }
+        }
+        else
+        {
+            Disapply(playable);
+        }
+    });
+
+    m_renewedVersion = game->GetStateVersion();
+}
 }  // namespace RosettaStone
@@ -5,6 +5,7 @@
 
 #include <Rosetta/Actions/Generic.hpp>
 #include <Rosetta/Auras/EnrageEffect.hpp>
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Models/Enchantment.hpp>
 #include <Rosetta/Models/Entity.hpp>
@@ -28,7 +29,7 @@ void EnrageEffect::Activate(Playable* owner, [[maybe_unused]] bool cloning)
 
 void EnrageEffect::Update()
 {
-    const auto minion = dynamic_cast<Minion*>(m_owner);
+    const auto minion = EntityCast<Minion>(m_owner);
 
     if (!m_turnOn)
     {
@@ -120,6 +121,17 @@ void EnrageEffect::Clone(Playable* clone)
     Activate(clone, true);
 }
 
+void EnrageEffect::CloneState(IAura& clone, CloneContext& context) const
+{
+    Aura::CloneState(clone, context);
+
+    auto& effect = static_cast<EnrageEffect&>(clone);
+
+    effect.m_curInstance = context.Get<Enchantment>(m_curInstance);
+    effect.m_target = context.Get<Playable>(m_target);
+    effect.m_enraged = m_enraged;
+}
+
 EnrageEffect::EnrageEffect(EnrageEffect& prototype, Playable& owner)
     : Aura(prototype, owner)
 {
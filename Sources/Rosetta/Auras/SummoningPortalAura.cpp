@@ -49,7 +49,7 @@ void SummoningPortalAura::Update()
                 }
 
                 Apply(inst.source);
-                m_appliedEntities.emplace_back(inst.source);
+                AddAppliedEntity(inst.source);
             }
             break;
             case AuraInstruction::ADD_ALL:
@@ -60,15 +60,7 @@ void SummoningPortalAura::Update()
             break;
             case AuraInstruction::REMOVE:
             {
-                const auto iter =
-                    std::find(m_appliedEntities.begin(),
-                              m_appliedEntities.end(), inst.source);
-
-                if (iter != m_appliedEntities.end())
-                {
-                    m_appliedEntities.erase(iter);
-                }
-                else
+                if (!RemoveAppliedEntity(inst.source))
                 {
                     break;
                 }
@@ -116,7 +108,7 @@ void SummoningPortalAura::AddAll()
     for (auto& playable : m_owner->player->GetHandZone()->GetAll())
     {
         Apply(playable);
-        m_appliedEntities.emplace_back(playable);
+        AddAppliedEntity(playable);
     }
 }
 
@@ -142,7 +134,7 @@ void SummoningPortalAura::CalculateCost(Playable* playable) const
         }
     }
 
-    auto minion = dynamic_cast<Minion*>(playable);
+    auto minion = EntityCast<Minion>(playable);
     if (minion == nullptr)
     {
         return;
@@ -5,6 +5,7 @@
 
 #include <Rosetta/Auras/SwitchingAura.hpp>
 #include <Rosetta/Cards/Card.hpp>
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Models/Entity.hpp>
 
@@ -88,6 +89,18 @@ void SwitchingAura::Remove()
     }
 }
 
+void SwitchingAura::CloneState(IAura& clone, CloneContext& context) const
+{
+    Aura::CloneState(clone, context);
+
+    auto& aura = static_cast<SwitchingAura&>(clone);
+
+    aura.m_isRemoved = m_isRemoved;
+
+    context.handlers[m_onHandler.id] = &aura.m_onHandler;
+    context.handlers[m_offHandler.id] = &aura.m_offHandler;
+}
+
 void SwitchingAura::RemoveInternal()
 {
     for (auto& entity : m_appliedEntities)
@@ -98,7 +111,7 @@ void SwitchingAura::RemoveInternal()
         }
     }
 
-    m_appliedEntities.clear();
+    ClearAppliedEntities();
 
     if (m_isRemoved)
     {
@@ -112,31 +125,37 @@ SwitchingAura::SwitchingAura(SwitchingAura& prototype, Playable& owner)
       m_initCondition(prototype.m_initCondition),
       m_offTrigger(prototype.m_offTrigger)
 {
-    auto onFunc = [this](Entity*) {
-        if (m_turnOn)
-        {
-            return;
-        }
+    m_onHandler =
+        TriggerEventHandler::Create<SwitchingAura, &SwitchingAura::TurnOn>(
+            this);
+    m_offHandler =
+        TriggerEventHandler::Create<SwitchingAura, &SwitchingAura::TurnOff>(
+            this);
+}
 
-        m_turnOn = true;
+void SwitchingAura::TurnOn(Entity*)
+{
+    if (m_turnOn)
+    {
+        return;
+    }
 
-        m_auraUpdateInstQueue.Push(
-            AuraUpdateInstruction(AuraInstruction::ADD_ALL), 1);
-    };
+    m_turnOn = true;
 
-    auto offFunc = [this](Entity*) {
-        if (!m_turnOn)
-        {
-            return;
-        }
+    m_auraUpdateInstQueue.Push(AuraUpdateInstruction(AuraInstruction::ADD_ALL),
+                               1);
+}
 
-        m_turnOn = false;
+void SwitchingAura::TurnOff(Entity*)
+{
+    if (!m_turnOn)
+    {
+        return;
+    }
 
-        m_auraUpdateInstQueue.Push(
-            AuraUpdateInstruction(AuraInstruction::REMOVE_ALL), 0);
-    };
+    m_turnOn = false;
 
-    m_onHandler = TriggerEventHandler(onFunc);
-    m_offHandler = TriggerEventHandler(offFunc);
+    m_auraUpdateInstQueue.Push(
+        AuraUpdateInstruction(AuraInstruction::REMOVE_ALL), 0);
 }
 }  // namespace RosettaStone
@@ -10,6 +10,7 @@
 #include <Rosetta/Conditions/SelfCondition.hpp>
 #include <Rosetta/Enchants/Effects.hpp>
 #include <Rosetta/Enchants/Enchants.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/AddEnchantmentTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/ArmorTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/ConditionTask.hpp>
@@ -42,10 +43,6 @@
 #include <Rosetta/Zones/FieldZone.hpp>
 #include <Rosetta/Zones/SetasideZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 using namespace RosettaStone::SimpleTasks;
 
 namespace RosettaStone
@@ -249,10 +246,11 @@ void CoreCardsGen::AddHeroPowers(std::map<std::string, CardDef>& cards)
             return;
         }
 
-        const auto idx = Random::get<int>(0, totemCards.size() - 1);
+        const auto idx = playable->game->GetRandom().Get<std::size_t>(
+            0, totemCards.size() - 1);
         Playable* totem =
             Entity::GetFromCard(playable->player, totemCards[idx]);
-        playable->player->GetFieldZone()->Add(dynamic_cast<Minion*>(totem));
+        playable->player->GetFieldZone()->Add(EntityCast<Minion>(totem));
     }));
     cards.emplace(
         "CS2_049",
@@ -1732,7 +1732,7 @@ void Expert1CardsGen::AddPaladin(std::map<std::string, CardDef>& cards)
         std::make_shared<CopyTask>(EntityType::TARGET, ZoneType::PLAY, 1, true),
         std::make_shared<FuncPlayableTask>(
             [=](const std::vector<Playable*>& playables) {
-                auto target = dynamic_cast<Minion*>(playables[0]);
+                auto target = EntityCast<Minion>(playables[0]);
                 if (target == nullptr)
                 {
                     return std::vector<Playable*>{};
@@ -2176,7 +2176,7 @@ void Expert1CardsGen::AddPriest(std::map<std::string, CardDef>& cards)
     power.ClearData();
     power.AddAura(std::make_shared<AdaptiveEffect>(
         GameTag::ATK, EffectOperator::SET, [=](Playable* playable) {
-            return dynamic_cast<Minion*>(playable)->GetHealth();
+            return EntityCast<Minion>(playable)->GetHealth();
         }));
     cards.emplace("EX1_335", CardDef(power));
 
@@ -3951,7 +3951,7 @@ void Expert1CardsGen::AddWarriorNonCollect(
             std::make_shared<IncludeTask>(EntityType::TARGET),
             std::make_shared<FuncPlayableTask>(
                 [=](const std::vector<Playable*>& playables) {
-                    auto minion = dynamic_cast<Minion*>(playables[0]);
+                    auto minion = EntityCast<Minion>(playables[0]);
                     int& eventNumber =
                         minion->game->currentEventData->eventNumber;
 
@@ -335,7 +335,7 @@ std::vector<Character*> Card::GetValidPlayTargets(Player* player)
 
     if (friendlyMinions)
     {
-        for (auto& minion : player->GetFieldZone()->GetAll())
+        for (auto& minion : player->GetFieldZone()->GetView())
         {
             if (TargetingRequirements(player, minion))
             {
@@ -346,7 +346,7 @@ std::vector<Character*> Card::GetValidPlayTargets(Player* player)
 
     if (enemyMinions)
     {
-        for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+        for (auto& minion : player->opponent->GetFieldZone()->GetView())
         {
             if (TargetingRequirements(player, minion))
             {
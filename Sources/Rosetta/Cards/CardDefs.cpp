@@ -14,17 +14,22 @@
 
 namespace RosettaStone
 {
-std::map<std::string, CardDef> CardDefs::m_data;
+std::map<std::string, CardDef, std::less<>> CardDefs::m_data;
 
 CardDefs::CardDefs()
 {
-    CoreCardsGen::AddAll(m_data);
-    Expert1CardsGen::AddAll(m_data);
-    HoFCardsGen::AddAll(m_data);
-    DalaranCardsGen::AddAll(m_data);
-    UldumCardsGen::AddAll(m_data);
-    DragonsCardsGen::AddAll(m_data);
-    YoDCardsGen::AddAll(m_data);
+    std::map<std::string, CardDef> cards;
+
+    CoreCardsGen::AddAll(cards);
+    Expert1CardsGen::AddAll(cards);
+    HoFCardsGen::AddAll(cards);
+    DalaranCardsGen::AddAll(cards);
+    UldumCardsGen::AddAll(cards);
+    DragonsCardsGen::AddAll(cards);
+    YoDCardsGen::AddAll(cards);
+
+    // The nodes are moved to the map that is searched without a copy
+    m_data.merge(cards);
 }
 
 CardDefs::~CardDefs()
@@ -38,16 +43,16 @@ CardDefs& CardDefs::GetInstance()
     return instance;
 }
 
-CardDef CardDefs::FindCardDefByCardID(const std::string_view& cardID)
+const CardDef& CardDefs::FindCardDefByCardID(const std::string_view& cardID)
 {
-    for (auto& data : m_data)
+    static const CardDef emptyCardDef;
+
+    const auto iter = m_data.find(cardID);
+    if (iter == m_data.end())
     {
-        if (data.first == cardID)
-        {
-            return data.second;
-        }
+        return emptyCardDef;
     }
 
-    return CardDef();
+    return iter->second;
 }
 }  // namespace RosettaStone
@@ -10,8 +10,43 @@
 #include <Rosetta/Loaders/CardLoader.hpp>
 #include <Rosetta/Loaders/InternalCardLoader.hpp>
 
+#include <algorithm>
+#include <stdexcept>
+
 namespace RosettaStone
 {
+namespace
+{
+template <typename Key>
+CardIndex FindCardIndex(
+    const std::vector<std::pair<Key, CardIndex>>& indices, const Key& key)
+{
+    const auto iter = std::lower_bound(
+        indices.begin(), indices.end(), key,
+        [](const std::pair<Key, CardIndex>& lhs, const Key& rhs) {
+            return lhs.first < rhs;
+        });
+
+    if (iter == indices.end() || iter->first != key)
+    {
+        return INVALID_CARD_INDEX;
+    }
+
+    return iter->second;
+}
+
+template <typename Key>
+void SortCardIndices(std::vector<std::pair<Key, CardIndex>>& indices)
+{
+    // NOTE: Keep the order of cards with the same key to return the first one
+    std::stable_sort(indices.begin(), indices.end(),
+                     [](const std::pair<Key, CardIndex>& lhs,
+                        const std::pair<Key, CardIndex>& rhs) {
+                         return lhs.first < rhs.first;
+                     });
+}
+}  // namespace
+
 Card emptyCard;
 
 std::vector<Card*> Cards::m_cards;
@@ -20,12 +55,44 @@ std::array<std::vector<Card*>, NUM_PLAYER_CLASS> Cards::m_wildCards;
 std::vector<Card*> Cards::m_allStandardCards;
 std::vector<Card*> Cards::m_allWildCards;
 std::vector<Card*> Cards::m_lackeys;
+std::vector<std::pair<std::string_view, CardIndex>> Cards::m_idIndices;
+std::vector<std::pair<int, CardIndex>> Cards::m_dbfIDIndices;
+std::vector<std::pair<std::string_view, CardIndex>> Cards::m_nameIndices;
 
 Cards::Cards()
 {
     m_cards.reserve(NUM_ALL_CARDS);
 
     CardLoader::Load(m_cards);
+
+    if (m_cards.size() >= INVALID_CARD_INDEX)
+    {
+        throw std::length_error("Cards::Cards() - Too many cards to index!");
+    }
+
+    // NOTE: Build indices before loading card definitions because they look up
+    // other cards by ID
+    m_idIndices.reserve(m_cards.size());
+    m_dbfIDIndices.reserve(m_cards.size());
+
+    for (std::size_t i = 0; i < m_cards.size(); ++i)
+    {
+        Card* card = m_cards[i];
+        card->index = static_cast<CardIndex>(i);
+
+        m_idIndices.emplace_back(card->id, card->index);
+        m_dbfIDIndices.emplace_back(card->dbfID, card->index);
+
+        if (card->IsCollectible())
+        {
+            m_nameIndices.emplace_back(card->name, card->index);
+        }
+    }
+
+    SortCardIndices(m_idIndices);
+    SortCardIndices(m_dbfIDIndices);
+    SortCardIndices(m_nameIndices);
+
     InternalCardLoader::Load(m_cards);
 
     for (Card* card : m_cards)
@@ -73,6 +140,9 @@ Cards::~Cards()
     }
 
     m_cards.clear();
+    m_idIndices.clear();
+    m_dbfIDIndices.clear();
+    m_nameIndices.clear();
 }
 
 Cards& Cards::GetInstance()
@@ -113,30 +183,29 @@ std::vector<Card*> Cards::GetLackeys()
     return m_lackeys;
 }
 
-Card* Cards::FindCardByID(const std::string_view& id)
+CardIndex Cards::GetCardIndex(const std::string_view& id)
 {
-    for (Card* card : m_cards)
+    return FindCardIndex(m_idIndices, id);
+}
+
+Card* Cards::GetCardByIndex(CardIndex index)
+{
+    if (index >= m_cards.size())
     {
-        if (card->id == id)
-        {
-            return card;
-        }
+        return &emptyCard;
     }
 
-    return &emptyCard;
+    return m_cards[index];
 }
 
-Card* Cards::FindCardByDbfID(int dbfID)
+Card* Cards::FindCardByID(const std::string_view& id)
 {
-    for (Card* card : m_cards)
-    {
-        if (card->dbfID == dbfID)
-        {
-            return card;
-        }
-    }
+    return GetCardByIndex(FindCardIndex(m_idIndices, id));
+}
 
-    return &emptyCard;
+Card* Cards::FindCardByDbfID(int dbfID)
+{
+    return GetCardByIndex(FindCardIndex(m_dbfIDIndices, dbfID));
 }
 
 std::vector<Card*> Cards::FindCardByRarity(Rarity rarity)
@@ -216,15 +285,7 @@ std::vector<Card*> Cards::FindCardByRace(Race race)
 
 Card* Cards::FindCardByName(const std::string_view& name)
 {
-    for (Card* card : m_cards)
-    {
-        if (card->name == name && card->IsCollectible())
-        {
-            return card;
-        }
-    }
-
-    return &emptyCard;
+    return GetCardByIndex(FindCardIndex(m_nameIndices, name));
 }
 
 std::vector<Card*> Cards::FindCardByCost(int minVal, int maxVal)
@@ -0,0 +1,113 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/Arena.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+
+namespace RosettaStone
+{
+namespace
+{
+thread_local Arena* g_currentArena = nullptr;
+
+// The header stores the arena that owns an ArenaObject. It is as large as
+// the maximum alignment so that the object after it stays aligned.
+constexpr std::size_t HEADER_SIZE = alignof(std::max_align_t);
+}  // namespace
+
+Arena::Scope::Scope(Arena* arena) : m_prevArena(g_currentArena)
+{
+    g_currentArena = arena;
+}
+
+Arena::Scope::~Scope()
+{
+    g_currentArena = m_prevArena;
+}
+
+Arena::Arena(std::size_t blockSize) : m_blockSize(blockSize)
+{
+    // Do nothing
+}
+
+void* Arena::Allocate(std::size_t size, std::size_t alignment)
+{
+    auto address = reinterpret_cast<std::uintptr_t>(m_cur);
+    std::size_t padding = (alignment - address % alignment) % alignment;
+
+    if (m_cur == nullptr || padding + size > m_remaining)
+    {
+        // The oversized request gets a block of its own
+        const std::size_t blockSize =
+            std::max(m_blockSize, size + alignof(std::max_align_t));
+
+        m_blocks.emplace_back(new std::byte[blockSize]);
+        m_cur = m_blocks.back().get();
+        m_remaining = blockSize;
+
+        address = reinterpret_cast<std::uintptr_t>(m_cur);
+        padding = (alignment - address % alignment) % alignment;
+    }
+
+    void* result = m_cur + padding;
+    m_cur += padding + size;
+    m_remaining -= padding + size;
+    m_allocatedBytes += size;
+
+    return result;
+}
+
+void Arena::Release()
+{
+    m_blocks.clear();
+    m_cur = nullptr;
+    m_remaining = 0;
+    m_allocatedBytes = 0;
+}
+
+std::size_t Arena::GetNumBlocks() const
+{
+    return m_blocks.size();
+}
+
+std::size_t Arena::GetAllocatedBytes() const
+{
+    return m_allocatedBytes;
+}
+
+Arena* Arena::GetCurrent()
+{
+    return g_currentArena;
+}
+
+void* ArenaObject::operator new(std::size_t size)
+{
+    Arena* arena = g_currentArena;
+
+    void* memory = arena != nullptr ? arena->Allocate(HEADER_SIZE + size)
+                                    : ::operator new(HEADER_SIZE + size);
+    *static_cast<Arena**>(memory) = arena;
+
+    return static_cast<std::byte*>(memory) + HEADER_SIZE;
+}
+
+void ArenaObject::operator delete(void* ptr) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    void* memory = static_cast<std::byte*>(ptr) - HEADER_SIZE;
+    if (*static_cast<Arena**>(memory) == nullptr)
+    {
+        ::operator delete(memory);
+    }
+}
+}  // namespace RosettaStone
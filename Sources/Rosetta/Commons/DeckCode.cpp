@@ -9,7 +9,10 @@
 #include <Rosetta/Commons/DeckCode.hpp>
 #include <Rosetta/Commons/Utils.hpp>
 
+#include <mutex>
+#include <shared_mutex>
 #include <stdexcept>
+#include <unordered_map>
 
 namespace RosettaStone
 {
@@ -99,4 +102,39 @@ DeckInfo DeckCode::Decode(const std::string& deckCode)
 
     return deckInfo;
 }
+
+const std::array<Card*, START_DECK_SIZE>& DeckCode::GetDeck(
+    const std::string& deckCode)
+{
+    // Elements of unordered_map are never moved, so references stay valid
+    static std::unordered_map<std::string, std::array<Card*, START_DECK_SIZE>>
+        decks;
+    static std::shared_mutex mutex;
+
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex);
+
+        const auto iter = decks.find(deckCode);
+        if (iter != decks.end())
+        {
+            return iter->second;
+        }
+    }
+
+    auto cardIDs = Decode(deckCode).GetCardIDs();
+    if (cardIDs.size() > START_DECK_SIZE)
+    {
+        throw std::runtime_error(
+            "DeckCode::GetDeck() - The deck has too many cards");
+    }
+
+    std::array<Card*, START_DECK_SIZE> deck{};
+    for (std::size_t i = 0; i < cardIDs.size(); ++i)
+    {
+        deck[i] = Cards::FindCardByID(cardIDs[i]);
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex);
+    return decks.emplace(deckCode, deck).first->second;
+}
 }  // namespace RosettaStone
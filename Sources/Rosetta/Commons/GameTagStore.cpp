@@ -0,0 +1,213 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/GameTagStore.hpp>
+
+#include <algorithm>
+
+namespace RosettaStone
+{
+namespace
+{
+template <typename Container>
+auto FindSparse(Container& sparse, GameTag tag)
+{
+    return std::lower_bound(
+        sparse.begin(), sparse.end(), tag,
+        [](const std::pair<GameTag, int>& lhs, GameTag rhs) {
+            return lhs.first < rhs;
+        });
+}
+}  // namespace
+
+const std::array<GameTag, GameTagStore::NUM_DENSE_TAGS>
+    GameTagStore::DENSE_TAGS = {
+        GameTag::ZONE,
+        GameTag::ZONE_POSITION,
+        GameTag::CONTROLLER,
+        GameTag::COST,
+        GameTag::ATK,
+        GameTag::HEALTH,
+        GameTag::DAMAGE,
+        GameTag::PREDAMAGE,
+        GameTag::ARMOR,
+        GameTag::DURABILITY,
+        GameTag::SPELLPOWER,
+        GameTag::EXHAUSTED,
+        GameTag::NUM_ATTACKS_THIS_TURN,
+        GameTag::TAUNT,
+        GameTag::DIVINE_SHIELD,
+        GameTag::CHARGE,
+        GameTag::RUSH,
+        GameTag::WINDFURY,
+        GameTag::STEALTH,
+        GameTag::FROZEN,
+        GameTag::IMMUNE,
+        GameTag::POISONOUS,
+        GameTag::LIFESTEAL,
+        GameTag::DEATHRATTLE,
+        GameTag::CANT_ATTACK,
+        GameTag::CANT_BE_TARGETED_BY_SPELLS,
+        GameTag::CANT_BE_TARGETED_BY_HERO_POWERS,
+        GameTag::ATTACKABLE_BY_RUSH,
+        GameTag::CARD_TARGET,
+        GameTag::REBORN,
+        GameTag::COMBO,
+        GameTag::OVERLOAD,
+        // NOTE: Minion::SetLastBoardPos() writes it when a minion dies.
+        GameTag::TAG_LAST_KNOWN_COST_IN_HAND,
+    };
+
+int GameTagStore::GetDenseIndex(GameTag tag)
+{
+    switch (tag)
+    {
+        case GameTag::ZONE:
+            return 0;
+        case GameTag::ZONE_POSITION:
+            return 1;
+        case GameTag::CONTROLLER:
+            return 2;
+        case GameTag::COST:
+            return 3;
+        case GameTag::ATK:
+            return 4;
+        case GameTag::HEALTH:
+            return 5;
+        case GameTag::DAMAGE:
+            return 6;
+        case GameTag::PREDAMAGE:
+            return 7;
+        case GameTag::ARMOR:
+            return 8;
+        case GameTag::DURABILITY:
+            return 9;
+        case GameTag::SPELLPOWER:
+            return 10;
+        case GameTag::EXHAUSTED:
+            return 11;
+        case GameTag::NUM_ATTACKS_THIS_TURN:
+            return 12;
+        case GameTag::TAUNT:
+            return 13;
+        case GameTag::DIVINE_SHIELD:
+            return 14;
+        case GameTag::CHARGE:
+            return 15;
+        case GameTag::RUSH:
+            return 16;
+        case GameTag::WINDFURY:
+            return 17;
+        case GameTag::STEALTH:
+            return 18;
+        case GameTag::FROZEN:
+            return 19;
+        case GameTag::IMMUNE:
+            return 20;
+        case GameTag::POISONOUS:
+            return 21;
+        case GameTag::LIFESTEAL:
+            return 22;
+        case GameTag::DEATHRATTLE:
+            return 23;
+        case GameTag::CANT_ATTACK:
+            return 24;
+        case GameTag::CANT_BE_TARGETED_BY_SPELLS:
+            return 25;
+        case GameTag::CANT_BE_TARGETED_BY_HERO_POWERS:
+            return 26;
+        case GameTag::ATTACKABLE_BY_RUSH:
+            return 27;
+        case GameTag::CARD_TARGET:
+            return 28;
+        case GameTag::REBORN:
+            return 29;
+        case GameTag::COMBO:
+            return 30;
+        case GameTag::OVERLOAD:
+            return 31;
+        case GameTag::TAG_LAST_KNOWN_COST_IN_HAND:
+            return 32;
+        default:
+            return -1;
+    }
+}
+
+const int* GameTagStore::Find(GameTag tag) const
+{
+    if (const int index = GetDenseIndex(tag); index >= 0)
+    {
+        return ((m_denseMask >> index) & 1u) ? &m_dense[index] : nullptr;
+    }
+
+    const auto iter = FindSparse(m_sparse, tag);
+    if (iter == m_sparse.end() || iter->first != tag)
+    {
+        return nullptr;
+    }
+
+    return &iter->second;
+}
+
+void GameTagStore::Set(GameTag tag, int value)
+{
+    if (const int index = GetDenseIndex(tag); index >= 0)
+    {
+        m_dense[index] = value;
+        m_denseMask |= std::uint64_t{ 1 } << index;
+        return;
+    }
+
+    const auto iter = FindSparse(m_sparse, tag);
+    if (iter != m_sparse.end() && iter->first == tag)
+    {
+        iter->second = value;
+    }
+    else
+    {
+        m_sparse.emplace(iter, tag, value);
+    }
+}
+
+void GameTagStore::Erase(GameTag tag)
+{
+    if (const int index = GetDenseIndex(tag); index >= 0)
+    {
+        m_dense[index] = 0;
+        m_denseMask &= ~(std::uint64_t{ 1 } << index);
+        return;
+    }
+
+    const auto iter = FindSparse(m_sparse, tag);
+    if (iter != m_sparse.end() && iter->first == tag)
+    {
+        m_sparse.erase(iter);
+    }
+}
+
+void GameTagStore::SetDefaults(const std::map<GameTag, int>& defaults)
+{
+    m_dense.fill(0);
+    m_denseMask = (std::uint64_t{ 1 } << NUM_DENSE_TAGS) - 1;
+
+    for (const auto& [tag, value] : defaults)
+    {
+        if (const int index = GetDenseIndex(tag); index >= 0)
+        {
+            m_dense[index] = value;
+        }
+    }
+}
+
+std::map<GameTag, int> GameTagStore::ToMap() const
+{
+    std::map<GameTag, int> result;
+
+    ForEach([&](GameTag tag, int value) { result.emplace(tag, value); });
+
+    return result;
+}
+}  // namespace RosettaStone
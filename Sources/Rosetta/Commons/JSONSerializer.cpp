@@ -153,7 +153,7 @@ nlohmann::json JSONSerializer::SerializeHand(const HandZone* hand)
 {
     nlohmann::json obj;
 
-    for (const auto& card : hand->GetAll())
+    for (const auto& card : hand->GetView())
     {
         obj.emplace_back(SerializeHandCard(*card));
     }
@@ -165,7 +165,7 @@ nlohmann::json JSONSerializer::SerializeField(const FieldZone* field)
 {
     nlohmann::json obj;
 
-    for (const auto& card : field->GetAll())
+    for (const auto& card : field->GetView())
     {
         obj.emplace_back(SerializeMinion(*card));
     }
@@ -177,7 +177,7 @@ nlohmann::json JSONSerializer::SerializeSecrets(const SecretZone* secrets)
 {
     nlohmann::json obj;
 
-    for (const auto& secret : secrets->GetAll())
+    for (const auto& secret : secrets->GetView())
     {
         obj.emplace_back(SerializeSecret(*secret));
     }
@@ -266,13 +266,13 @@ void JSONSerializer::AddAttackableInfo(nlohmann::json& obj, Game& game,
 
     const ActionValidGetter getter(game);
     getter.ForEachAttacker([&](Character* character) {
-        if (dynamic_cast<Hero*>(character))
+        if (EntityCast<Hero>(character))
         {
             obj["hero"]["attackable"] = 1;
         }
         else
         {
-            const auto minion = dynamic_cast<Minion*>(character);
+            const auto minion = EntityCast<Minion>(character);
             const Player* curPlayer = game.GetCurrentPlayer();
             const int minionIdx = curPlayer->GetFieldZone()->FindIndex(minion);
             obj["minions"][minionIdx]["attackable"] = 1;
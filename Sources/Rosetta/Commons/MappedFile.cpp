@@ -0,0 +1,82 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/MappedFile.hpp>
+
+#include <fstream>
+
+#if !defined(ROSETTASTONE_WINDOWS)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace RosettaStone
+{
+MappedFile::MappedFile(const std::string& path)
+{
+#if defined(ROSETTASTONE_WINDOWS)
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        return;
+    }
+
+    m_buffer.resize(static_cast<std::size_t>(file.tellg()));
+    file.seekg(0);
+    if (file.read(m_buffer.data(),
+                  static_cast<std::streamsize>(m_buffer.size())))
+    {
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+    }
+#else
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return;
+    }
+
+    struct stat status
+    {
+    };
+    if (fstat(fd, &status) == 0 && status.st_size > 0)
+    {
+        const auto size = static_cast<std::size_t>(status.st_size);
+        void* addr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED)
+        {
+            m_data = static_cast<const char*>(addr);
+            m_size = size;
+        }
+    }
+
+    // NOTE: The mapping stays valid after the file is closed
+    close(fd);
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#if !defined(ROSETTASTONE_WINDOWS)
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<char*>(m_data), m_size);
+    }
+#endif
+}
+
+const char* MappedFile::GetData() const
+{
+    return m_data;
+}
+
+std::size_t MappedFile::GetSize() const
+{
+    return m_size;
+}
+}  // namespace RosettaStone
@@ -0,0 +1,38 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/RandomGenerator.hpp>
+
+#include <random>
+
+namespace RosettaStone
+{
+namespace
+{
+std::uint64_t GetDeviceSeed()
+{
+    std::random_device device;
+    return (static_cast<std::uint64_t>(device()) << 32) | device();
+}
+}  // namespace
+
+RandomGenerator::RandomGenerator() : m_seed(GetThreadLocal()())
+{
+    // Do nothing
+}
+
+RandomGenerator::RandomGenerator(std::uint64_t seed) : m_seed(seed)
+{
+    // Do nothing
+}
+
+RandomGenerator& RandomGenerator::GetThreadLocal()
+{
+    // NOTE: Only this generator reads std::random_device, once per thread
+    thread_local RandomGenerator generator(GetDeviceSeed());
+    return generator;
+}
+}  // namespace RosettaStone
@@ -42,7 +42,7 @@ SelfCondition SelfCondition::IsNotDead()
 SelfCondition SelfCondition::IsNotImmune()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
+        const auto character = EntityCast<Character>(playable);
         if (!character)
         {
             return false;
@@ -90,7 +90,7 @@ SelfCondition SelfCondition::IsFieldNotEmpty()
 SelfCondition SelfCondition::IsDamaged()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
+        const auto character = EntityCast<Character>(playable);
         if (!character)
         {
             return false;
@@ -103,7 +103,7 @@ SelfCondition SelfCondition::IsDamaged()
 SelfCondition SelfCondition::IsUndamaged()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
+        const auto character = EntityCast<Character>(playable);
         if (!character)
         {
             return false;
@@ -130,7 +130,7 @@ SelfCondition SelfCondition::IsRace(Race race)
 SelfCondition SelfCondition::IsControllingRace(Race race)
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        for (auto& minion : playable->player->GetFieldZone()->GetAll())
+        for (auto& minion : playable->player->GetFieldZone()->GetView())
         {
             if (minion->card->GetRace() == race)
             {
@@ -152,7 +152,7 @@ SelfCondition SelfCondition::IsControllingSecret()
 SelfCondition SelfCondition::IsHoldingRace(Race race)
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        for (auto& minion : playable->player->GetHandZone()->GetAll())
+        for (auto& minion : playable->player->GetHandZone()->GetView())
         {
             if (minion->card->GetRace() == race)
             {
@@ -167,21 +167,21 @@ SelfCondition SelfCondition::IsHoldingRace(Race race)
 SelfCondition SelfCondition::IsMinion()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        return dynamic_cast<Minion*>(playable) != nullptr;
+        return EntityCast<Minion>(playable) != nullptr;
     });
 }
 
 SelfCondition SelfCondition::IsSpell()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        return dynamic_cast<Spell*>(playable) != nullptr;
+        return EntityCast<Spell>(playable) != nullptr;
     });
 }
 
 SelfCondition SelfCondition::IsSecret()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        return dynamic_cast<Spell*>(playable) != nullptr &&
+        return EntityCast<Spell>(playable) != nullptr &&
                playable->GetGameTag(GameTag::SECRET) == 1;
     });
 }
@@ -189,7 +189,7 @@ SelfCondition SelfCondition::IsSecret()
 SelfCondition SelfCondition::IsFrozen()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
+        const auto character = EntityCast<Character>(playable);
         if (!character)
         {
             return false;
@@ -202,7 +202,7 @@ SelfCondition SelfCondition::IsFrozen()
 SelfCondition SelfCondition::IsRush()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        const auto minion = dynamic_cast<Minion*>(playable);
+        const auto minion = EntityCast<Minion>(playable);
         if (!minion)
         {
             return false;
@@ -215,7 +215,7 @@ SelfCondition SelfCondition::IsRush()
 SelfCondition SelfCondition::HasNotStealth()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        const auto minion = dynamic_cast<Minion*>(playable);
+        const auto minion = EntityCast<Minion>(playable);
         if (!minion)
         {
             return false;
@@ -228,7 +228,7 @@ SelfCondition SelfCondition::HasNotStealth()
 SelfCondition SelfCondition::HasReborn()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        const auto minion = dynamic_cast<Minion*>(playable);
+        const auto minion = EntityCast<Minion>(playable);
         if (!minion)
         {
             return false;
@@ -247,9 +247,9 @@ SelfCondition SelfCondition::HasSpellPower()
 SelfCondition SelfCondition::HasMinionInHand()
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        for (auto& card : playable->player->GetHandZone()->GetAll())
+        for (auto& card : playable->player->GetHandZone()->GetView())
         {
-            if (dynamic_cast<Minion*>(card) != nullptr)
+            if (EntityCast<Minion>(card) != nullptr)
             {
                 return true;
             }
@@ -313,7 +313,7 @@ SelfCondition SelfCondition::IsStackNum(int value, RelaSign relaSign, int index)
 SelfCondition SelfCondition::IsHealth(int value, RelaSign relaSign)
 {
     return SelfCondition([=](Playable* playable) -> bool {
-        const auto character = dynamic_cast<Character*>(playable);
+        const auto character = EntityCast<Character>(playable);
         if (character == nullptr)
         {
             return false;
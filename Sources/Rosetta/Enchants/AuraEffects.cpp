@@ -5,6 +5,7 @@
 
 #include <Rosetta/Enchants/AuraEffects.hpp>
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace RosettaStone
@@ -31,6 +32,28 @@ AuraEffects::AuraEffects(CardType type) : m_type(type)
     }
 }
 
+AuraEffects::AuraEffects(const AuraEffects& rhs) : AuraEffects(rhs.m_type)
+{
+    std::size_t size = AURA_EFFECT_CARD_SIZE;
+
+    switch (m_type)
+    {
+        case CardType::HERO:
+            size = AURA_EFFECT_HERO_SIZE;
+            break;
+        case CardType::MINION:
+            size = AURA_EFFECT_MINION_SIZE;
+            break;
+        case CardType::WEAPON:
+            size = AURA_EFFECT_WEAPON_SIZE;
+            break;
+        default:
+            break;
+    }
+
+    std::copy_n(rhs.m_data, size, m_data);
+}
+
 AuraEffects::~AuraEffects()
 {
     delete[] m_data;
@@ -96,7 +96,7 @@ void Effect::ApplyAuraTo(Entity* entity) const
         case EffectOperator::SET:
             auraEffects->SetGameTag(m_gameTag, m_value);
 
-            if (auto minion = dynamic_cast<Minion*>(entity); minion)
+            if (auto minion = EntityCast<Minion>(entity); minion)
             {
                 if (m_gameTag == GameTag::HEALTH_MINIMUM)
                 {
@@ -109,6 +109,8 @@ void Effect::ApplyAuraTo(Entity* entity) const
             throw std::invalid_argument(
                 "Effect::ApplyAuraTo() - Invalid effect operator!");
     }
+
+    entity->MarkChanged();
 }
 
 void Effect::RemoveFrom(Entity* entity) const
@@ -177,7 +179,7 @@ void Effect::RemoveAuraFrom(Entity* entity) const
         case EffectOperator::SET:
             auraEffects->SetGameTag(m_gameTag, prevValue - m_value);
 
-            if (auto minion = dynamic_cast<Minion*>(entity); minion)
+            if (auto minion = EntityCast<Minion>(entity); minion)
             {
                 if (m_gameTag == GameTag::HEALTH_MINIMUM)
                 {
@@ -190,6 +192,8 @@ void Effect::RemoveAuraFrom(Entity* entity) const
             throw std::invalid_argument(
                 "Effect::RemoveAuraFrom() - Invalid effect operator!");
     }
+
+    entity->MarkChanged();
 }
 
 IEffect* Effect::ChangeValue(int newValue) const
@@ -18,7 +18,7 @@ OngoingEnchant::OngoingEnchant(std::vector<std::shared_ptr<IEffect>> effects)
 
 void OngoingEnchant::ActivateTo(Entity* entity, int num1, int num2)
 {
-    Clone(dynamic_cast<Playable*>(entity));
+    Clone(EntityCast<Playable>(entity));
 
     Enchant::ActivateTo(entity, num1, num2);
 }
@@ -64,6 +64,17 @@ void OngoingEnchant::Clone(Playable* clone)
     copy->game->auras.emplace_back(copy);
 }
 
+void OngoingEnchant::CloneState(IAura& clone,
+                                [[maybe_unused]] CloneContext& context) const
+{
+    auto& enchant = static_cast<OngoingEnchant&>(clone);
+
+    enchant.useScriptTag = useScriptTag;
+    enchant.m_count = m_count;
+    enchant.m_lastCount = m_lastCount;
+    enchant.m_toBeUpdated = m_toBeUpdated;
+}
+
 std::size_t OngoingEnchant::GetCount() const
 {
     return m_count;
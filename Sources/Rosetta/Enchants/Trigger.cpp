@@ -10,10 +10,6 @@
 #include <Rosetta/Models/Spell.hpp>
 #include <Rosetta/Tasks/ITask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone
 {
 Trigger::Trigger(TriggerType type) : m_triggerType(type)
@@ -49,19 +45,12 @@ Trigger::Trigger(Trigger& prototype, Entity& owner)
       eitherTurn(prototype.eitherTurn),
       fastExecution(prototype.fastExecution),
       removeAfterTriggered(prototype.removeAfterTriggered),
-      m_owner(dynamic_cast<Playable*>(&owner)),
+      m_owner(EntityCast<Playable>(&owner)),
       m_triggerType(prototype.m_triggerType),
       m_triggerActivation(prototype.m_triggerActivation),
       m_sequenceType(prototype.m_sequenceType)
 {
-    auto triggerFunc = [this](Entity* e) {
-        if (percentage == 1.0f || Random::get<float>(0.0f, 1.0f) < percentage)
-        {
-            Process(e);
-        }
-    };
-
-    handler = TriggerEventHandler(triggerFunc);
+    handler = TriggerEventHandler::Create<Trigger, &Trigger::OnEvent>(this);
 }
 
 void Trigger::Activate(Playable* source, TriggerActivation activation,
@@ -75,8 +64,9 @@ void Trigger::Activate(Playable* source, TriggerActivation activation,
         }
     }
 
-    auto instance = std::make_shared<Trigger>(*this, *source);
     Game* game = source->game;
+    auto instance = std::allocate_shared<Trigger>(
+        ArenaAllocator<Trigger>(game->arena.get()), *this, *source);
 
     source->activatedTrigger = instance;
 
@@ -131,15 +121,14 @@ void Trigger::Activate(Playable* source, TriggerActivation activation,
                 }
                 case TriggerSource::SELF:
                 {
-                    auto minion = dynamic_cast<Minion*>(source);
+                    auto minion = EntityCast<Minion>(source);
                     minion->afterAttackTrigger += instance->handler;
                     break;
                 }
                 case TriggerSource::ENCHANTMENT_TARGET:
                 {
-                    const auto enchantment = dynamic_cast<Enchantment*>(source);
-                    auto minion =
-                        dynamic_cast<Minion*>(enchantment->GetTarget());
+                    const auto enchantment = EntityCast<Enchantment>(source);
+                    auto minion = EntityCast<Minion>(enchantment->GetTarget());
                     minion->afterAttackTrigger += instance->handler;
                     break;
                 }
@@ -170,15 +159,14 @@ void Trigger::Activate(Playable* source, TriggerActivation activation,
                 }
                 case TriggerSource::SELF:
                 {
-                    auto minion = dynamic_cast<Minion*>(source);
+                    auto minion = EntityCast<Minion>(source);
                     minion->preDamageTrigger += instance->handler;
                     break;
                 }
                 case TriggerSource::ENCHANTMENT_TARGET:
                 {
-                    const auto enchantment = dynamic_cast<Enchantment*>(source);
-                    auto minion =
-                        dynamic_cast<Minion*>(enchantment->GetTarget());
+                    const auto enchantment = EntityCast<Enchantment>(source);
+                    auto minion = EntityCast<Minion>(enchantment->GetTarget());
                     minion->preDamageTrigger += instance->handler;
                     break;
                 }
@@ -249,16 +237,14 @@ void Trigger::Remove() const
                 }
                 case TriggerSource::SELF:
                 {
-                    auto minion = dynamic_cast<Minion*>(m_owner);
+                    auto minion = EntityCast<Minion>(m_owner);
                     minion->afterAttackTrigger -= handler;
                     break;
                 }
                 case TriggerSource::ENCHANTMENT_TARGET:
                 {
-                    const auto enchantment =
-                        dynamic_cast<Enchantment*>(m_owner);
-                    auto minion =
-                        dynamic_cast<Minion*>(enchantment->GetTarget());
+                    const auto enchantment = EntityCast<Enchantment>(m_owner);
+                    auto minion = EntityCast<Minion>(enchantment->GetTarget());
                     minion->afterAttackTrigger -= handler;
                     break;
                 }
@@ -287,16 +273,14 @@ void Trigger::Remove() const
                 }
                 case TriggerSource::SELF:
                 {
-                    auto minion = dynamic_cast<Minion*>(m_owner);
+                    auto minion = EntityCast<Minion>(m_owner);
                     minion->preDamageTrigger -= handler;
                     break;
                 }
                 case TriggerSource::ENCHANTMENT_TARGET:
                 {
-                    const auto enchantment =
-                        dynamic_cast<Enchantment*>(m_owner);
-                    auto minion =
-                        dynamic_cast<Minion*>(enchantment->GetTarget());
+                    const auto enchantment = EntityCast<Enchantment>(m_owner);
+                    auto minion = EntityCast<Minion>(enchantment->GetTarget());
                     minion->preDamageTrigger -= handler;
                     break;
                 }
@@ -324,6 +308,16 @@ void Trigger::Remove() const
     }
 }
 
+std::shared_ptr<Trigger> Trigger::Clone(Playable& owner)
+{
+    auto instance = std::allocate_shared<Trigger>(
+        ArenaAllocator<Trigger>(owner.game->arena.get()), *this, owner);
+    instance->percentage = percentage;
+    instance->m_isValidated = m_isValidated;
+
+    return instance;
+}
+
 void Trigger::ValidateTriggers(Game* game, Entity* source, SequenceType type)
 {
     for (auto& trigger : game->triggers)
@@ -335,6 +329,15 @@ void Trigger::ValidateTriggers(Game* game, Entity* source, SequenceType type)
     }
 }
 
+void Trigger::OnEvent(Entity* source)
+{
+    if (percentage == 1.0f ||
+        m_owner->game->GetRandom().Get(0.0f, 1.0f) < percentage)
+    {
+        Process(source);
+    }
+}
+
 void Trigger::Process(Entity* source)
 {
     if (m_sequenceType == SequenceType::NONE)
@@ -366,18 +369,18 @@ void Trigger::ProcessInternal(Entity* source)
         clonedTask->SetPlayer(m_owner->player);
         clonedTask->SetSource(m_owner);
 
-        if (const auto playable = dynamic_cast<Playable*>(source); playable)
+        if (const auto playable = EntityCast<Playable>(source); playable)
         {
             clonedTask->SetTarget(playable);
         }
         else
         {
-            const auto enchantment = dynamic_cast<Enchantment*>(m_owner);
+            const auto enchantment = EntityCast<Enchantment>(m_owner);
 
             if (enchantment != nullptr)
             {
                 const auto enchantPlayable =
-                    dynamic_cast<Playable*>(enchantment->GetTarget());
+                    EntityCast<Playable>(enchantment->GetTarget());
 
                 if (enchantPlayable != nullptr)
                 {
@@ -426,27 +429,27 @@ void Trigger::Validate(Entity* source)
             }
             break;
         case TriggerSource::HERO:
-            if (dynamic_cast<Hero*>(source) == nullptr ||
+            if (EntityCast<Hero>(source) == nullptr ||
                 (source && source->player != m_owner->player))
             {
                 return;
             }
             break;
         case TriggerSource::ALL_MINIONS:
-            if (dynamic_cast<Minion*>(source) == nullptr)
+            if (EntityCast<Minion>(source) == nullptr)
             {
                 return;
             }
             break;
         case TriggerSource::MINIONS:
-            if (dynamic_cast<Minion*>(source) == nullptr ||
+            if (EntityCast<Minion>(source) == nullptr ||
                 (source && source->player != m_owner->player))
             {
                 return;
             }
             break;
         case TriggerSource::MINIONS_EXCEPT_SELF:
-            if (dynamic_cast<Minion*>(source) == nullptr ||
+            if (EntityCast<Minion>(source) == nullptr ||
                 (source && source->player != m_owner->player) ||
                 source == m_owner)
             {
@@ -454,7 +457,7 @@ void Trigger::Validate(Entity* source)
             }
             break;
         case TriggerSource::ENEMY_MINIONS:
-            if (dynamic_cast<Minion*>(source) == nullptr ||
+            if (EntityCast<Minion>(source) == nullptr ||
                 (source && source->player == m_owner->player))
             {
                 return;
@@ -462,7 +465,7 @@ void Trigger::Validate(Entity* source)
             break;
         case TriggerSource::ENCHANTMENT_TARGET:
         {
-            const auto enchantment = dynamic_cast<Enchantment*>(m_owner);
+            const auto enchantment = EntityCast<Enchantment>(m_owner);
             if (enchantment == nullptr || source == nullptr ||
                 enchantment->GetTarget()->id != source->id)
             {
@@ -472,7 +475,7 @@ void Trigger::Validate(Entity* source)
         }
         case TriggerSource::ENEMY_SPELLS:
         {
-            if (dynamic_cast<Spell*>(source) == nullptr ||
+            if (EntityCast<Spell>(source) == nullptr ||
                 (source && source->player == m_owner->player))
             {
                 return;
@@ -516,7 +519,7 @@ void Trigger::Validate(Entity* source)
 
     if (condition != nullptr)
     {
-        const auto playable = dynamic_cast<Playable*>(source);
+        const auto playable = EntityCast<Playable>(source);
         const bool res = (playable != nullptr) ? condition->Evaluate(playable)
                                                : condition->Evaluate(m_owner);
 
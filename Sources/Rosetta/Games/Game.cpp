@@ -4,12 +4,15 @@
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
 #include <Rosetta/Actions/ActionParams.hpp>
+#include <Rosetta/Actions/ActionValidChecker.hpp>
 #include <Rosetta/Actions/Choose.hpp>
 #include <Rosetta/Actions/Draw.hpp>
 #include <Rosetta/Actions/Generic.hpp>
 #include <Rosetta/Actions/Summon.hpp>
+#include <Rosetta/Auras/AdjacentAura.hpp>
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Enchants/Power.hpp>
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Managers/GameManager.hpp>
 #include <Rosetta/Models/Enchantment.hpp>
@@ -20,17 +23,74 @@
 #include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
 #include <Rosetta/Views/BoardRefView.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
 #include <Rosetta/Zones/GraveyardZone.hpp>
-
-#include <effolkronium/random.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
 
 #include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
 
-using Random = effolkronium::random_static;
 using namespace RosettaStone::PlayerTasks;
 
 namespace RosettaStone
 {
+namespace
+{
+//! Returns the slot of \p character relative to \p player.
+//! \param player The current player.
+//! \param character The character.
+//! \return The slot of \p character.
+int GetSlot(const Player* player, const Character* character)
+{
+    if (character == nullptr)
+    {
+        return EncodedAction::NO_SLOT;
+    }
+
+    const int heroSlot = character->player == player
+                             ? EncodedAction::HERO_SLOT
+                             : EncodedAction::OPPONENT_HERO_SLOT;
+    if (character->GetKind() == EntityKind::HERO)
+    {
+        return heroSlot;
+    }
+
+    return heroSlot + 1 + character->GetZonePosition();
+}
+
+//! Returns the character at \p slot relative to \p player.
+//! \param player The current player.
+//! \param slot The slot of the character.
+//! \return The character at \p slot, or nullptr if \p slot is NO_SLOT.
+Character* GetCharacter(Player* player, int slot)
+{
+    if (slot == EncodedAction::NO_SLOT)
+    {
+        return nullptr;
+    }
+
+    Player* owner =
+        slot < EncodedAction::OPPONENT_HERO_SLOT ? player : player->opponent;
+    const int heroSlot = slot < EncodedAction::OPPONENT_HERO_SLOT
+                             ? EncodedAction::HERO_SLOT
+                             : EncodedAction::OPPONENT_HERO_SLOT;
+    if (slot == heroSlot)
+    {
+        return owner->GetHero();
+    }
+
+    const int zonePos = slot - heroSlot - 1;
+    if (slot >= EncodedAction::NUM_SLOTS ||
+        zonePos >= owner->GetFieldZone()->GetCount())
+    {
+        throw std::invalid_argument("Game::Apply() - Invalid slot!");
+    }
+
+    return (*owner->GetFieldZone())[zonePos];
+}
+}  // namespace
+
 Game::Game()
 {
     Initialize();
@@ -40,10 +100,17 @@ Game::Game()
     m_gameConfig.autoRun = true;
 }
 
-Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
+Game::Game(const GameConfig& gameConfig)
+    : arena(gameConfig.useArena ? std::make_unique<Arena>() : nullptr),
+      m_gameConfig(gameConfig)
 {
     Initialize();
 
+    if (m_gameConfig.seed.has_value())
+    {
+        m_random = RandomGenerator(m_gameConfig.seed.value());
+    }
+
     // Add hero and hero power
     GetPlayer1()->AddHeroAndPower(
         Cards::GetHeroCard(gameConfig.player1Class),
@@ -62,37 +129,37 @@ Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
     }
 
     // Set up decks
-    for (auto& card : m_gameConfig.player1Deck)
+    for (Card* card : m_gameConfig.player1Deck)
     {
-        if (card.id.empty())
+        if (card == nullptr)
         {
             continue;
         }
 
         Playable* playable = Entity::GetFromCard(
-            GetPlayer1(), &card, std::nullopt, GetPlayer1()->GetDeckZone());
+            GetPlayer1(), card, std::nullopt, GetPlayer1()->GetDeckZone());
         GetPlayer1()->GetDeckZone()->Add(playable);
 
         //! Set Galakrond hero card
-        if (card.IsGalakrond())
+        if (card->IsGalakrond())
         {
             GetPlayer1()->galakrond = playable;
         }
     }
 
-    for (auto& card : m_gameConfig.player2Deck)
+    for (Card* card : m_gameConfig.player2Deck)
     {
-        if (card.id.empty())
+        if (card == nullptr)
         {
             continue;
         }
 
         Playable* playable = Entity::GetFromCard(
-            GetPlayer2(), &card, std::nullopt, GetPlayer2()->GetDeckZone());
+            GetPlayer2(), card, std::nullopt, GetPlayer2()->GetDeckZone());
         GetPlayer2()->GetDeckZone()->Add(playable);
 
         //! Set Galakrond hero card
-        if (card.IsGalakrond())
+        if (card->IsGalakrond())
         {
             GetPlayer2()->galakrond = playable;
         }
@@ -117,7 +184,7 @@ Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
     {
         case PlayerType::RANDOM:
         {
-            const auto val = Random::get(0, 1);
+            const auto val = m_random.Get(0, 1);
             m_currentPlayer =
                 (val == 0) ? PlayerType::PLAYER1 : PlayerType::PLAYER2;
             break;
@@ -131,9 +198,249 @@ Game::Game(const GameConfig& gameConfig) : m_gameConfig(gameConfig)
     m_turn = 1;
 }
 
+Game::Game(const Game& rhs, CloneTag)
+    : arena(rhs.arena != nullptr ? std::make_unique<Arena>() : nullptr),
+      m_gameConfig(rhs.m_gameConfig)
+{
+    if (!rhs.taskQueue.IsEmpty())
+    {
+        throw std::logic_error(
+            "Game::Game() - Can't clone a game while tasks are pending!");
+    }
+
+    Arena::Scope arenaScope(arena.get());
+
+    Initialize();
+
+    state = rhs.state;
+    step = rhs.step;
+    nextStep = rhs.nextStep;
+    rushMinions = rhs.rushMinions;
+
+    m_turn = rhs.m_turn;
+    m_entityID = rhs.m_entityID;
+    m_oopIndex = rhs.m_oopIndex;
+    m_stateVersion = rhs.m_stateVersion;
+    m_currentPlayer = rhs.m_currentPlayer;
+    m_random = rhs.m_random;
+
+    CloneContext context;
+    context.entities.emplace(&rhs.m_players[0], &m_players[0]);
+    context.entities.emplace(&rhs.m_players[1], &m_players[1]);
+
+    // Pairs of (source, copy) of all playables in the order of creation
+    std::vector<std::pair<const Playable*, Playable*>> playables;
+    playables.reserve(rhs.entityList.size());
+
+    // Copy entities
+    for (const auto& [id, entity] : rhs.entityList)
+    {
+        Playable* copy = entity->Clone(context);
+
+        entityList.emplace(id, copy);
+        context.entities.emplace(entity, copy);
+        playables.emplace_back(entity, copy);
+    }
+
+    // Copy enchantments that are shared between entities and the game
+    std::unordered_map<const Enchantment*, std::shared_ptr<Enchantment>>
+        enchantments;
+    const auto cloneEnchantment =
+        [&](const std::shared_ptr<Enchantment>& enchantment) {
+            const auto iter = enchantments.find(enchantment.get());
+            if (iter != enchantments.end())
+            {
+                return iter->second;
+            }
+
+            std::shared_ptr<Enchantment> copy(
+                static_cast<Enchantment*>(enchantment->Clone(context)));
+            enchantments.emplace(enchantment.get(), copy);
+            context.entities.emplace(enchantment.get(), copy.get());
+            playables.emplace_back(enchantment.get(), copy.get());
+
+            return copy;
+        };
+    const auto cloneEnchantments = [&](const Entity& src, Entity& dst) {
+        dst.appliedEnchantments.clear();
+        for (const auto& enchantment : src.appliedEnchantments)
+        {
+            dst.appliedEnchantments.emplace_back(cloneEnchantment(enchantment));
+        }
+    };
+
+    for (const auto& [id, entity] : rhs.entityList)
+    {
+        cloneEnchantments(*entity, *entityList[id]);
+    }
+    for (std::size_t i = 0; i < m_players.size(); ++i)
+    {
+        cloneEnchantments(rhs.m_players[i], m_players[i]);
+    }
+    for (const auto& enchantment : rhs.oneTurnEffectEnchantments)
+    {
+        oneTurnEffectEnchantments.emplace_back(cloneEnchantment(enchantment));
+    }
+
+    // Copy players and zones, and link heroes with their belongings
+    for (std::size_t i = 0; i < m_players.size(); ++i)
+    {
+        m_players[i].CloneFrom(rhs.m_players[i], context);
+    }
+
+    for (auto& [src, dst] : playables)
+    {
+        if (const auto hero = EntityCast<const Hero>(src); hero != nullptr)
+        {
+            auto heroCopy = static_cast<Hero*>(dst);
+            heroCopy->heroPower = context.Get<HeroPower>(hero->heroPower);
+            heroCopy->weapon = context.Get<Weapon>(hero->weapon);
+        }
+    }
+
+    // Copy triggers and auras of all playables
+    std::unordered_map<const Trigger*, std::shared_ptr<Trigger>> triggerMap;
+    std::unordered_map<const IAura*, IAura*> auraMap;
+
+    for (auto& [src, dst] : playables)
+    {
+        if (src->activatedTrigger != nullptr)
+        {
+            dst->activatedTrigger = src->activatedTrigger->Clone(*dst);
+            triggerMap.emplace(src->activatedTrigger.get(),
+                               dst->activatedTrigger);
+            context.handlers.emplace(src->activatedTrigger->handler.id,
+                                     &dst->activatedTrigger->handler);
+        }
+
+        if (src->ongoingEffect != nullptr)
+        {
+            src->ongoingEffect->Clone(dst);
+            src->ongoingEffect->CloneState(*dst->ongoingEffect, context);
+            auraMap.emplace(src->ongoingEffect, dst->ongoingEffect);
+        }
+    }
+
+    // Subscribe handlers to events in the original order
+    triggerManager.CloneFrom(rhs.triggerManager, context);
+
+    for (auto& [src, dst] : playables)
+    {
+        if (const auto character = EntityCast<const Character>(src);
+            character != nullptr)
+        {
+            auto characterCopy = static_cast<Character*>(dst);
+            characterCopy->preDamageTrigger.CloneFrom(
+                character->preDamageTrigger, context);
+            characterCopy->takeDamageTrigger.CloneFrom(
+                character->takeDamageTrigger, context);
+            characterCopy->afterAttackTrigger.CloneFrom(
+                character->afterAttackTrigger, context);
+        }
+    }
+
+    // Rebuild the lists of auras and triggers in the original order
+    const auto getAura = [&](const IAura* aura) {
+        const auto iter = auraMap.find(aura);
+        return iter != auraMap.end() ? iter->second : nullptr;
+    };
+
+    auras.clear();
+    for (const auto& aura : rhs.auras)
+    {
+        if (const auto copy = getAura(aura); copy != nullptr)
+        {
+            auras.emplace_back(copy);
+        }
+    }
+
+    for (std::size_t i = 0; i < m_players.size(); ++i)
+    {
+        const Player& rhsPlayer = rhs.m_players[i];
+        Player& player = m_players[i];
+
+        const auto copyAuras = [&](const std::vector<Aura*>& src,
+                                   std::vector<Aura*>& dst) {
+            dst.clear();
+            for (const auto& aura : src)
+            {
+                if (const auto copy = getAura(aura); copy != nullptr)
+                {
+                    dst.emplace_back(static_cast<Aura*>(copy));
+                }
+            }
+        };
+        copyAuras(rhsPlayer.GetFieldZone()->auras,
+                  player.GetFieldZone()->auras);
+        copyAuras(rhsPlayer.GetHandZone()->auras, player.GetHandZone()->auras);
+
+        auto& adjacentAuras = player.GetFieldZone()->adjacentAuras;
+        adjacentAuras.clear();
+        for (const auto& aura : rhsPlayer.GetFieldZone()->adjacentAuras)
+        {
+            if (const auto copy = getAura(aura); copy != nullptr)
+            {
+                adjacentAuras.emplace_back(static_cast<AdjacentAura*>(copy));
+            }
+        }
+    }
+
+    for (const auto& trigger : rhs.triggers)
+    {
+        if (const auto iter = triggerMap.find(trigger.get());
+            iter != triggerMap.end())
+        {
+            triggers.emplace_back(iter->second);
+        }
+    }
+
+    // Copy the remaining states of the game
+    for (const auto& [entity, effect] : rhs.oneTurnEffects)
+    {
+        oneTurnEffects.emplace_back(context.Get<Entity>(entity), effect);
+    }
+
+    for (const auto& minion : rhs.summonedMinions)
+    {
+        summonedMinions.emplace_back(context.Get<Minion>(minion));
+    }
+
+    for (const auto& [order, minion] : rhs.deadMinions)
+    {
+        deadMinions.emplace_back(order, context.Get<Minion>(minion));
+    }
+
+    for (const auto& playable : rhs.taskStack.playables)
+    {
+        taskStack.playables.emplace_back(context.Get<Playable>(playable));
+    }
+    taskStack.num = rhs.taskStack.num;
+    taskStack.source = context.Get<Entity>(rhs.taskStack.source);
+    taskStack.target = context.Get<Playable>(rhs.taskStack.target);
+    taskStack.flag = rhs.taskStack.flag;
+
+    if (rhs.currentEventData != nullptr)
+    {
+        currentEventData = std::make_unique<EventMetaData>(
+            context.Get<Playable>(rhs.currentEventData->eventSource),
+            context.Get<Playable>(rhs.currentEventData->eventTarget),
+            rhs.currentEventData->eventNumber);
+    }
+
+    // Activating auras may have touched aura effects, so copy them last
+    for (auto& [src, dst] : context.entities)
+    {
+        delete dst->auraEffects;
+        dst->auraEffects = src->auraEffects != nullptr
+                               ? new AuraEffects(*src->auraEffects)
+                               : nullptr;
+    }
+}
+
 void Game::Initialize()
 {
     rushMinions.reserve(MAX_FIELD_SIZE);
+    deadMinions.reserve(2 * MAX_FIELD_SIZE);
 
     // Set game to player
     for (auto& p : m_players)
@@ -183,6 +490,13 @@ void Game::RefCopyFrom(const Game& rhs)
 
     m_entityID = rhs.m_entityID;
     m_oopIndex = rhs.m_oopIndex;
+    m_stateVersion = rhs.m_stateVersion;
+    m_random = rhs.m_random;
+}
+
+std::unique_ptr<Game> Game::Clone() const
+{
+    return std::make_unique<Game>(*this, CloneTag{});
 }
 
 FormatType Game::GetFormatType() const
@@ -275,6 +589,36 @@ std::size_t Game::GetNextOOP()
     return m_oopIndex++;
 }
 
+std::size_t Game::GetStateVersion() const
+{
+    return m_stateVersion;
+}
+
+std::size_t Game::IncreaseStateVersion()
+{
+    return ++m_stateVersion;
+}
+
+RandomGenerator& Game::GetRandom()
+{
+    return m_random;
+}
+
+std::uint64_t Game::GetSeed() const
+{
+    return m_random.GetSeed();
+}
+
+void Game::SetSeed(std::uint64_t seed)
+{
+    m_random = RandomGenerator(seed);
+}
+
+void Game::SetAuraVerification(bool enable)
+{
+    m_verifyAuras = enable;
+}
+
 void Game::BeginFirst()
 {
     // Set next step
@@ -665,9 +1009,11 @@ void Game::ProcessGraveyard()
     // Destroy minions
     if (!deadMinions.empty())
     {
-        for (auto& deadMinion : deadMinions)
+        // NOTE: The minions can be added while destroying, so the next
+        // minion is looked up by the order of play
+        for (std::size_t idx = 0; idx < deadMinions.size();)
         {
-            Minion* minion = deadMinion.second;
+            const auto [order, minion] = deadMinions[idx];
 
             // Death event created
             triggerManager.OnDeathTrigger(minion);
@@ -692,6 +1038,13 @@ void Game::ProcessGraveyard()
             {
                 Generic::SummonReborn(minion);
             }
+
+            idx = std::upper_bound(deadMinions.begin(), deadMinions.end(),
+                                   order,
+                                   [](std::size_t lhs, const auto& rhs) {
+                                       return lhs < rhs.first;
+                                   }) -
+                  deadMinions.begin();
         }
 
         deadMinions.clear();
@@ -708,6 +1061,19 @@ void Game::UpdateAura()
         return;
     }
 
+    if (m_verifyAuras)
+    {
+        for (auto& aura : auras)
+        {
+            if (!aura->IsConsistent())
+            {
+                throw std::logic_error(
+                    "Game::UpdateAura() - The incremental update of an aura "
+                    "doesn't match the full recomputation!");
+            }
+        }
+    }
+
     for (int i = auraSize - 1; i >= 0; --i)
     {
         auras[i]->Update();
@@ -717,6 +1083,8 @@ void Game::UpdateAura()
 std::tuple<PlayState, PlayState> Game::Process(Player* player,
                                                std::unique_ptr<ITask> task)
 {
+    Arena::Scope arenaScope(arena.get());
+
     // Process task
     task->SetPlayer(player);
     Task::Run(std::move(task));
@@ -728,6 +1096,8 @@ std::tuple<PlayState, PlayState> Game::Process(Player* player,
 
 std::tuple<PlayState, PlayState> Game::Process(Player* player, ITask&& task)
 {
+    Arena::Scope arenaScope(arena.get());
+
     // Process task
     task.SetPlayer(player);
     Task::Run(std::move(task));
@@ -782,7 +1152,8 @@ std::tuple<PlayState, PlayState> Game::PerformAction(ActionParams& params)
         {
             Character* source = params.GetAttacker();
             Character* target = params.GetSpecifiedTarget(
-                source->GetValidAttackTargets(GetCurrentPlayer()->opponent));
+                source->GetValidAttackTargets(GetCurrentPlayer()->opponent)
+                    .ToVector());
             task = std::make_unique<AttackTask>(source, target);
             break;
         }
@@ -808,6 +1179,150 @@ std::tuple<PlayState, PlayState> Game::PerformAction(ActionParams& params)
     return Process(GetCurrentPlayer(), std::move(task));
 }
 
+std::vector<EncodedAction> Game::GetLegalActions() const
+{
+    std::vector<EncodedAction> actions;
+    GetLegalActions(actions);
+
+    return actions;
+}
+
+void Game::GetLegalActions(std::vector<EncodedAction>& actions) const
+{
+    actions.clear();
+
+    const Player* player = GetCurrentPlayer();
+
+    ActionValidChecker checker;
+    checker.Check(*this);
+
+    for (Playable* playable : checker.GetPlayableCards())
+    {
+        const int handPos = playable->GetZonePosition();
+
+        auto targets = playable->GetValidPlayTargets();
+        if (targets.empty())
+        {
+            targets.emplace_back(nullptr);
+        }
+
+        const int numFieldPos =
+            playable->card->GetCardType() == CardType::MINION
+                ? player->GetFieldZone()->GetCount() + 1
+                : 1;
+        const int numChooseOne =
+            playable->HasChooseOne()
+                ? static_cast<int>(playable->card->chooseCardIDs.size())
+                : 0;
+
+        for (Character* target : targets)
+        {
+            const int targetSlot = GetSlot(player, target);
+
+            for (int fieldPos = 0; fieldPos < numFieldPos; ++fieldPos)
+            {
+                if (numChooseOne == 0)
+                {
+                    actions.emplace_back(
+                        EncodedAction::PlayCard(handPos, targetSlot, fieldPos));
+                    continue;
+                }
+
+                for (int chooseOne = 1; chooseOne <= numChooseOne; ++chooseOne)
+                {
+                    actions.emplace_back(EncodedAction::PlayCard(
+                        handPos, targetSlot, fieldPos, chooseOne));
+                }
+            }
+        }
+    }
+
+    for (Character* attacker : checker.GetAttackers())
+    {
+        const int sourceSlot = GetSlot(player, attacker);
+
+        for (Character* target :
+             attacker->GetValidAttackTargets(player->opponent))
+        {
+            actions.emplace_back(
+                EncodedAction::Attack(sourceSlot, GetSlot(player, target)));
+        }
+    }
+
+    checker.ForEachMainOp([&](std::size_t, MainOpType mainOp) {
+        if (mainOp != MainOpType::USE_HERO_POWER)
+        {
+            return true;
+        }
+
+        const auto targets = player->GetHeroPower().GetValidPlayTargets();
+        if (targets.empty())
+        {
+            actions.emplace_back(EncodedAction::HeroPower());
+        }
+
+        for (Character* target : targets)
+        {
+            actions.emplace_back(
+                EncodedAction::HeroPower(GetSlot(player, target)));
+        }
+
+        return false;
+    });
+
+    actions.emplace_back(EncodedAction::EndTurn());
+}
+
+std::tuple<PlayState, PlayState> Game::Apply(EncodedAction action)
+{
+    Player* player = GetCurrentPlayer();
+
+    switch (action.GetMainOp())
+    {
+        case MainOpType::PLAY_CARD:
+        {
+            HandZone& handZone = *player->GetHandZone();
+            if (action.GetSource() >= handZone.GetCount())
+            {
+                throw std::invalid_argument(
+                    "Game::Apply() - Invalid hand position!");
+            }
+
+            Playable* playCard = handZone[action.GetSource()];
+            Character* target = GetCharacter(player, action.GetTarget());
+            return Process(player,
+                           PlayCardTask(playCard, target, action.GetFieldPos(),
+                                        action.GetChooseOne()));
+        }
+        case MainOpType::ATTACK:
+        {
+            Character* source = GetCharacter(player, action.GetSource());
+            if (source == nullptr || source->player != player)
+            {
+                throw std::invalid_argument(
+                    "Game::Apply() - Invalid attacker!");
+            }
+
+            Character* target = GetCharacter(player, action.GetTarget());
+            return Process(player, AttackTask(source, target));
+        }
+        case MainOpType::USE_HERO_POWER:
+        {
+            Character* target = GetCharacter(player, action.GetTarget());
+            return Process(player, HeroPowerTask(target));
+        }
+        case MainOpType::END_TURN:
+        {
+            return Process(player, EndTurnTask());
+        }
+        default:
+        {
+            throw std::invalid_argument(
+                "Game::Apply() - Invalid main op type!");
+        }
+    }
+}
+
 ReducedBoardView Game::CreateView()
 {
     if (m_currentPlayer == PlayerType::PLAYER1)
@@ -33,10 +33,11 @@ GameRestorer GameRestorer::Prepare(BoardView& view,
 
 std::unique_ptr<Game> GameRestorer::RestoreGame()
 {
-    p1UnknownCardsManager.Prepare();
-    p2UnknownCardsManager.Prepare();
+    p1UnknownCardsManager.Prepare(m_random);
+    p2UnknownCardsManager.Prepare(m_random);
 
     std::unique_ptr<Game> game = std::make_unique<Game>();
+    game->SetSeed(m_random());
     MakePlayer(PlayerType::PLAYER1, *game, m_view.GetPlayer1(),
                p1UnknownCardsManager);
     MakePlayer(PlayerType::PLAYER2, *game, m_view.GetPlayer2(),
@@ -0,0 +1,371 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Games/VectorEnv.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace RosettaStone
+{
+VectorEnv::VectorEnv(const GameConfig& config, std::size_t numEnvs,
+                     std::size_t numThreads)
+    : m_config(config),
+      m_numEnvs(numEnvs),
+      m_games(numEnvs),
+      m_episodes(numEnvs, 0),
+      m_legalActions(numEnvs),
+      m_observations(numEnvs * NUM_FEATURES, 0.0f),
+      m_actionMasks(numEnvs * NUM_ACTIONS, 0),
+      m_rewards(numEnvs, 0.0f),
+      m_dones(numEnvs, 0)
+{
+    m_config.autoRun = true;
+    m_config.skipMulligan = true;
+
+    if (numThreads == 0)
+    {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    // NOTE: The calling thread also runs the jobs
+    const std::size_t numWorkers = std::min(numThreads, numEnvs);
+    for (std::size_t i = 1; i < numWorkers; ++i)
+    {
+        m_workers.emplace_back(&VectorEnv::WorkerLoop, this);
+    }
+
+    Reset();
+}
+
+VectorEnv::~VectorEnv()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_startCond.notify_all();
+
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void VectorEnv::Reset()
+{
+    RunParallel([this](std::size_t idx) {
+        ResetGame(idx);
+        WriteState(idx);
+    });
+
+    std::fill(m_rewards.begin(), m_rewards.end(), 0.0f);
+    std::fill(m_dones.begin(), m_dones.end(), 0);
+}
+
+void VectorEnv::Step(const std::int32_t* actions)
+{
+    // Validate all actions before changing any game
+    for (std::size_t i = 0; i < m_numEnvs; ++i)
+    {
+        const std::int32_t action = actions[i];
+        if (action < 0 || static_cast<std::size_t>(action) >= NUM_ACTIONS ||
+            m_actionMasks[i * NUM_ACTIONS + action] == 0)
+        {
+            throw std::invalid_argument("VectorEnv::Step() - Illegal action!");
+        }
+    }
+
+    RunParallel(
+        [this, actions](std::size_t idx) { StepGame(idx, actions[idx]); });
+}
+
+void VectorEnv::Step(const std::vector<std::int32_t>& actions)
+{
+    if (actions.size() != m_numEnvs)
+    {
+        throw std::invalid_argument(
+            "VectorEnv::Step() - The number of actions is mismatched!");
+    }
+
+    Step(actions.data());
+}
+
+std::size_t VectorEnv::GetNumEnvs() const
+{
+    return m_numEnvs;
+}
+
+const Game& VectorEnv::GetGame(std::size_t idx) const
+{
+    return *m_games.at(idx);
+}
+
+const float* VectorEnv::GetObservations() const
+{
+    return m_observations.data();
+}
+
+const std::uint8_t* VectorEnv::GetActionMasks() const
+{
+    return m_actionMasks.data();
+}
+
+const float* VectorEnv::GetRewards() const
+{
+    return m_rewards.data();
+}
+
+const std::uint8_t* VectorEnv::GetDones() const
+{
+    return m_dones.data();
+}
+
+int VectorEnv::ToActionIndex(EncodedAction action)
+{
+    const int source = action.GetSource();
+    const int target = action.GetTarget();
+
+    if (target >= EncodedAction::NUM_SLOTS)
+    {
+        return -1;
+    }
+
+    switch (action.GetMainOp())
+    {
+        case MainOpType::PLAY_CARD:
+        {
+            const int fieldPos = action.GetFieldPos();
+            const int chooseOne = action.GetChooseOne();
+            if (source >= MAX_HAND_SIZE || fieldPos >= NUM_FIELD_POS ||
+                chooseOne >= NUM_CHOOSE_ONE)
+            {
+                return -1;
+            }
+
+            return PLAY_CARD_OFFSET +
+                   ((source * EncodedAction::NUM_SLOTS + target) *
+                        NUM_FIELD_POS +
+                    fieldPos) *
+                       NUM_CHOOSE_ONE +
+                   chooseOne;
+        }
+        case MainOpType::ATTACK:
+            if (source >= EncodedAction::NUM_SLOTS)
+            {
+                return -1;
+            }
+            return ATTACK_OFFSET + source * EncodedAction::NUM_SLOTS + target;
+        case MainOpType::USE_HERO_POWER:
+            return HERO_POWER_OFFSET + target;
+        case MainOpType::END_TURN:
+            return END_TURN_OFFSET;
+        default:
+            return -1;
+    }
+}
+
+EncodedAction VectorEnv::FromActionIndex(int idx)
+{
+    if (idx < 0 || static_cast<std::size_t>(idx) >= NUM_ACTIONS)
+    {
+        throw std::invalid_argument(
+            "VectorEnv::FromActionIndex() - Invalid index!");
+    }
+
+    if (idx < ATTACK_OFFSET)
+    {
+        int value = idx - PLAY_CARD_OFFSET;
+        const int chooseOne = value % NUM_CHOOSE_ONE;
+        value /= NUM_CHOOSE_ONE;
+        const int fieldPos = value % NUM_FIELD_POS;
+        value /= NUM_FIELD_POS;
+        const int target = value % EncodedAction::NUM_SLOTS;
+        const int handPos = value / EncodedAction::NUM_SLOTS;
+
+        return EncodedAction::PlayCard(handPos, target, fieldPos, chooseOne);
+    }
+
+    if (idx < HERO_POWER_OFFSET)
+    {
+        const int value = idx - ATTACK_OFFSET;
+        return EncodedAction::Attack(value / EncodedAction::NUM_SLOTS,
+                                     value % EncodedAction::NUM_SLOTS);
+    }
+
+    if (idx < END_TURN_OFFSET)
+    {
+        return EncodedAction::HeroPower(idx - HERO_POWER_OFFSET);
+    }
+
+    return EncodedAction::EndTurn();
+}
+
+void VectorEnv::ResetGame(std::size_t idx)
+{
+    GameConfig config = m_config;
+    if (m_config.seed.has_value())
+    {
+        const std::uint64_t streamID =
+            (static_cast<std::uint64_t>(idx) << 32) | m_episodes[idx];
+        config.seed =
+            RandomGenerator(m_config.seed.value()).Fork(streamID).GetSeed();
+    }
+    ++m_episodes[idx];
+
+    // Destroy the old game first so that its memory can be reused
+    m_games[idx].reset();
+    m_games[idx] = std::make_unique<Game>(config);
+    m_games[idx]->Start();
+}
+
+void VectorEnv::StepGame(std::size_t idx, int action)
+{
+    Game& game = *m_games[idx];
+    const Player* player = game.GetCurrentPlayer();
+
+    game.Apply(FromActionIndex(action));
+
+    if (game.state == State::COMPLETE)
+    {
+        switch (player->playState)
+        {
+            case PlayState::WON:
+                m_rewards[idx] = 1.0f;
+                break;
+            case PlayState::LOST:
+            case PlayState::CONCEDED:
+                m_rewards[idx] = -1.0f;
+                break;
+            default:
+                m_rewards[idx] = 0.0f;
+                break;
+        }
+        m_dones[idx] = 1;
+
+        ResetGame(idx);
+    }
+    else
+    {
+        m_rewards[idx] = 0.0f;
+        m_dones[idx] = 0;
+    }
+
+    WriteState(idx);
+}
+
+void VectorEnv::WriteState(std::size_t idx)
+{
+    const Game& game = *m_games[idx];
+    FeatureEncoder::Encode(game, m_observations.data() + idx * NUM_FEATURES);
+
+    std::uint8_t* mask = m_actionMasks.data() + idx * NUM_ACTIONS;
+    std::fill(mask, mask + NUM_ACTIONS, 0);
+
+    game.GetLegalActions(m_legalActions[idx]);
+    for (const auto& action : m_legalActions[idx])
+    {
+        const int actionIdx = ToActionIndex(action);
+        if (actionIdx >= 0)
+        {
+            mask[actionIdx] = 1;
+        }
+    }
+}
+
+void VectorEnv::RunParallel(const std::function<void(std::size_t)>& job)
+{
+    if (m_workers.empty())
+    {
+        for (std::size_t i = 0; i < m_numEnvs; ++i)
+        {
+            job(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_nextIdx = 0;
+        m_exception = nullptr;
+        m_numRunning = m_workers.size();
+        ++m_generation;
+    }
+    m_startCond.notify_all();
+
+    RunJobs();
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_doneCond.wait(lock, [this] { return m_numRunning == 0; });
+        m_job = nullptr;
+        exception = m_exception;
+    }
+
+    if (exception)
+    {
+        std::rethrow_exception(exception);
+    }
+}
+
+void VectorEnv::RunJobs()
+{
+    while (true)
+    {
+        const std::size_t idx = m_nextIdx.fetch_add(1);
+        if (idx >= m_numEnvs)
+        {
+            break;
+        }
+
+        try
+        {
+            (*m_job)(idx);
+        }
+        catch (...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_exception)
+            {
+                m_exception = std::current_exception();
+            }
+        }
+    }
+}
+
+void VectorEnv::WorkerLoop()
+{
+    std::size_t generation = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_startCond.wait(lock, [this, generation] {
+                return m_stop || m_generation != generation;
+            });
+
+            if (m_stop)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        RunJobs();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_numRunning == 0)
+            {
+                m_doneCond.notify_one();
+            }
+        }
+    }
+}
+}  // namespace RosettaStone
@@ -0,0 +1,235 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Commons/Macros.hpp>
+#include <Rosetta/Commons/MappedFile.hpp>
+#include <Rosetta/Loaders/CardImage.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+namespace RosettaStone
+{
+namespace
+{
+constexpr char MAGIC[4] = { 'R', 'S', 'C', 'I' };
+
+struct Header
+{
+    char magic[4];
+    std::uint32_t version;
+    std::uint64_t checksum;
+    std::uint32_t numCards;
+    std::uint32_t numTags;
+    std::uint32_t stringPoolSize;
+    std::uint32_t reserved;
+};
+
+struct Record
+{
+    std::uint32_t idOffset;
+    std::uint32_t idSize;
+    std::uint32_t nameOffset;
+    std::uint32_t nameSize;
+    std::uint32_t textOffset;
+    std::uint32_t textSize;
+    std::int32_t dbfID;
+    std::uint32_t tagOffset;
+    std::uint32_t tagCount;
+    std::uint32_t reserved;
+};
+
+struct Tag
+{
+    std::int32_t tag;
+    std::int32_t value;
+};
+
+static_assert(sizeof(Header) == 32, "The size of header must be fixed");
+static_assert(sizeof(Record) == 40, "The size of record must be fixed");
+static_assert(sizeof(Tag) == 8, "The size of tag must be fixed");
+
+//! Checks the string of [\p offset, \p offset + \p size) is in the pool.
+bool IsInPool(std::uint32_t offset, std::uint32_t size, std::uint32_t poolSize)
+{
+    return offset <= poolSize && size <= poolSize - offset;
+}
+}  // namespace
+
+std::uint64_t CardImage::ComputeChecksum(const char* data, std::size_t size)
+{
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        hash ^= static_cast<unsigned char>(data[i]);
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+bool CardImage::Load(const std::string& path, std::uint64_t checksum,
+                     std::vector<Card*>& cards)
+{
+    const MappedFile file(path);
+    if (file.GetData() == nullptr || file.GetSize() < sizeof(Header))
+    {
+        return false;
+    }
+
+    Header header{};
+    std::memcpy(&header, file.GetData(), sizeof(Header));
+
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 ||
+        header.version != VERSION || header.checksum != checksum)
+    {
+        return false;
+    }
+
+    const std::size_t recordsSize =
+        static_cast<std::size_t>(header.numCards) * sizeof(Record);
+    const std::size_t tagsSize =
+        static_cast<std::size_t>(header.numTags) * sizeof(Tag);
+    if (file.GetSize() !=
+        sizeof(Header) + recordsSize + tagsSize + header.stringPoolSize)
+    {
+        return false;
+    }
+
+    // NOTE: The mapping is aligned to a page and all sections are aligned to
+    // 8 bytes, so the records can be read in place
+    const auto records =
+        reinterpret_cast<const Record*>(file.GetData() + sizeof(Header));
+    const auto tags = reinterpret_cast<const Tag*>(
+        file.GetData() + sizeof(Header) + recordsSize);
+    const char* pool = file.GetData() + sizeof(Header) + recordsSize + tagsSize;
+
+    // Validate all records before creating any card
+    for (std::size_t i = 0; i < header.numCards; ++i)
+    {
+        const Record& record = records[i];
+        if (!IsInPool(record.idOffset, record.idSize, header.stringPoolSize) ||
+            !IsInPool(record.nameOffset, record.nameSize,
+                      header.stringPoolSize) ||
+            !IsInPool(record.textOffset, record.textSize,
+                      header.stringPoolSize) ||
+            record.tagOffset > header.numTags ||
+            record.tagCount > header.numTags - record.tagOffset)
+        {
+            return false;
+        }
+    }
+
+    cards.reserve(cards.size() + header.numCards);
+
+    for (std::size_t i = 0; i < header.numCards; ++i)
+    {
+        const Record& record = records[i];
+
+        Card* card = new Card();
+        card->id.assign(pool + record.idOffset, record.idSize);
+        card->dbfID = record.dbfID;
+        card->name.assign(pool + record.nameOffset, record.nameSize);
+        card->text.assign(pool + record.textOffset, record.textSize);
+
+        // NOTE: Tags are sorted, so each one is inserted at the end of the map
+        for (std::size_t j = 0; j < record.tagCount; ++j)
+        {
+            const Tag& tag = tags[record.tagOffset + j];
+            card->gameTags.emplace_hint(card->gameTags.end(),
+                                        static_cast<GameTag>(tag.tag),
+                                        tag.value);
+        }
+
+        cards.emplace_back(card);
+    }
+
+    return true;
+}
+
+bool CardImage::Save(const std::string& path, std::uint64_t checksum,
+                     const std::vector<Card*>& cards)
+{
+    std::vector<Record> records;
+    std::vector<Tag> tags;
+    std::string pool;
+
+    records.reserve(cards.size());
+
+    const auto addString = [&](const std::string& str,
+                               std::uint32_t& offset, std::uint32_t& size) {
+        offset = static_cast<std::uint32_t>(pool.size());
+        size = static_cast<std::uint32_t>(str.size());
+        pool += str;
+    };
+
+    for (const Card* card : cards)
+    {
+        Record record{};
+        addString(card->id, record.idOffset, record.idSize);
+        addString(card->name, record.nameOffset, record.nameSize);
+        addString(card->text, record.textOffset, record.textSize);
+        record.dbfID = card->dbfID;
+        record.tagOffset = static_cast<std::uint32_t>(tags.size());
+        record.tagCount = static_cast<std::uint32_t>(card->gameTags.size());
+
+        for (const auto& [tag, value] : card->gameTags)
+        {
+            tags.push_back({ static_cast<std::int32_t>(tag), value });
+        }
+
+        records.emplace_back(record);
+    }
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.checksum = checksum;
+    header.numCards = static_cast<std::uint32_t>(records.size());
+    header.numTags = static_cast<std::uint32_t>(tags.size());
+    header.stringPoolSize = static_cast<std::uint32_t>(pool.size());
+
+    // Write to a temporary file first so that a reader never sees a
+    // partially written image
+    const std::string tempPath = path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+        file.write(reinterpret_cast<const char*>(records.data()),
+                   static_cast<std::streamsize>(records.size() *
+                                                sizeof(Record)));
+        file.write(reinterpret_cast<const char*>(tags.data()),
+                   static_cast<std::streamsize>(tags.size() * sizeof(Tag)));
+        file.write(pool.data(), static_cast<std::streamsize>(pool.size()));
+
+        if (!file)
+        {
+            file.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+#if defined(ROSETTASTONE_WINDOWS)
+    // NOTE: rename() doesn't replace an existing file on Windows
+    std::remove(path.c_str());
+#endif
+
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0)
+    {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    return true;
+}
+}  // namespace RosettaStone
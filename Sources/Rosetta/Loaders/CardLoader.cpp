@@ -4,6 +4,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Loaders/CardImage.hpp>
 #include <Rosetta/Loaders/CardLoader.hpp>
 
 #include <fstream>
@@ -11,17 +12,43 @@
 namespace RosettaStone
 {
 void CardLoader::Load(std::vector<Card*>& cards)
+{
+    Load(RESOURCES_DIR "cards.json", RESOURCES_DIR "cards.bin", cards);
+}
+
+void CardLoader::Load(const std::string& jsonPath,
+                      const std::string& imagePath, std::vector<Card*>& cards)
 {
     // Read card data from JSON file
-    std::ifstream cardFile(RESOURCES_DIR "cards.json");
-    nlohmann::json j;
+    std::ifstream cardFile(jsonPath, std::ios::binary | std::ios::ate);
 
     if (!cardFile.is_open())
     {
         throw std::runtime_error("Can't open cards.json");
     }
 
-    cardFile >> j;
+    std::string json(static_cast<std::size_t>(cardFile.tellg()), '\0');
+    cardFile.seekg(0);
+    cardFile.read(json.data(), static_cast<std::streamsize>(json.size()));
+    cardFile.close();
+
+    const std::uint64_t checksum =
+        CardImage::ComputeChecksum(json.data(), json.size());
+    if (CardImage::Load(imagePath, checksum, cards))
+    {
+        return;
+    }
+
+    LoadFromJSON(json, cards);
+
+    // NOTE: Failing to write the image is fine, e.g. in a read-only directory
+    CardImage::Save(imagePath, checksum, cards);
+}
+
+void CardLoader::LoadFromJSON(const std::string& json,
+                              std::vector<Card*>& cards)
+{
+    nlohmann::json j = nlohmann::json::parse(json);
 
     cards.reserve(j.size());
 
@@ -128,7 +155,5 @@ void CardLoader::Load(std::vector<Card*>& cards)
 
         cards.emplace_back(card);
     }
-
-    cardFile.close();
 }
 }  // namespace RosettaStone
@@ -11,10 +11,12 @@ namespace RosettaStone
 {
 void InternalCardLoader::Load(std::vector<Card*>& cards)
 {
+    // NOTE: Look up by reference; copying a card def copies its power
+    CardDefs::GetInstance();
+
     for (auto& card : cards)
     {
-        const auto cardDef =
-            CardDefs::GetInstance().FindCardDefByCardID(card->id);
+        const CardDef& cardDef = CardDefs::FindCardDefByCardID(card->id);
 
         card->power = cardDef.power;
         card->playRequirements = cardDef.playReqs;
@@ -10,6 +10,8 @@ namespace RosettaStone
 {
 void GameManager::ProcessNextStep(Game& game, Step step)
 {
+    Arena::Scope arenaScope(game.arena.get());
+
     switch (step)
     {
         case Step::BEGIN_FIRST:
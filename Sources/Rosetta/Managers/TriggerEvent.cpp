@@ -4,6 +4,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Managers/TriggerEvent.hpp>
 
 #include <algorithm>
@@ -12,31 +13,25 @@ namespace RosettaStone
 {
 void TriggerEvent::AddHandler(const TriggerEventHandler& handler)
 {
-    m_handlers.emplace_back(std::make_unique<TriggerEventHandler>(handler));
+    m_handlers.emplace_back(handler);
 }
 
 void TriggerEvent::RemoveHandler(const TriggerEventHandler& handler)
 {
-    if (m_isNotifying)
+    const auto iter = std::find(m_handlers.begin(), m_handlers.end(), handler);
+    if (iter == m_handlers.end())
     {
-        for (auto& _handler : m_handlers)
-        {
-            if (*_handler == handler)
-            {
-                _handler->toBeRemoved = true;
-                break;
-            }
-        }
+        return;
+    }
+
+    if (m_notifyDepth > 0)
+    {
+        iter->toBeRemoved = true;
+        m_hasRemovedHandlers = true;
     }
     else
     {
-        m_handlers.erase(
-            std::remove_if(
-                m_handlers.begin(), m_handlers.end(),
-                [&](const std::unique_ptr<TriggerEventHandler>& _handler) {
-                    return *_handler == handler;
-                }),
-            m_handlers.end());
+        m_handlers.erase(iter);
     }
 }
 
@@ -59,26 +54,50 @@ TriggerEvent& TriggerEvent::operator-=(const TriggerEventHandler& handler)
     return *this;
 }
 
-void TriggerEvent::NotifyHandlers(Entity* entity)
+void TriggerEvent::CloneFrom(const TriggerEvent& rhs,
+                             const CloneContext& context)
 {
-    m_isNotifying = true;
+    m_handlers.clear();
+    m_handlers.reserve(rhs.m_handlers.size());
 
-    for (auto& func : m_handlers)
+    for (auto& handler : rhs.m_handlers)
     {
-        if (func != nullptr)
+        if (handler.toBeRemoved)
+        {
+            continue;
+        }
+
+        if (const auto iter = context.handlers.find(handler.id);
+            iter != context.handlers.end())
         {
-            (*func)(entity);
+            m_handlers.emplace_back(*iter->second);
         }
     }
+}
 
-    m_handlers.erase(
-        std::remove_if(
-            m_handlers.begin(), m_handlers.end(),
-            [&](const std::unique_ptr<TriggerEventHandler>& handler) {
-                return handler->toBeRemoved;
-            }),
-        m_handlers.end());
+void TriggerEvent::NotifyHandlers(Entity* entity)
+{
+    ++m_notifyDepth;
 
-    m_isNotifying = false;
+    // The handlers added while notifying are run from the next notification.
+    // The handler is copied because adding one can reallocate the list.
+    const std::size_t count = m_handlers.size();
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const TriggerEventHandler handler = m_handlers[i];
+        handler(entity);
+    }
+
+    --m_notifyDepth;
+
+    if (m_notifyDepth == 0 && m_hasRemovedHandlers)
+    {
+        m_handlers.erase(std::remove_if(m_handlers.begin(), m_handlers.end(),
+                                        [](const TriggerEventHandler& handler) {
+                                            return handler.toBeRemoved;
+                                        }),
+                         m_handlers.end());
+        m_hasRemovedHandlers = false;
+    }
 }
 }  // namespace RosettaStone
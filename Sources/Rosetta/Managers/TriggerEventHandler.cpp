@@ -6,8 +6,6 @@
 
 #include <Rosetta/Managers/TriggerEventHandler.hpp>
 
-#include <utility>
-
 namespace RosettaStone
 {
 int TriggerEventHandler::counter = 0;
@@ -17,51 +15,17 @@ TriggerEventHandler::TriggerEventHandler() : id(0)
     // Do nothing
 }
 
-TriggerEventHandler::TriggerEventHandler(Func func)
-    : id(++counter), m_func(std::move(func))
+TriggerEventHandler::TriggerEventHandler(void* object, Func func)
+    : id(++counter), m_object(object), m_func(func)
 {
     // Do nothing
 }
 
-TriggerEventHandler& TriggerEventHandler::operator=(
-    const TriggerEventHandler& handler)
-{
-    if (&handler == this)
-    {
-        return *this;
-    }
-
-    if (m_func == nullptr)
-    {
-        m_func = handler;
-        id = ++counter;
-    }
-
-    return *this;
-}
-
-TriggerEventHandler& TriggerEventHandler::operator=(
-    TriggerEventHandler&& handler) noexcept
-{
-    if (&handler == this)
-    {
-        return *this;
-    }
-
-    if (m_func == nullptr)
-    {
-        m_func = handler;
-        id = ++counter;
-    }
-
-    return *this;
-}
-
 void TriggerEventHandler::operator()(Entity* entity) const
 {
-    if (m_func)
+    if (m_func != nullptr)
     {
-        m_func(entity);
+        m_func(m_object, entity);
     }
 }
 
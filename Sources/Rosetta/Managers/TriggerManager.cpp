@@ -97,4 +97,27 @@ void TriggerManager::OnUseHeroPowerTrigger(Entity* sender)
 {
     useHeroPowerTrigger(sender);
 }
+
+void TriggerManager::CloneFrom(const TriggerManager& rhs,
+                               const CloneContext& context)
+{
+    startTurnTrigger.CloneFrom(rhs.startTurnTrigger, context);
+    endTurnTrigger.CloneFrom(rhs.endTurnTrigger, context);
+    playCardTrigger.CloneFrom(rhs.playCardTrigger, context);
+    playMinionTrigger.CloneFrom(rhs.playMinionTrigger, context);
+    afterPlayMinionTrigger.CloneFrom(rhs.afterPlayMinionTrigger, context);
+    castSpellTrigger.CloneFrom(rhs.castSpellTrigger, context);
+    afterCastTrigger.CloneFrom(rhs.afterCastTrigger, context);
+    secretRevealedTrigger.CloneFrom(rhs.secretRevealedTrigger, context);
+    giveHealTrigger.CloneFrom(rhs.giveHealTrigger, context);
+    takeHealTrigger.CloneFrom(rhs.takeHealTrigger, context);
+    attackTrigger.CloneFrom(rhs.attackTrigger, context);
+    summonTrigger.CloneFrom(rhs.summonTrigger, context);
+    afterSummonTrigger.CloneFrom(rhs.afterSummonTrigger, context);
+    dealDamageTrigger.CloneFrom(rhs.dealDamageTrigger, context);
+    takeDamageTrigger.CloneFrom(rhs.takeDamageTrigger, context);
+    targetTrigger.CloneFrom(rhs.targetTrigger, context);
+    deathTrigger.CloneFrom(rhs.deathTrigger, context);
+    useHeroPowerTrigger.CloneFrom(rhs.useHeroPowerTrigger, context);
+}
 }  // namespace RosettaStone
@@ -11,6 +11,7 @@
 #include <Rosetta/Zones/FieldZone.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <utility>
 
 namespace RosettaStone
@@ -22,6 +23,12 @@ Character::Character(Player* player, Card* card, std::map<GameTag, int> tags,
     // Do nothing
 }
 
+Character::Character(Player* player, const Character& rhs)
+    : Playable(player, rhs)
+{
+    // Do nothing
+}
+
 int Character::GetAttack() const
 {
     const int value = GetGameTag(GameTag::ATK);
@@ -192,14 +199,14 @@ bool Character::IsValidAttackTarget(Player* opponent, Character* target) const
         return false;
     }
 
-    if (const auto hero = dynamic_cast<Hero*>(target); hero)
+    if (const auto hero = EntityCast<Hero>(target); hero)
     {
         if (CantAttackHeroes())
         {
             return false;
         }
 
-        if (const auto minion = dynamic_cast<const Minion*>(this);
+        if (const auto minion = EntityCast<const Minion>(this);
             minion && minion->IsAttackableByRush())
         {
             return false;
@@ -209,13 +216,14 @@ bool Character::IsValidAttackTarget(Player* opponent, Character* target) const
     return true;
 }
 
-std::vector<Character*> Character::GetValidAttackTargets(Player* opponent) const
+FixedVector<Character*, MAX_FIELD_SIZE + 1> Character::GetValidAttackTargets(
+    Player* opponent) const
 {
     bool isExistTauntInField = false;
-    std::vector<Character*> targets;
-    std::vector<Character*> targetsHaveTaunt;
+    FixedVector<Character*, MAX_FIELD_SIZE + 1> targets;
+    FixedVector<Character*, MAX_FIELD_SIZE + 1> targetsHaveTaunt;
 
-    for (auto& minion : opponent->GetFieldZone()->GetAll())
+    for (auto& minion : opponent->GetFieldZone()->GetView())
     {
         if (!minion->HasStealth())
         {
@@ -255,8 +263,8 @@ int Character::TakeDamage(Playable* source, int damage)
             "Character::TakeDamage() - source is nullptr");
     }
 
-    const auto hero = dynamic_cast<Hero*>(this);
-    const auto minion = dynamic_cast<Minion*>(this);
+    const auto hero = EntityCast<Hero>(this);
+    const auto minion = EntityCast<Minion>(this);
 
     const bool isFatigue = (hero != nullptr) && (this == source);
     if (isFatigue)
@@ -339,7 +347,7 @@ void Character::TakeHeal(Playable* source, int heal)
 {
     if (const auto value = source->player->playerAuraEffects.GetValue(
             GameTag::SPELL_HEALING_DOUBLE);
-        (dynamic_cast<Spell*>(source) || dynamic_cast<HeroPower*>(source)) &&
+        (EntityCast<Spell>(source) || EntityCast<HeroPower>(source)) &&
         value > 0)
     {
         heal *= static_cast<int>(std::pow(2.0, value));
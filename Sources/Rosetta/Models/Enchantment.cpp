@@ -4,6 +4,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Models/Enchantment.hpp>
 #include <Rosetta/Models/Player.hpp>
@@ -17,7 +18,22 @@ Enchantment::Enchantment(Player* player, Card* card,
                          std::map<GameTag, int> tags, Entity* target, int id)
     : Playable(player, card, std::move(tags), id), m_target(target)
 {
-    // Do nothing
+    m_kind = EntityKind::ENCHANTMENT;
+}
+
+Enchantment::Enchantment(Player* player, const Enchantment& rhs,
+                         Entity* target)
+    : Playable(player, rhs),
+      m_target(target),
+      m_isOneTurnActive(rhs.m_isOneTurnActive)
+{
+    m_kind = EntityKind::ENCHANTMENT;
+}
+
+Playable* Enchantment::Clone(const CloneContext& context) const
+{
+    return new Enchantment(context.Get<Player>(player), *this,
+                           context.Get<Entity>(m_target));
 }
 
 std::shared_ptr<Enchantment> Enchantment::GetInstance(Player* player,
@@ -32,8 +48,9 @@ std::shared_ptr<Enchantment> Enchantment::GetInstance(Player* player,
     tags[GameTag::CONTROLLER] = player->playerID;
     tags[GameTag::ZONE] = static_cast<int>(ZoneType::SETASIDE);
 
-    auto instance =
-        std::make_shared<Enchantment>(player, card, tags, target, id);
+    auto instance = std::allocate_shared<Enchantment>(
+        ArenaAllocator<Enchantment>(player->game->arena.get()), player, card,
+        tags, target, id);
 
     target->appliedEnchantments.emplace_back(instance);
 
@@ -47,7 +64,7 @@ std::shared_ptr<Enchantment> Enchantment::GetInstance(Player* player,
 
     if (!card->power.GetDeathrattleTask().empty())
     {
-        dynamic_cast<Playable*>(target)->SetGameTag(GameTag::DEATHRATTLE, 1);
+        EntityCast<Playable>(target)->SetGameTag(GameTag::DEATHRATTLE, 1);
     }
 
     if (num1 > 0)
@@ -17,24 +17,41 @@
 namespace RosettaStone
 {
 Entity::Entity(Game* _game, Card* _card, std::map<GameTag, int> _tags, int _id)
-    : game(_game), card(_card), m_gameTags(std::move(_tags))
+    : game(_game), card(_card)
 {
-    for (auto& gameTag : _card->gameTags)
+    // The tags of the card take precedence over the preset tags. The rare
+    // tags of the card aren't copied and are read from the card directly.
+    m_gameTags.SetDefaults(_card->gameTags);
+
+    for (auto& gameTag : _tags)
     {
-        Entity::SetGameTag(gameTag.first, gameTag.second);
+        if (_card->gameTags.find(gameTag.first) == _card->gameTags.end())
+        {
+            m_gameTags.Set(gameTag.first, gameTag.second);
+        }
     }
 
     id = _id < 0 ? static_cast<int>(game->GetNextID()) : _id;
+
+    MarkChanged();
+}
+
+Entity::Entity(Game* _game, const Entity& rhs)
+    : game(_game),
+      card(rhs.card),
+      id(rhs.id),
+      m_gameTags(rhs.m_gameTags),
+      m_version(rhs.m_version)
+{
+    // Do nothing
 }
 
 Entity::~Entity()
 {
     delete auraEffects;
-
-    m_gameTags.clear();
 }
 
-std::map<GameTag, int> Entity::GetGameTags() const
+const GameTagStore& Entity::GetGameTags() const
 {
     return m_gameTags;
 }
@@ -43,39 +60,44 @@ int Entity::GetGameTag(GameTag tag) const
 {
     int value = 0;
 
-    const auto entityVal = m_gameTags.find(tag);
-    if (entityVal == m_gameTags.end())
+    if (const int* entityVal = m_gameTags.Find(tag); entityVal != nullptr)
     {
-        if (card != nullptr)
-        {
-            const auto cardVal = card->gameTags.find(tag);
-            if (cardVal != card->gameTags.end())
-            {
-                value = cardVal->second;
-            }
-        }
-
-        if (auraEffects != nullptr)
-        {
-            value += auraEffects->GetGameTag(tag);
-        }
+        value = *entityVal;
     }
-    else
+    else if (card != nullptr)
     {
-        value += entityVal->second;
-
-        if (auraEffects != nullptr)
+        const auto cardVal = card->gameTags.find(tag);
+        if (cardVal != card->gameTags.end())
         {
-            value += auraEffects->GetGameTag(tag);
+            value = cardVal->second;
         }
     }
 
+    if (auraEffects != nullptr)
+    {
+        value += auraEffects->GetGameTag(tag);
+    }
+
     return value > 0 ? value : 0;
 }
 
 void Entity::SetGameTag(GameTag tag, int value)
 {
-    m_gameTags.insert_or_assign(tag, value);
+    m_gameTags.Set(tag, value);
+    MarkChanged();
+}
+
+void Entity::MarkChanged()
+{
+    if (game != nullptr)
+    {
+        m_version = game->IncreaseStateVersion();
+    }
+}
+
+std::size_t Entity::GetVersion() const
+{
+    return m_version;
 }
 
 int Entity::GetCardTarget() const
@@ -90,18 +112,20 @@ void Entity::SetCardTarget(int value)
 
 void Entity::Reset()
 {
-    m_gameTags.erase(GameTag::DAMAGE);
-    m_gameTags.erase(GameTag::EXHAUSTED);
-    m_gameTags.erase(GameTag::ATK);
-    m_gameTags.erase(GameTag::HEALTH);
-    m_gameTags.erase(GameTag::COST);
-    m_gameTags.erase(GameTag::TAUNT);
-    m_gameTags.erase(GameTag::FROZEN);
-    m_gameTags.erase(GameTag::CHARGE);
-    m_gameTags.erase(GameTag::WINDFURY);
-    m_gameTags.erase(GameTag::DIVINE_SHIELD);
-    m_gameTags.erase(GameTag::STEALTH);
-    m_gameTags.erase(GameTag::NUM_ATTACKS_THIS_TURN);
+    m_gameTags.Erase(GameTag::DAMAGE);
+    m_gameTags.Erase(GameTag::EXHAUSTED);
+    m_gameTags.Erase(GameTag::ATK);
+    m_gameTags.Erase(GameTag::HEALTH);
+    m_gameTags.Erase(GameTag::COST);
+    m_gameTags.Erase(GameTag::TAUNT);
+    m_gameTags.Erase(GameTag::FROZEN);
+    m_gameTags.Erase(GameTag::CHARGE);
+    m_gameTags.Erase(GameTag::WINDFURY);
+    m_gameTags.Erase(GameTag::DIVINE_SHIELD);
+    m_gameTags.Erase(GameTag::STEALTH);
+    m_gameTags.Erase(GameTag::NUM_ATTACKS_THIS_TURN);
+
+    MarkChanged();
 }
 
 Playable* Entity::GetFromCard(Player* player, Card* card,
@@ -111,7 +135,7 @@ Playable* Entity::GetFromCard(Player* player, Card* card,
     std::map<GameTag, int> tags;
     if (cardTags.has_value())
     {
-        tags = cardTags.value();
+        tags = std::move(cardTags.value());
     }
 
     tags[GameTag::CONTROLLER] = player->playerID;
@@ -119,24 +143,25 @@ Playable* Entity::GetFromCard(Player* player, Card* card,
         zone != nullptr ? static_cast<int>(zone->GetType()) : 0;
 
     Playable* result;
+    Arena::Scope arenaScope(player->game->arena.get());
 
     switch (card->GetCardType())
     {
         case CardType::HERO:
-            result = new Hero(player, card, tags, id);
+            result = new Hero(player, card, std::move(tags), id);
             break;
         case CardType::HERO_POWER:
             tags[GameTag::ZONE] = static_cast<int>(ZoneType::PLAY);
-            result = new HeroPower(player, card, tags, id);
+            result = new HeroPower(player, card, std::move(tags), id);
             break;
         case CardType::MINION:
-            result = new Minion(player, card, tags, id);
+            result = new Minion(player, card, std::move(tags), id);
             break;
         case CardType::SPELL:
-            result = new Spell(player, card, tags, id);
+            result = new Spell(player, card, std::move(tags), id);
             break;
         case CardType::WEAPON:
-            result = new Weapon(player, card, tags, id);
+            result = new Weapon(player, card, std::move(tags), id);
             break;
         default:
             throw std::invalid_argument(
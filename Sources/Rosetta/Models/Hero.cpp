@@ -4,6 +4,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Models/Hero.hpp>
 #include <Rosetta/Models/Player.hpp>
@@ -16,7 +17,19 @@ namespace RosettaStone
 Hero::Hero(Player* player, Card* card, std::map<GameTag, int> tags, int id)
     : Character(player, card, std::move(tags), id)
 {
-    // Do nothing
+    m_kind = EntityKind::HERO;
+}
+
+Hero::Hero(Player* player, const Hero& rhs) : Character(player, rhs)
+{
+    m_kind = EntityKind::HERO;
+
+    fatigue = rhs.fatigue;
+}
+
+Playable* Hero::Clone(const CloneContext& context) const
+{
+    return new Hero(context.Get<Player>(player), *this);
 }
 
 Hero::~Hero()
@@ -4,8 +4,10 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Models/Character.hpp>
 #include <Rosetta/Models/HeroPower.hpp>
+#include <Rosetta/Models/Player.hpp>
 
 #include <utility>
 
@@ -15,7 +17,18 @@ HeroPower::HeroPower(Player* player, Card* card, std::map<GameTag, int> tags,
                      int id)
     : Playable(player, card, std::move(tags), id)
 {
-    // Do nothing
+    m_kind = EntityKind::HERO_POWER;
+}
+
+HeroPower::HeroPower(Player* player, const HeroPower& rhs)
+    : Playable(player, rhs)
+{
+    m_kind = EntityKind::HERO_POWER;
+}
+
+Playable* HeroPower::Clone(const CloneContext& context) const
+{
+    return new HeroPower(context.Get<Player>(player), *this);
 }
 
 bool HeroPower::TargetingRequirements(Character* target) const
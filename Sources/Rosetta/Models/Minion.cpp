@@ -6,19 +6,45 @@
 
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/Utils.hpp>
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Models/Enchantment.hpp>
 #include <Rosetta/Models/Minion.hpp>
 #include <Rosetta/Models/Player.hpp>
 
+#include <algorithm>
 #include <utility>
 
 namespace RosettaStone
 {
+namespace
+{
+//! Returns the first dead minion whose order of play is not less than
+//! \p order.
+auto FindDeadMinion(std::vector<std::pair<std::size_t, Minion*>>& deadMinions,
+                    std::size_t order)
+{
+    return std::lower_bound(deadMinions.begin(), deadMinions.end(), order,
+                            [](const auto& lhs, std::size_t rhs) {
+                                return lhs.first < rhs;
+                            });
+}
+}  // namespace
+
 Minion::Minion(Player* player, Card* card, std::map<GameTag, int> tags, int id)
     : Character(player, card, std::move(tags), id)
 {
-    // Do nothing
+    m_kind = EntityKind::MINION;
+}
+
+Minion::Minion(Player* player, const Minion& rhs) : Character(player, rhs)
+{
+    m_kind = EntityKind::MINION;
+}
+
+Playable* Minion::Clone(const CloneContext& context) const
+{
+    return new Minion(context.Get<Player>(player), *this);
 }
 
 int Minion::GetLastBoardPos() const
@@ -151,8 +177,9 @@ void Minion::Reset()
 
     if (isDestroyed)
     {
-        auto iter = game->deadMinions.find(orderOfPlay);
-        if (iter != game->deadMinions.end())
+        const auto order = static_cast<std::size_t>(orderOfPlay);
+        const auto iter = FindDeadMinion(game->deadMinions, order);
+        if (iter != game->deadMinions.end() && iter->first == order)
         {
             game->deadMinions.erase(iter);
         }
@@ -165,6 +192,11 @@ void Minion::Destroy()
 {
     Playable::Destroy();
 
-    game->deadMinions.emplace(orderOfPlay, this);
+    const auto order = static_cast<std::size_t>(orderOfPlay);
+    const auto iter = FindDeadMinion(game->deadMinions, order);
+    if (iter == game->deadMinions.end() || iter->first != order)
+    {
+        game->deadMinions.emplace(iter, order, this);
+    }
 }
 }  // namespace RosettaStone
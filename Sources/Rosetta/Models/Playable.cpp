@@ -23,6 +23,21 @@ Playable::Playable(Player* _player, Card* _card, std::map<GameTag, int> _tags,
     player = _player;
 }
 
+Playable::Playable(Player* _player, const Playable& rhs)
+    : Entity(_player->game, rhs)
+{
+    player = _player;
+    orderOfPlay = rhs.orderOfPlay;
+    isDestroyed = rhs.isDestroyed;
+
+    if (rhs.costManager != nullptr)
+    {
+        // The adaptive cost effect is linked again when it is cloned.
+        costManager = new CostManager(*rhs.costManager);
+        costManager->DeactivateAdaptiveEffect();
+    }
+}
+
 Playable::~Playable()
 {
     delete ongoingEffect;
@@ -162,7 +177,7 @@ bool Playable::IsPlayableByPlayer()
     }
 
     // Check if entity is in hand to be played
-    if (dynamic_cast<HeroPower*>(this) == nullptr &&
+    if (EntityCast<HeroPower>(this) == nullptr &&
         GetZoneType() != ZoneType::HAND)
     {
         return false;
@@ -204,7 +219,7 @@ bool Playable::IsPlayableByCardReq() const
                 auto& entourages = card->entourages;
                 std::size_t entourageCount = 0;
 
-                for (auto& minion : curField->GetAll())
+                for (auto& minion : curField->GetView())
                 {
                     for (auto& entourage : entourages)
                     {
@@ -291,27 +306,27 @@ bool Playable::IsValidPlayTarget(Character* target)
             }
             break;
         case TargetingType::ALL_MINIONS:
-            if (dynamic_cast<Hero*>(target) != nullptr)
+            if (EntityCast<Hero>(target) != nullptr)
             {
                 return false;
             }
             break;
         case TargetingType::FRIENDLY_MINIONS:
-            if (dynamic_cast<Hero*>(target) != nullptr ||
+            if (EntityCast<Hero>(target) != nullptr ||
                 target->player != player)
             {
                 return false;
             }
             break;
         case TargetingType::ENEMY_MINIONS:
-            if (dynamic_cast<Hero*>(target) != nullptr ||
+            if (EntityCast<Hero>(target) != nullptr ||
                 target->player == player)
             {
                 return false;
             }
             break;
         case TargetingType::HEROES:
-            if (dynamic_cast<Minion*>(target) != nullptr)
+            if (EntityCast<Minion>(target) != nullptr)
             {
                 return false;
             }
@@ -367,7 +382,7 @@ bool Playable::HasAnyValidPlayTargets() const
 
     if (friendlyMinions)
     {
-        for (auto& minion : player->GetFieldZone()->GetAll())
+        for (auto& minion : player->GetFieldZone()->GetView())
         {
             if (TargetingRequirements(minion))
             {
@@ -378,7 +393,7 @@ bool Playable::HasAnyValidPlayTargets() const
 
     if (enemyMinions)
     {
-        for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+        for (auto& minion : player->opponent->GetFieldZone()->GetView())
         {
             if (TargetingRequirements(minion))
             {
@@ -430,6 +445,8 @@ void Playable::ActivateTask(PowerType type, Character* target, int chooseOne,
         return;
     }
 
+    Arena::Scope arenaScope(game->arena.get());
+
     for (auto& task : tasks)
     {
         std::unique_ptr<ITask> clonedTask = task->Clone();
@@ -6,6 +6,7 @@
 
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/Utils.hpp>
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Models/HeroPower.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
@@ -19,6 +20,8 @@ namespace RosettaStone
 {
 Player::Player() : playerID(USER_INVALID)
 {
+    m_kind = EntityKind::PLAYER;
+
     m_deckZone = std::make_unique<DeckZone>(this);
     m_fieldZone = std::make_unique<FieldZone>(this);
     m_graveyardZone = std::make_unique<GraveyardZone>(this);
@@ -68,6 +71,37 @@ void Player::RefCopy(const Player& rhs)
     currentSpellPower = rhs.currentSpellPower;
 }
 
+void Player::CloneFrom(const Player& rhs, const CloneContext& context)
+{
+    id = rhs.id;
+    nickname = rhs.nickname;
+    playerType = rhs.playerType;
+    playerID = rhs.playerID;
+
+    playState = rhs.playState;
+    mulliganState = rhs.mulliganState;
+    choice = rhs.choice;
+
+    galakrond = context.Get<Playable>(rhs.galakrond);
+    m_hero = context.Get<Hero>(rhs.m_hero);
+
+    m_deckZone->CloneFrom(*rhs.m_deckZone, context);
+    m_fieldZone->CloneFrom(*rhs.m_fieldZone, context);
+    m_graveyardZone->CloneFrom(*rhs.m_graveyardZone, context);
+    m_handZone->CloneFrom(*rhs.m_handZone, context);
+    m_secretZone->CloneFrom(*rhs.m_secretZone, context);
+    m_setasideZone->CloneFrom(*rhs.m_setasideZone, context);
+
+    for (const auto tag : { GameTag::TIMEOUT, GameTag::SPELLPOWER_DOUBLE,
+                            GameTag::HEALING_DOES_DAMAGE })
+    {
+        playerAuraEffects.SetValue(tag, rhs.playerAuraEffects.GetValue(tag));
+    }
+
+    m_gameTags = rhs.m_gameTags;
+    currentSpellPower = rhs.currentSpellPower;
+}
+
 FieldZone* Player::GetFieldZone() const
 {
     return m_fieldZone.get();
@@ -131,6 +165,7 @@ int Player::GetGameTag(GameTag tag) const
 void Player::SetGameTag(GameTag tag, int value)
 {
     m_gameTags.insert_or_assign(tag, value);
+    MarkChanged();
 }
 
 int Player::GetTimeOut()
@@ -302,10 +337,10 @@ void Player::AddHeroAndPower(Card* heroCard, Card* powerCard)
         auraEffects = m_hero->auraEffects;
     }
 
-    m_hero = dynamic_cast<Hero*>(GetFromCard(this, heroCard));
+    m_hero = EntityCast<Hero>(GetFromCard(this, heroCard));
     m_hero->SetZoneType(ZoneType::PLAY);
 
-    m_hero->heroPower = dynamic_cast<HeroPower*>(GetFromCard(this, powerCard));
+    m_hero->heroPower = EntityCast<HeroPower>(GetFromCard(this, powerCard));
 
     m_hero->weapon = weapon;
     m_hero->auraEffects = auraEffects;
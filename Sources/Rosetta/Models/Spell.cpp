@@ -4,6 +4,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Models/Spell.hpp>
 #include <Rosetta/Zones/SecretZone.hpp>
@@ -15,7 +16,17 @@ namespace RosettaStone
 Spell::Spell(Player* player, Card* card, std::map<GameTag, int> tags, int id)
     : Playable(player, card, std::move(tags), id)
 {
-    // Do nothing
+    m_kind = EntityKind::SPELL;
+}
+
+Spell::Spell(Player* player, const Spell& rhs) : Playable(player, rhs)
+{
+    m_kind = EntityKind::SPELL;
+}
+
+Playable* Spell::Clone(const CloneContext& context) const
+{
+    return new Spell(context.Get<Player>(player), *this);
 }
 
 int Spell::GetQuestProgress() const
@@ -4,6 +4,7 @@
 // personal capacity and are not conveying any rights to any intellectual
 // property of any third parties.
 
+#include <Rosetta/Games/CloneContext.hpp>
 #include <Rosetta/Models/Player.hpp>
 #include <Rosetta/Models/Weapon.hpp>
 
@@ -14,7 +15,17 @@ namespace RosettaStone
 Weapon::Weapon(Player* player, Card* card, std::map<GameTag, int> tags, int id)
     : Playable(player, card, std::move(tags), id)
 {
-    // Do nothing
+    m_kind = EntityKind::WEAPON;
+}
+
+Weapon::Weapon(Player* player, const Weapon& rhs) : Playable(player, rhs)
+{
+    m_kind = EntityKind::WEAPON;
+}
+
+Playable* Weapon::Clone(const CloneContext& context) const
+{
+    return new Weapon(context.Get<Player>(player), *this);
 }
 
 Weapon::~Weapon()
@@ -0,0 +1,74 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Tasks/EventMetaData.hpp>
+
+#include <new>
+
+namespace RosettaStone
+{
+namespace
+{
+//!
+//! \brief FreeList struct.
+//!
+//! This struct is a list of memory blocks of EventMetaData that are deleted.
+//! Each block stores the pointer to the next block in place.
+//!
+struct FreeList
+{
+    ~FreeList()
+    {
+        while (head != nullptr)
+        {
+            void* next = *static_cast<void**>(head);
+            ::operator delete(head);
+            head = next;
+        }
+
+        isDestroyed = true;
+    }
+
+    void* head = nullptr;
+
+    // NOTE: Trivially destructible, so it can be read after the destructor
+    static thread_local bool isDestroyed;
+};
+
+thread_local bool FreeList::isDestroyed = false;
+thread_local FreeList freeList;
+}  // namespace
+
+void* EventMetaData::operator new(std::size_t size)
+{
+    if (size == sizeof(EventMetaData) && !FreeList::isDestroyed &&
+        freeList.head != nullptr)
+    {
+        void* ptr = freeList.head;
+        freeList.head = *static_cast<void**>(ptr);
+        return ptr;
+    }
+
+    return ::operator new(size);
+}
+
+void EventMetaData::operator delete(void* ptr, std::size_t size) noexcept
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    if (size != sizeof(EventMetaData) || FreeList::isDestroyed)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    *static_cast<void**>(ptr) = freeList.head;
+    freeList.head = ptr;
+}
+}  // namespace RosettaStone
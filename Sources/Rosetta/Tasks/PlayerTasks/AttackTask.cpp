@@ -15,8 +15,8 @@ AttackTask::AttackTask(Entity* source, Playable* target) : ITask(source, target)
 
 TaskStatus AttackTask::Impl(Player* player)
 {
-    Generic::Attack(player, dynamic_cast<Character*>(m_source),
-                    dynamic_cast<Character*>(m_target));
+    Generic::Attack(player, EntityCast<Character>(m_source),
+                    EntityCast<Character>(m_target));
 
     return TaskStatus::COMPLETE;
 }
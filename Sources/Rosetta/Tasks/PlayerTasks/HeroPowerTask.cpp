@@ -19,7 +19,7 @@ TaskStatus HeroPowerTask::Impl(Player* player)
     HeroPower& power = player->GetHeroPower();
 
     if (!power.IsPlayableByPlayer() || !power.IsPlayableByCardReq() ||
-        !power.IsValidPlayTarget(dynamic_cast<Character*>(m_target)))
+        !power.IsValidPlayTarget(EntityCast<Character>(m_target)))
     {
         return TaskStatus::STOP;
     }
@@ -50,7 +50,7 @@ TaskStatus HeroPowerTask::Impl(Player* player)
 
     // Process power tasks
     player->game->taskQueue.StartEvent();
-    power.ActivateTask(PowerType::POWER, dynamic_cast<Character*>(m_target));
+    power.ActivateTask(PowerType::POWER, EntityCast<Character>(m_target));
     player->game->ProcessTasks();
     player->game->taskQueue.EndEvent();
 
@@ -49,8 +49,8 @@ PlayCardTask PlayCardTask::WeaponTarget(Entity* source, Playable* target)
 
 TaskStatus PlayCardTask::Impl(Player* player)
 {
-    const auto source = dynamic_cast<Playable*>(m_source);
-    const auto target = dynamic_cast<Character*>(m_target);
+    const auto source = EntityCast<Playable>(m_source);
+    const auto target = EntityCast<Character>(m_target);
 
     Generic::PlayCard(player, source, target, m_fieldPos, m_chooseOne);
 
@@ -34,7 +34,7 @@ TaskStatus AddEnchantmentTask::Impl(Player* player)
         num2 = m_source->game->taskStack.num[1];
     }
 
-    const auto source = dynamic_cast<Playable*>(m_source);
+    const auto source = EntityCast<Playable>(m_source);
 
     if (m_entityType == EntityType::PLAYER)
     {
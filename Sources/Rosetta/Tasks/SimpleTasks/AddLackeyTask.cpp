@@ -9,10 +9,6 @@
 #include <Rosetta/Tasks/SimpleTasks/AddLackeyTask.hpp>
 #include <Rosetta/Zones/HandZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 AddLackeyTask::AddLackeyTask(int amount) : m_amount(amount)
@@ -28,8 +24,10 @@ TaskStatus AddLackeyTask::Impl(Player* player)
 
     for (int i = 0; i < m_amount && !player->GetHandZone()->IsFull(); ++i)
     {
+        const auto idx =
+            player->game->GetRandom().Get<std::size_t>(0, lackeys.size() - 1);
         const auto lackey = Entity::GetFromCard(
-            player, *Random::get(lackeys), std::nullopt, player->GetHandZone());
+            player, lackeys[idx], std::nullopt, player->GetHandZone());
         Generic::AddCardToHand(player, lackey);
     }
 
@@ -6,10 +6,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/ChanceTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 ChanceTask::ChanceTask(bool useFlag) : m_useFlag(useFlag)
@@ -19,7 +15,7 @@ ChanceTask::ChanceTask(bool useFlag) : m_useFlag(useFlag)
 
 TaskStatus ChanceTask::Impl(Player* player)
 {
-    const auto num = Random::get<int>(0, 1);
+    const auto num = player->game->GetRandom().Get(0, 1);
 
     if (!m_useFlag)
     {
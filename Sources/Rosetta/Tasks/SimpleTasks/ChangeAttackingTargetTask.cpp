@@ -26,8 +26,8 @@ TaskStatus ChangeAttackingTargetTask::Impl(Player* player)
         return TaskStatus::STOP;
     }
 
-    const auto attacker = dynamic_cast<Character*>(typeA[0]);
-    const auto newDefender = dynamic_cast<Character*>(typeB[0]);
+    const auto attacker = EntityCast<Character>(typeA[0]);
+    const auto newDefender = EntityCast<Character>(typeB[0]);
 
     if (attacker == nullptr || newDefender == nullptr)
     {
@@ -18,7 +18,7 @@ TaskStatus ChangeHeroPowerTask::Impl(Player* player)
 {
     delete player->GetHero()->heroPower;
     player->GetHero()->heroPower =
-        dynamic_cast<HeroPower*>(Entity::GetFromCard(player, m_card));
+        EntityCast<HeroPower>(Entity::GetFromCard(player, m_card));
 
     return TaskStatus::COMPLETE;
 }
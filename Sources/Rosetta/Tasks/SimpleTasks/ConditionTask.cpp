@@ -59,7 +59,7 @@ TaskStatus ConditionTask::Impl(Player* player)
         for (auto& condition : m_relaConditions)
         {
             flag = flag && condition->Evaluate(
-                               dynamic_cast<Playable*>(m_source), playable);
+                               EntityCast<Playable>(m_source), playable);
         }
     }
 
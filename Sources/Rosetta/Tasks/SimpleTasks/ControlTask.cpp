@@ -37,7 +37,7 @@ TaskStatus ControlTask::Impl(Player* player)
         }
 
         const auto removedMinion =
-            dynamic_cast<Minion*>(playable->zone->Remove(playable));
+            EntityCast<Minion>(playable->zone->Remove(playable));
         removedMinion->game->UpdateAura();
         removedMinion->player = m_opposite ? player->opponent : player;
 
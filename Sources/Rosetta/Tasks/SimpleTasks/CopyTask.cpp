@@ -71,9 +71,9 @@ TaskStatus CopyTask::Impl(Player* player)
         {
             case EntityType::SOURCE:
             {
-                toBeCopied = dynamic_cast<Playable*>(m_source);
+                toBeCopied = EntityCast<Playable>(m_source);
 
-                auto enchantment = dynamic_cast<Enchantment*>(m_target);
+                auto enchantment = EntityCast<Enchantment>(m_target);
                 deathrattle =
                     (m_zoneType == ZoneType::PLAY) &&
                     (enchantment != nullptr) &&
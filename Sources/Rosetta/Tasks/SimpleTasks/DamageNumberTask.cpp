@@ -24,8 +24,8 @@ TaskStatus DamageNumberTask::Impl(Player* player)
 
     for (auto& playable : playables)
     {
-        const auto character = dynamic_cast<Character*>(playable);
-        Generic::TakeDamageToCharacter(dynamic_cast<Playable*>(m_source),
+        const auto character = EntityCast<Character>(playable);
+        Generic::TakeDamageToCharacter(EntityCast<Playable>(m_source),
                                        character, damage, m_isSpellDamage);
     }
 
@@ -4,14 +4,11 @@
 // Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
 
 #include <Rosetta/Actions/Generic.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/DamageTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/DestroyTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/IncludeTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 DamageTask::DamageTask(EntityType entityType, std::size_t damage,
@@ -38,13 +35,14 @@ TaskStatus DamageTask::Impl(Player* player)
 
     for (auto& playable : playables)
     {
-        const auto source = dynamic_cast<Playable*>(m_source);
-        const auto character = dynamic_cast<Character*>(playable);
+        const auto source = EntityCast<Playable>(m_source);
+        const auto character = EntityCast<Character>(playable);
 
         std::size_t randomDamage = 0;
         if (m_randomDamage > 0)
         {
-            randomDamage = Random::get<std::size_t>(0, m_randomDamage);
+            randomDamage = player->game->GetRandom().Get<std::size_t>(
+                0, m_randomDamage);
         }
 
         const std::size_t damage = m_damage + randomDamage;
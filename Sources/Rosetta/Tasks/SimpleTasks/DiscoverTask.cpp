@@ -8,10 +8,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/DiscoverTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 DiscoverCriteria::DiscoverCriteria(CardType _cardType, CardClass _cardClass)
@@ -32,7 +28,8 @@ DiscoverTask::DiscoverTask(CardType cardType, CardClass cardClass,
     // Do nothing
 }
 
-std::vector<Card*> DiscoverTask::GetChoices(std::vector<Card*> cardsToDiscover,
+std::vector<Card*> DiscoverTask::GetChoices(RandomGenerator& random,
+                                            std::vector<Card*> cardsToDiscover,
                                             std::size_t numberOfChoices)
 {
     std::vector<Card*> result;
@@ -43,10 +40,15 @@ std::vector<Card*> DiscoverTask::GetChoices(std::vector<Card*> cardsToDiscover,
     }
     else
     {
-        result.reserve(numberOfChoices);
-        std::sample(cardsToDiscover.begin(), cardsToDiscover.end(),
-                    std::back_inserter(result), numberOfChoices,
-                    Random::get_engine());
+        // Partial Fisher-Yates; the first cards are the chosen ones
+        for (std::size_t i = 0; i < numberOfChoices; ++i)
+        {
+            const auto idx = random.Get(i, cardsToDiscover.size() - 1);
+            std::swap(cardsToDiscover[i], cardsToDiscover[idx]);
+        }
+
+        result.assign(cardsToDiscover.begin(),
+                      cardsToDiscover.begin() + numberOfChoices);
     }
 
     return result;
@@ -66,7 +68,8 @@ TaskStatus DiscoverTask::Impl(Player* player)
             Discover(player->game->GetFormatType(), m_discoverCriteria);
     }
 
-    const auto result = GetChoices(cardsToDiscover, m_numberOfChoices);
+    const auto result = GetChoices(player->game->GetRandom(), cardsToDiscover,
+                                   m_numberOfChoices);
 
     Generic::CreateChoiceCards(player, m_source, ChoiceType::GENERAL,
                                m_choiceAction, result);
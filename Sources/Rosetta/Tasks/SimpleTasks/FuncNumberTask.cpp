@@ -19,7 +19,7 @@ TaskStatus FuncNumberTask::Impl(Player*)
 {
     if (m_func != nullptr)
     {
-        m_func(dynamic_cast<Playable*>(m_source));
+        m_func(EntityCast<Playable>(m_source));
     }
 
     return TaskStatus::COMPLETE;
@@ -20,8 +20,8 @@ TaskStatus HealFullTask::Impl(Player* player)
 
     for (auto& playable : playables)
     {
-        auto character = dynamic_cast<Character*>(playable);
-        character->TakeFullHeal(dynamic_cast<Playable*>(m_source));
+        auto character = EntityCast<Character>(playable);
+        character->TakeFullHeal(EntityCast<Playable>(m_source));
     }
 
     return TaskStatus::COMPLETE;
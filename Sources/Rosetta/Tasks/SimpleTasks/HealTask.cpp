@@ -21,8 +21,8 @@ TaskStatus HealTask::Impl(Player* player)
 
     for (auto& playable : playables)
     {
-        auto character = dynamic_cast<Character*>(playable);
-        character->TakeHeal(dynamic_cast<Playable*>(m_source), m_amount);
+        auto character = EntityCast<Character>(playable);
+        character->TakeHeal(EntityCast<Playable>(m_source), m_amount);
     }
 
     return TaskStatus::COMPLETE;
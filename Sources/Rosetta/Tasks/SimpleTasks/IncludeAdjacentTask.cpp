@@ -28,10 +28,10 @@ TaskStatus IncludeAdjacentTask::Impl(Player* player)
     switch (m_entityType)
     {
         case EntityType::SOURCE:
-            center = dynamic_cast<Minion*>(m_source);
+            center = EntityCast<Minion>(m_source);
             break;
         case EntityType::TARGET:
-            center = dynamic_cast<Minion*>(m_target);
+            center = EntityCast<Minion>(m_target);
             break;
         default:
             throw std::invalid_argument(
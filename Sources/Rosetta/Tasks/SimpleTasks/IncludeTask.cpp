@@ -35,29 +35,29 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
         case EntityType::SOURCE:
             if (source != nullptr)
             {
-                entities.emplace_back(dynamic_cast<Playable*>(source));
+                entities.emplace_back(EntityCast<Playable>(source));
             }
             break;
         case EntityType::TARGET:
             if (target != nullptr)
             {
-                entities.emplace_back(dynamic_cast<Playable*>(target));
+                entities.emplace_back(EntityCast<Playable>(target));
             }
             break;
         case EntityType::ALL:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player->GetHero());
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player->opponent->GetHero());
             break;
         case EntityType::ALL_NOSOURCE:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -66,7 +66,7 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player->GetHero());
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -77,14 +77,14 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             entities.emplace_back(player->opponent->GetHero());
             break;
         case EntityType::FRIENDS:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player->GetHero());
             break;
         case EntityType::ENEMIES:
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
@@ -93,14 +93,14 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
         case EntityType::ENEMIES_NOTARGET:
             if (target == player->opponent->GetHero())
             {
-                for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+                for (auto& minion : player->opponent->GetFieldZone()->GetView())
                 {
                     entities.emplace_back(minion);
                 }
             }
             else
             {
-                for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+                for (auto& minion : player->opponent->GetFieldZone()->GetView())
                 {
                     if (target == minion)
                     {
@@ -136,41 +136,41 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::HAND:
-            for (auto& card : player->GetHandZone()->GetAll())
+            for (auto& card : player->GetHandZone()->GetView())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::ENEMY_HAND:
-            for (auto& card : player->opponent->GetHandZone()->GetAll())
+            for (auto& card : player->opponent->GetHandZone()->GetView())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::DECK:
-            for (auto& card : player->GetDeckZone()->GetAll())
+            for (auto& card : player->GetDeckZone()->GetView())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::ENEMY_DECK:
-            for (auto& card : player->opponent->GetDeckZone()->GetAll())
+            for (auto& card : player->opponent->GetDeckZone()->GetView())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::ALL_MINIONS:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             break;
         case EntityType::ALL_MINIONS_NOSOURCE:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -179,7 +179,7 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
 
                 entities.emplace_back(minion);
             }
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -190,13 +190,13 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::MINIONS:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             break;
         case EntityType::MINIONS_NOSOURCE:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -207,13 +207,13 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::ENEMY_MINIONS:
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             break;
         case EntityType::ENEMY_SECRETS:
-            for (auto& secret : player->opponent->GetSecretZone()->GetAll())
+            for (auto& secret : player->opponent->GetSecretZone()->GetView())
             {
                 entities.emplace_back(secret);
             }
@@ -247,29 +247,29 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
         case EntityType::SOURCE:
             if (source != nullptr)
             {
-                entities.emplace_back(dynamic_cast<Playable*>(source));
+                entities.emplace_back(EntityCast<Playable>(source));
             }
             break;
         case EntityType::TARGET:
             if (target != nullptr)
             {
-                entities.emplace_back(dynamic_cast<Playable*>(target));
+                entities.emplace_back(EntityCast<Playable>(target));
             }
             break;
         case EntityType::ALL:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player->GetHero());
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player->opponent->GetHero());
             break;
         case EntityType::ALL_NOSOURCE:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -278,7 +278,7 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player->GetHero());
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -289,14 +289,14 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             entities.emplace_back(player->opponent->GetHero());
             break;
         case EntityType::FRIENDS:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             entities.emplace_back(player->GetHero());
             break;
         case EntityType::ENEMIES:
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
@@ -305,14 +305,14 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
         case EntityType::ENEMIES_NOTARGET:
             if (target == player->opponent->GetHero())
             {
-                for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+                for (auto& minion : player->opponent->GetFieldZone()->GetView())
                 {
                     entities.emplace_back(minion);
                 }
             }
             else
             {
-                for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+                for (auto& minion : player->opponent->GetFieldZone()->GetView())
                 {
                     if (target == minion)
                     {
@@ -348,41 +348,41 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::HAND:
-            for (auto& card : player->GetHandZone()->GetAll())
+            for (auto& card : player->GetHandZone()->GetView())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::ENEMY_HAND:
-            for (auto& card : player->opponent->GetHandZone()->GetAll())
+            for (auto& card : player->opponent->GetHandZone()->GetView())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::DECK:
-            for (auto& card : player->GetDeckZone()->GetAll())
+            for (auto& card : player->GetDeckZone()->GetView())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::ENEMY_DECK:
-            for (auto& card : player->opponent->GetDeckZone()->GetAll())
+            for (auto& card : player->opponent->GetDeckZone()->GetView())
             {
                 entities.emplace_back(card);
             }
             break;
         case EntityType::ALL_MINIONS:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             break;
         case EntityType::ALL_MINIONS_NOSOURCE:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -391,7 +391,7 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
 
                 entities.emplace_back(minion);
             }
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -402,13 +402,13 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::MINIONS:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             break;
         case EntityType::MINIONS_NOSOURCE:
-            for (auto& minion : player->GetFieldZone()->GetAll())
+            for (auto& minion : player->GetFieldZone()->GetView())
             {
                 if (source == minion)
                 {
@@ -419,13 +419,13 @@ std::vector<Playable*> IncludeTask::GetEntities(EntityType entityType,
             }
             break;
         case EntityType::ENEMY_MINIONS:
-            for (auto& minion : player->opponent->GetFieldZone()->GetAll())
+            for (auto& minion : player->opponent->GetFieldZone()->GetView())
             {
                 entities.emplace_back(minion);
             }
             break;
         case EntityType::ENEMY_SECRETS:
-            for (auto& secret : player->opponent->GetSecretZone()->GetAll())
+            for (auto& secret : player->opponent->GetSecretZone()->GetView())
             {
                 entities.emplace_back(secret);
             }
@@ -37,7 +37,7 @@ QuestProgressTask::QuestProgressTask(
 
 TaskStatus QuestProgressTask::Impl(Player* player)
 {
-    auto spell = dynamic_cast<Spell*>(m_source);
+    auto spell = EntityCast<Spell>(m_source);
     if (spell == nullptr)
     {
         return TaskStatus::STOP;
@@ -52,7 +52,7 @@ TaskStatus QuestProgressTask::Impl(Player* player)
             Playable* reward = Entity::GetFromCard(player, m_card);
 
             // Reward card is hero power or minion
-            if (const auto heroPower = dynamic_cast<HeroPower*>(reward);
+            if (const auto heroPower = EntityCast<HeroPower>(reward);
                 heroPower)
             {
                 delete player->GetHero()->heroPower;
@@ -7,10 +7,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomCardTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomCardTask::RandomCardTask(EntityType entityType, bool opposite)
@@ -82,7 +78,8 @@ TaskStatus RandomCardTask::Impl(Player* player)
     }
 
     player->game->taskStack.playables.clear();
-    const auto idx = Random::get<std::size_t>(0, cardsList.size() - 1);
+    const auto idx =
+        player->game->GetRandom().Get<std::size_t>(0, cardsList.size() - 1);
     auto card = Entity::GetFromCard(m_opposite ? player->opponent : player,
                                     cardsList.at(idx));
     player->game->taskStack.playables.emplace_back(card);
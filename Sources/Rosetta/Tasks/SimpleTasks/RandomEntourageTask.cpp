@@ -7,10 +7,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomEntourageTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomEntourageTask::RandomEntourageTask(int count, bool isOpponent)
@@ -33,8 +29,8 @@ TaskStatus RandomEntourageTask::Impl(Player* player)
 
     for (int i = 0; i < m_count; ++i)
     {
-        const auto idx =
-            Random::get<std::size_t>(0, m_source->card->entourages.size() - 1);
+        const auto idx = player->game->GetRandom().Get<std::size_t>(
+            0, m_source->card->entourages.size() - 1);
         const auto entourageCard =
             Cards::FindCardByID(m_source->card->entourages[idx]);
 
@@ -7,10 +7,6 @@
 #include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomMinionTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomMinionTask::RandomMinionTask(GameTag tag, int value, int amount,
@@ -45,6 +41,8 @@ TaskStatus RandomMinionTask::Impl(Player* player)
         return TaskStatus::STOP;
     }
 
+    RandomGenerator& random = player->game->GetRandom();
+
     std::vector<Playable*> randomMinions;
     randomMinions.reserve(m_amount);
 
@@ -55,7 +53,7 @@ TaskStatus RandomMinionTask::Impl(Player* player)
         while (randomMinions.size() < static_cast<std::size_t>(m_amount) &&
                !cardsList.empty())
         {
-            const auto idx = Random::get<std::size_t>(0, list.size() - 1);
+            const auto idx = random.Get<std::size_t>(0, list.size() - 1);
             auto card = Entity::GetFromCard(
                 m_opposite ? player->opponent : player, list.at(idx));
 
@@ -66,7 +64,7 @@ TaskStatus RandomMinionTask::Impl(Player* player)
     }
     else
     {
-        const auto idx = Random::get<std::size_t>(0, cardsList.size() - 1);
+        const auto idx = random.Get<std::size_t>(0, cardsList.size() - 1);
         auto card = Entity::GetFromCard(m_opposite ? player->opponent : player,
                                         cardsList.at(idx));
         randomMinions.emplace_back(card);
@@ -7,10 +7,6 @@
 #include <Rosetta/Tasks/SimpleTasks/IncludeTask.hpp>
 #include <Rosetta/Tasks/SimpleTasks/RandomTask.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::SimpleTasks
 {
 RandomTask::RandomTask(EntityType entityType, int amount)
@@ -37,14 +33,16 @@ TaskStatus RandomTask::Impl(Player* player)
         return TaskStatus::COMPLETE;
     }
 
+    RandomGenerator& random = player->game->GetRandom();
+
     if (m_amount == 1)
     {
-        const auto idx = Random::get<std::size_t>(0, playables.size() - 1);
+        const auto idx = random.Get<std::size_t>(0, playables.size() - 1);
         stackPlayables = std::vector<Playable*>{ playables.at(idx) };
     }
     else
     {
-        stackPlayables = ChooseNElements(playables, m_amount);
+        stackPlayables = ChooseNElements(random, playables, m_amount);
     }
 
     return TaskStatus::COMPLETE;
@@ -11,7 +11,7 @@ namespace RosettaStone::SimpleTasks
 {
 TaskStatus RemoveEnchantmentTask::Impl([[maybe_unused]] Player* player)
 {
-    auto enchantment = dynamic_cast<Enchantment*>(m_source);
+    auto enchantment = EntityCast<Enchantment>(m_source);
     if (enchantment == nullptr)
     {
         return TaskStatus::STOP;
@@ -40,7 +40,7 @@ ReplaceHeroTask::ReplaceHeroTask(Card* heroCard, Card* heroPowerCard,
 
 TaskStatus ReplaceHeroTask::Impl(Player* player)
 {
-    auto playable = dynamic_cast<Playable*>(m_source);
+    auto playable = EntityCast<Playable>(m_source);
     if (playable == nullptr || player == nullptr)
     {
         return TaskStatus::STOP;
@@ -52,7 +52,7 @@ TaskStatus ReplaceHeroTask::Impl(Player* player)
     if (m_weaponCard != nullptr)
     {
         const auto weapon =
-            dynamic_cast<Weapon*>(Entity::GetFromCard(player, m_weaponCard));
+            EntityCast<Weapon>(Entity::GetFromCard(player, m_weaponCard));
         player->GetHero()->AddWeapon(*weapon);
     }
 
@@ -21,7 +21,7 @@ TaskStatus RevealStealthTask::Impl(Player* player)
 
     for (auto& playable : playables)
     {
-        if (auto minion = dynamic_cast<Minion*>(playable); minion)
+        if (auto minion = EntityCast<Minion>(playable); minion)
         {
             minion->SetGameTag(GameTag::STEALTH, 0);
         }
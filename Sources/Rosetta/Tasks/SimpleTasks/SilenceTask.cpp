@@ -21,7 +21,7 @@ TaskStatus SilenceTask::Impl(Player* player)
 
     for (auto& playable : playables)
     {
-        auto minion = dynamic_cast<Minion*>(playable);
+        auto minion = EntityCast<Minion>(playable);
         if (!minion)
         {
             continue;
@@ -67,7 +67,7 @@ TaskStatus SummonCopyTask::Impl(Player* player)
                 break;
             }
 
-            const auto minion = dynamic_cast<Minion*>(
+            const auto minion = EntityCast<Minion>(
                 Entity::GetFromCard(player, playables[i]->card));
 
             Generic::Summon(minion,
@@ -89,7 +89,7 @@ TaskStatus SummonCopyTask::Impl(Player* player)
                 break;
             }
 
-            auto minion = dynamic_cast<Minion*>(playables[i]);
+            auto minion = EntityCast<Minion>(playables[i]);
 
             if (minion->player != player)
             {
@@ -99,9 +99,9 @@ TaskStatus SummonCopyTask::Impl(Player* player)
             const int zonePos =
                 SummonTask::GetPosition(m_source, m_side, m_target);
 
-            const auto copy = dynamic_cast<Minion*>(
-                Entity::GetFromCard(player, minion->card, minion->GetGameTags(),
-                                    player->GetFieldZone()));
+            const auto copy = EntityCast<Minion>(Entity::GetFromCard(
+                player, minion->card, minion->GetGameTags().ToMap(),
+                player->GetFieldZone()));
             Generic::Summon(copy, zonePos, m_source);
             minion->CopyInternalAttributes(copy);
 
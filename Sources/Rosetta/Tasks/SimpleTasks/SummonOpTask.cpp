@@ -43,11 +43,11 @@ TaskStatus SummonOpTask::Impl(Player* player)
 
         if (!m_card.has_value())
         {
-            summonEntity = dynamic_cast<Minion*>(stack.playables[0]);
+            summonEntity = EntityCast<Minion>(stack.playables[0]);
         }
         else
         {
-            summonEntity = dynamic_cast<Minion*>(
+            summonEntity = EntityCast<Minion>(
                 Entity::GetFromCard(player->opponent, m_card.value()));
         }
 
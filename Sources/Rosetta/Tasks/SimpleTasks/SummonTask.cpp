@@ -54,12 +54,12 @@ int SummonTask::GetPosition(Entity* source, SummonSide side, Entity* target)
         {
             if (source->zone->GetType() == ZoneType::PLAY)
             {
-                const auto src = dynamic_cast<Playable*>(source);
+                const auto src = EntityCast<Playable>(source);
                 summonPos = src->GetZonePosition();
             }
             else
             {
-                const auto src = dynamic_cast<Minion*>(source);
+                const auto src = EntityCast<Minion>(source);
                 summonPos = src->GetLastBoardPos();
             }
             break;
@@ -68,28 +68,27 @@ int SummonTask::GetPosition(Entity* source, SummonSide side, Entity* target)
         {
             if (source->zone->GetType() == ZoneType::PLAY)
             {
-                const auto src = dynamic_cast<Playable*>(source);
+                const auto src = EntityCast<Playable>(source);
                 summonPos = src->GetZonePosition() + 1;
             }
             else
             {
-                const auto src = dynamic_cast<Minion*>(source);
+                const auto src = EntityCast<Minion>(source);
                 summonPos = src->GetLastBoardPos();
             }
             break;
         }
         case SummonSide::DEATHRATTLE:
         {
-            if (const auto minion = dynamic_cast<Minion*>(source); minion)
+            if (const auto minion = EntityCast<Minion>(source); minion)
             {
                 summonPos = minion->GetLastBoardPos();
             }
-            else if (const auto enchantment =
-                         dynamic_cast<Enchantment*>(source);
+            else if (const auto enchantment = EntityCast<Enchantment>(source);
                      enchantment)
             {
                 const auto enchantmentTarget =
-                    dynamic_cast<Minion*>(enchantment->GetTarget());
+                    EntityCast<Minion>(enchantment->GetTarget());
                 summonPos = enchantmentTarget->GetLastBoardPos();
             }
             else
@@ -111,7 +110,7 @@ int SummonTask::GetPosition(Entity* source, SummonSide side, Entity* target)
         }
         case SummonSide::TARGET:
         {
-            const auto tgt = dynamic_cast<Playable*>(target);
+            const auto tgt = EntityCast<Playable>(target);
             if (tgt != nullptr)
             {
                 summonPos = tgt->GetZonePosition() + 1;
@@ -161,7 +160,7 @@ TaskStatus SummonTask::Impl(Player* player)
         Minion* summonEntity = nullptr;
         if (m_card.has_value())
         {
-            summonEntity = dynamic_cast<Minion*>(
+            summonEntity = EntityCast<Minion>(
                 Entity::GetFromCard(player, m_card.value()));
 
             if (m_addToStack)
@@ -171,7 +170,7 @@ TaskStatus SummonTask::Impl(Player* player)
         }
         else if (!stack.playables.empty())
         {
-            summonEntity = dynamic_cast<Minion*>(stack.playables[0]);
+            summonEntity = EntityCast<Minion>(stack.playables[0]);
 
             if (m_removeFromStack)
             {
@@ -25,7 +25,7 @@ TaskStatus SwapAttackHealthTask::Impl(Player* player)
 
     for (auto& playable : playables)
     {
-        const auto minion = dynamic_cast<Minion*>(playable);
+        const auto minion = EntityCast<Minion>(playable);
         const int attack = minion->GetAttack();
         const int health = minion->GetHealth();
 
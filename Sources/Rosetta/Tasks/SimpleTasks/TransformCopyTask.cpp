@@ -12,13 +12,13 @@ namespace RosettaStone::SimpleTasks
 {
 TaskStatus TransformCopyTask::Impl(Player* player)
 {
-    const auto target = dynamic_cast<Minion*>(m_target);
+    const auto target = EntityCast<Minion>(m_target);
     if (target == nullptr)
     {
         return TaskStatus::STOP;
     }
 
-    const auto source = dynamic_cast<Minion*>(m_source);
+    const auto source = EntityCast<Minion>(m_source);
     if (source->GetZoneType() != ZoneType::PLAY)
     {
         return TaskStatus::STOP;
@@ -27,8 +27,7 @@ TaskStatus TransformCopyTask::Impl(Player* player)
     auto copy = Entity::GetFromCard(player, m_target->card, {});
     IAura* aura = target->ongoingEffect;
 
-    source->player->GetFieldZone()->Replace(source,
-                                            dynamic_cast<Minion*>(copy));
+    source->player->GetFieldZone()->Replace(source, EntityCast<Minion>(copy));
 
     if (!target->appliedEnchantments.empty())
     {
@@ -51,18 +50,17 @@ TaskStatus TransformCopyTask::Impl(Player* player)
         }
     }
 
-    for (auto& tag : target->GetGameTags())
-    {
-        switch (tag.first)
+    target->GetGameTags().ForEach([&](GameTag tag, int value) {
+        switch (tag)
         {
             case GameTag::ZONE:
             case GameTag::ZONE_POSITION:
             case GameTag::EXHAUSTED:
                 break;
             default:
-                copy->SetGameTag(tag.first, tag.second);
+                copy->SetGameTag(tag, value);
         }
-    }
+    });
 
     if (aura != nullptr && copy->ongoingEffect == nullptr)
     {
@@ -27,7 +27,7 @@ TaskStatus TransformTask::Impl(Player* player)
     {
         Card* card = Cards::FindCardByID(m_cardID);
 
-        auto* minion = dynamic_cast<Minion*>(playable);
+        auto* minion = EntityCast<Minion>(playable);
         if (minion == nullptr)
         {
             return TaskStatus::STOP;
@@ -28,7 +28,7 @@ TaskStatus WeaponTask::Impl(Player* player)
     }
 
     const auto weapon =
-        dynamic_cast<Weapon*>(Entity::GetFromCard(player, weaponCard));
+        EntityCast<Weapon>(Entity::GetFromCard(player, weaponCard));
     Generic::PlayWeapon(player, weapon, nullptr);
 
     return TaskStatus::COMPLETE;
@@ -12,7 +12,12 @@ std::queue<std::unique_ptr<ITask>>& TaskQueue::GetCurrentQueue()
     return m_eventStack.empty() ? m_baseQueue : m_eventStack.top();
 }
 
-bool TaskQueue::IsEmpty()
+const std::queue<std::unique_ptr<ITask>>& TaskQueue::GetCurrentQueue() const
+{
+    return m_eventStack.empty() ? m_baseQueue : m_eventStack.top();
+}
+
+bool TaskQueue::IsEmpty() const
 {
     return m_eventFlag || GetCurrentQueue().empty();
 }
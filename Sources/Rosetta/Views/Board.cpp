@@ -8,6 +8,7 @@
 // References: https://github.com/peter1591/hearthstone-ai
 
 #include <Rosetta/Views/Board.hpp>
+#include <Rosetta/Views/ZobristHash.hpp>
 
 namespace RosettaStone
 {
@@ -46,6 +47,11 @@ ReducedBoardView Board::CreateView() const
     }
 }
 
+std::uint64_t Board::GetHash() const
+{
+    return ZobristHash::Compute(m_game, m_playerType);
+}
+
 CurrentPlayerBoardRefView Board::GetCurPlayerStateRefView() const
 {
     if (m_game.GetCurrentPlayer()->playerType != m_playerType)
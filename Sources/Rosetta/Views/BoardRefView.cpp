@@ -8,6 +8,7 @@
 // References: https://github.com/peter1591/hearthstone-ai
 
 #include <Rosetta/Views/BoardRefView.hpp>
+#include <Rosetta/Views/ZobristHash.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
 
 namespace RosettaStone
@@ -33,6 +34,11 @@ PlayerType BoardRefView::GetCurrentPlayer() const
     return m_game.GetCurrentPlayer()->playerType;
 }
 
+std::uint64_t BoardRefView::GetHash() const
+{
+    return ZobristHash::Compute(m_game, m_playerType);
+}
+
 int BoardRefView::GetFatigueDamage(PlayerType playerType) const
 {
     if (playerType == PlayerType::PLAYER1)
@@ -168,31 +174,24 @@ std::vector<Playable*> BoardRefView::GetHandCards() const
 {
     if (m_playerType == PlayerType::PLAYER1)
     {
-        return m_game.GetPlayer1()->GetHandZone()->GetAll();
+        return m_game.GetPlayer1()->GetHandZone()->GetAll().ToVector();
     }
     else
     {
-        return m_game.GetPlayer2()->GetHandZone()->GetAll();
+        return m_game.GetPlayer2()->GetHandZone()->GetAll().ToVector();
     }
 }
 
 std::vector<std::pair<Playable*, bool>> BoardRefView::GetOpponentHandCards()
     const
 {
-    std::vector<Playable*> playables;
-
-    if (m_playerType == PlayerType::PLAYER1)
-    {
-        playables = m_game.GetPlayer2()->GetHandZone()->GetAll();
-    }
-    else
-    {
-        playables = m_game.GetPlayer1()->GetHandZone()->GetAll();
-    }
+    const HandZone* handZone = (m_playerType == PlayerType::PLAYER1)
+                                   ? m_game.GetPlayer2()->GetHandZone()
+                                   : m_game.GetPlayer1()->GetHandZone();
 
     std::vector<std::pair<Playable*, bool>> result;
 
-    for (auto& playable : playables)
+    for (auto& playable : handZone->GetView())
     {
         if (playable->card->id == "GAME_005")
         {
@@ -224,11 +223,11 @@ std::vector<Minion*> BoardRefView::GetMinions(PlayerType playerType) const
 {
     if (playerType == PlayerType::PLAYER1)
     {
-        return m_game.GetPlayer1()->GetFieldZone()->GetAll();
+        return m_game.GetPlayer1()->GetFieldZone()->GetAll().ToVector();
     }
     else
     {
-        return m_game.GetPlayer2()->GetFieldZone()->GetAll();
+        return m_game.GetPlayer2()->GetFieldZone()->GetAll().ToVector();
     }
 }
 
@@ -0,0 +1,137 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Actions/ActionValidGetter.hpp>
+#include <Rosetta/Views/FeatureEncoder.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+
+#include <cmath>
+
+namespace RosettaStone
+{
+namespace
+{
+//! Normalizes the value from uniform distribution to mean = 0, var = 1.
+float NormalizeFromUniformDist(double v, double min, double max)
+{
+    // Uniform dist is with variance = (max-min)^2 / 12
+    static const double sqrt12 = std::sqrt(12.0);
+
+    const double mean = (min + max) / 2;
+    const double scale = sqrt12 / (max - min);
+
+    return static_cast<float>((v - mean) * scale);
+}
+
+//! Normalizes the boolean value.
+float NormalizeBool(bool v)
+{
+    return NormalizeFromUniformDist(v ? 1.0 : -1.0, -1.0, 1.0);
+}
+
+//! Returns the normalized health plus armor of the hero of \p player.
+float GetHeroFeature(const Player* player)
+{
+    const Hero* hero = player->GetHero();
+    return NormalizeFromUniformDist(hero->GetHealth() + hero->GetArmor(), 0.0,
+                                    30.0);
+}
+}  // namespace
+
+void FeatureEncoder::Encode(const Game& game, float* data)
+{
+    const Player* curPlayer = game.GetCurrentPlayer();
+    const Player* opPlayer = game.GetOpponentPlayer();
+
+    data[HERO_OFFSET] = GetHeroFeature(curPlayer);
+    data[HERO_OFFSET + 1] = GetHeroFeature(opPlayer);
+
+    EncodeMinions(curPlayer, data + MINION_OFFSET);
+    EncodeMinions(opPlayer, data + MINION_OFFSET + MINION_SIZE / 2);
+
+    EncodeStandalone(game, data + STANDALONE_OFFSET);
+}
+
+void FeatureEncoder::Encode(const std::vector<const Game*>& games, float* data)
+{
+    for (const auto& game : games)
+    {
+        Encode(*game, data);
+        data += NUM_FEATURES;
+    }
+}
+
+void FeatureEncoder::EncodeMinions(const Player* player, float* data)
+{
+    FieldZone& fieldZone = *player->GetFieldZone();
+    const auto count = static_cast<std::size_t>(fieldZone.GetCount());
+
+    for (std::size_t i = 0; i < NUM_MAX_MINIONS; ++i)
+    {
+        if (i < count)
+        {
+            const Minion* minion = fieldZone[static_cast<int>(i)];
+
+            data[0] = NormalizeFromUniformDist(minion->GetHealth(), 1.0, 7.0);
+            data[1] =
+                NormalizeFromUniformDist(minion->GetMaxHealth(), 1.0, 7.0);
+            data[2] = NormalizeFromUniformDist(minion->GetAttack(), 0.0, 7.0);
+            data[3] = NormalizeBool(minion->CanAttack());
+            data[4] = NormalizeBool(minion->GetGameTag(GameTag::TAUNT) > 0);
+            data[5] =
+                NormalizeBool(minion->GetGameTag(GameTag::DIVINE_SHIELD) > 0);
+            data[6] = NormalizeBool(minion->GetGameTag(GameTag::STEALTH) > 0);
+        }
+        else
+        {
+            data[0] = 0.0f;
+            data[1] = 0.0f;
+            data[2] = 0.0f;
+            data[3] = NormalizeBool(false);
+            data[4] = NormalizeBool(false);
+            data[5] = NormalizeBool(false);
+            data[6] = NormalizeBool(false);
+        }
+
+        data += NUM_MINION_FEATURES;
+    }
+}
+
+void FeatureEncoder::EncodeStandalone(const Game& game, float* data)
+{
+    const Player* curPlayer = game.GetCurrentPlayer();
+    HandZone& handZone = *curPlayer->GetHandZone();
+    const int handCount = handZone.GetCount();
+
+    ActionValidGetter getter(game);
+
+    int numPlayables = 0;
+    getter.ForEachPlayableCard([&](Playable*) {
+        ++numPlayables;
+        return true;
+    });
+
+    data[0] = NormalizeFromUniformDist(curPlayer->GetRemainingMana(), 0, 10);
+    data[1] = NormalizeFromUniformDist(curPlayer->GetTotalMana(), 0, 10);
+    data[2] = NormalizeFromUniformDist(curPlayer->GetOverloadLocked(), 0, 10);
+    data[3] = NormalizeFromUniformDist(handCount, 0, 10);
+    data[4] = NormalizeFromUniformDist(numPlayables, 0, 10);
+    data += 5;
+
+    for (int i = 0; i < static_cast<int>(NUM_MAX_HAND_CARDS); ++i)
+    {
+        // Empty slots are encoded as a card of cost -1
+        const int cost = i < handCount ? handZone[i]->GetCost() : -1;
+        data[i] = NormalizeFromUniformDist(cost, 0, 10);
+    }
+    data += NUM_MAX_HAND_CARDS;
+
+    data[0] = NormalizeFromUniformDist(
+        game.GetOpponentPlayer()->GetHandZone()->GetCount(), 0, 10);
+    data[1] = NormalizeBool(getter.CanUseHeroPower());
+}
+}  // namespace RosettaStone
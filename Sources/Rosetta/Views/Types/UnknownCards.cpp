@@ -9,10 +9,6 @@
 
 #include <Rosetta/Views/Types/UnknownCards.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone::Views::Types
 {
 UnknownCardsSet::UnknownCardsSet(std::vector<std::string> cards)
@@ -84,7 +80,7 @@ void UnknownCardsSetsManager::Setup(UnknownCardsSets& data)
     m_data = &data;
 }
 
-void UnknownCardsSetsManager::Prepare()
+void UnknownCardsSetsManager::Prepare(RandomGenerator& random)
 {
     m_data->ResetState();
     m_shuffledCards.clear();
@@ -97,7 +93,8 @@ void UnknownCardsSetsManager::Prepare()
         m_shuffledCards.emplace_back();
         for (std::size_t i = 0; i < refCards; ++i)
         {
-            const int randIdx = Random::get<int>(0, cardsPool.size() - 1);
+            const auto randIdx =
+                random.Get<std::size_t>(0, cardsPool.size() - 1);
             std::swap(cardsPool[randIdx], cardsPool.back());
             m_shuffledCards.back().push_back(cardsPool.back());
             cardsPool.pop_back();
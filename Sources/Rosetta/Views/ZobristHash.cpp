@@ -0,0 +1,177 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Rosetta/Views/ZobristHash.hpp>
+#include <Rosetta/Zones/DeckZone.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+
+#include <string_view>
+
+namespace RosettaStone
+{
+namespace
+{
+constexpr std::uint64_t SEED = 0x9E3779B97F4A7C15ULL;
+
+//! The number of slots of a side. It is larger than the size of the field
+//! zone and the hand zone.
+constexpr std::uint32_t NUM_SIDE_SLOTS = 16;
+
+//! Mixes the bits of \p value with the finalizer of SplitMix64.
+constexpr std::uint64_t Mix(std::uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+//! Hashes \p text with FNV-1a. Unlike std::hash, the value is the same on
+//! every platform, so the hashes can be saved.
+constexpr std::uint64_t HashText(std::string_view text)
+{
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char ch : text)
+    {
+        hash ^= static_cast<unsigned char>(ch);
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+std::uint64_t ToValue(int value)
+{
+    return static_cast<std::uint32_t>(value);
+}
+
+void AddKey(std::uint64_t& hash, ZobristHash::Field field, std::uint32_t slot,
+            std::uint64_t value)
+{
+    hash ^= ZobristHash::GetKey(field, slot, value);
+}
+}  // namespace
+
+std::uint64_t ZobristHash::Compute(const Game& game, PlayerType playerType)
+{
+    const Player* player = (playerType == PlayerType::PLAYER1)
+                               ? game.GetPlayer1()
+                               : game.GetPlayer2();
+    const Player* opponent = (playerType == PlayerType::PLAYER1)
+                                 ? game.GetPlayer2()
+                                 : game.GetPlayer1();
+
+    std::uint64_t hash = 0;
+    AddKey(hash, Field::TURN, 0, ToValue(game.GetTurn()));
+    AddKey(hash, Field::SIDE, 0, static_cast<std::uint64_t>(playerType));
+
+    AddPlayer(player, 0, hash);
+    AddPlayer(opponent, 1, hash);
+
+    // Only the player who sees the game knows whether a hero can attack
+    const Hero* hero = player->GetHero();
+    const bool isHeroAttackable =
+        game.GetCurrentPlayer() == player && hero->CanAttack();
+    AddKey(hash, Field::HERO_ATTACKABLE, 0, isHeroAttackable);
+
+    int idx = 0;
+    for (Minion* minion : player->GetFieldZone()->GetView())
+    {
+        AddKey(hash, Field::MINION_ATTACKABLE, idx++, minion->CanAttack());
+    }
+
+    // Only the player who sees the game knows the cards in hand
+    idx = 0;
+    for (Playable* playable : player->GetHandZone()->GetView())
+    {
+        AddKey(hash, Field::HAND_CARD, idx, GetCardValue(playable->card));
+        AddKey(hash, Field::HAND_COST, idx, ToValue(playable->GetCost()));
+        AddKey(hash, Field::HAND_ATTACK, idx,
+               ToValue(playable->GetGameTag(GameTag::ATK)));
+        AddKey(hash, Field::HAND_HEALTH, idx,
+               ToValue(playable->GetGameTag(GameTag::HEALTH)));
+        ++idx;
+    }
+
+    return hash;
+}
+
+std::uint64_t ZobristHash::GetKey(Field field, std::uint32_t slot,
+                                  std::uint64_t value)
+{
+    const std::uint64_t fieldKey =
+        Mix(SEED + ((static_cast<std::uint64_t>(field) << 16) | slot));
+    return Mix(fieldKey ^ value);
+}
+
+std::uint64_t ZobristHash::GetCardValue(const Card* card)
+{
+    return HashText(card->id);
+}
+
+void ZobristHash::AddPlayer(const Player* player, std::uint32_t side,
+                            std::uint64_t& hash)
+{
+    const std::uint32_t base = side * NUM_SIDE_SLOTS;
+
+    const Hero* hero = player->GetHero();
+    AddKey(hash, Field::HERO_ATTACK, side, ToValue(hero->GetAttack()));
+    AddKey(hash, Field::HERO_HEALTH, side, ToValue(hero->GetHealth()));
+    AddKey(hash, Field::HERO_ARMOR, side, ToValue(hero->GetArmor()));
+    AddKey(hash, Field::HERO_STEALTH, side,
+           hero->GetGameTag(GameTag::STEALTH) == 1);
+    AddKey(hash, Field::HERO_IMMUNE, side,
+           hero->GetGameTag(GameTag::IMMUNE) == 1);
+
+    const HeroPower& heroPower = player->GetHeroPower();
+    AddKey(hash, Field::HERO_POWER_CARD, side, GetCardValue(heroPower.card));
+    AddKey(hash, Field::HERO_POWER_EXHAUSTED, side, heroPower.IsExhausted());
+
+    if (hero->HasWeapon())
+    {
+        const Weapon* weapon = hero->weapon;
+        AddKey(hash, Field::WEAPON_CARD, side, GetCardValue(weapon->card));
+        AddKey(hash, Field::WEAPON_ATTACK, side, ToValue(weapon->GetAttack()));
+        AddKey(hash, Field::WEAPON_DURABILITY, side,
+               ToValue(weapon->GetDurability()));
+    }
+
+    AddKey(hash, Field::MANA_REMAINING, side,
+           ToValue(player->GetRemainingMana()));
+    AddKey(hash, Field::MANA_TOTAL, side, ToValue(player->GetTotalMana()));
+    AddKey(hash, Field::MANA_OVERLOAD_OWED, side,
+           ToValue(player->GetOverloadOwed()));
+    AddKey(hash, Field::MANA_OVERLOAD_LOCKED, side,
+           ToValue(player->GetOverloadLocked()));
+
+    const FieldZone* fieldZone = player->GetFieldZone();
+    AddKey(hash, Field::MINION_COUNT, side, ToValue(fieldZone->GetCount()));
+
+    std::uint32_t slot = base;
+    for (Minion* minion : fieldZone->GetView())
+    {
+        AddKey(hash, Field::MINION_CARD, slot, GetCardValue(minion->card));
+        AddKey(hash, Field::MINION_ATTACK, slot, ToValue(minion->GetAttack()));
+        AddKey(hash, Field::MINION_HEALTH, slot, ToValue(minion->GetHealth()));
+        AddKey(hash, Field::MINION_SILENCED, slot,
+               minion->GetGameTag(GameTag::SILENCED) == 1);
+        AddKey(hash, Field::MINION_TAUNT, slot,
+               minion->GetGameTag(GameTag::TAUNT) == 1);
+        AddKey(hash, Field::MINION_CANT_ATTACK_HEROES, slot,
+               minion->GetGameTag(GameTag::CANNOT_ATTACK_HEROES) == 1);
+        AddKey(hash, Field::MINION_STEALTH, slot,
+               minion->GetGameTag(GameTag::STEALTH) == 1);
+        AddKey(hash, Field::MINION_IMMUNE, slot,
+               minion->GetGameTag(GameTag::IMMUNE) == 1);
+        ++slot;
+    }
+
+    AddKey(hash, Field::HAND_COUNT, side,
+           ToValue(player->GetHandZone()->GetCount()));
+    AddKey(hash, Field::DECK_COUNT, side,
+           ToValue(player->GetDeckZone()->GetCount()));
+}
+}  // namespace RosettaStone
@@ -5,12 +5,9 @@
 // property of any third parties.
 
 #include <Rosetta/Commons/Constants.hpp>
+#include <Rosetta/Games/Game.hpp>
 #include <Rosetta/Zones/DeckZone.hpp>
 
-#include <effolkronium/random.hpp>
-
-using Random = effolkronium::random_static;
-
 namespace RosettaStone
 {
 DeckZone::DeckZone(Player* player) : LimitedZone(ZoneType::DECK, MAX_DECK_SIZE)
@@ -50,6 +47,6 @@ void DeckZone::Add(Playable* entity, int zonePos)
 
 void DeckZone::Shuffle() const
 {
-    Random::shuffle(m_entities, m_entities + m_count);
+    m_player->game->GetRandom().Shuffle(m_entities, m_entities + m_count);
 }
 }  // namespace RosettaStone
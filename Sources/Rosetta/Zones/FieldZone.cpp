@@ -31,19 +31,9 @@ void FieldZone::RefCopy(FieldZone* rhs) const
     }
 }
 
-std::vector<Minion*> FieldZone::GetAll()
-{
-    return PositioningZone::GetAll();
-}
-
-std::vector<Minion*> FieldZone::GetAll() const
-{
-    return PositioningZone::GetAll();
-}
-
 void FieldZone::Add(Playable* entity, int zonePos)
 {
-    const auto minion = dynamic_cast<Minion*>(entity);
+    const auto minion = EntityCast<Minion>(entity);
 
     PositioningZone::Add(minion, zonePos);
 
@@ -75,7 +65,7 @@ void FieldZone::Add(Playable* entity, int zonePos)
 
 Playable* FieldZone::Remove(Playable* entity)
 {
-    const auto minion = dynamic_cast<Minion*>(entity);
+    const auto minion = EntityCast<Minion>(entity);
 
     RemoveAura(minion);
 
@@ -102,7 +92,7 @@ void FieldZone::Replace(Minion* oldEntity, Minion* newEntity)
 
     // Add new entity
     newEntity->orderOfPlay = newEntity->game->GetNextOOP();
-    m_entities[pos] = dynamic_cast<Minion*>(newEntity);
+    m_entities[pos] = EntityCast<Minion>(newEntity);
     newEntity->SetZonePosition(pos);
     newEntity->SetZoneType(m_type);
     newEntity->zone = this;
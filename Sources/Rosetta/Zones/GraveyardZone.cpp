@@ -12,7 +12,8 @@ namespace RosettaStone
 GraveyardZone::GraveyardZone(Player* player)
     : UnlimitedZone(player, ZoneType::GRAVEYARD)
 {
-    // Do nothing
+    // The minions that die in a turn are added without allocation
+    m_entities.reserve(START_DECK_SIZE);
 }
 
 void GraveyardZone::RefCopy(GraveyardZone* rhs)
@@ -32,7 +32,7 @@ void SecretZone::RefCopy(SecretZone* rhs) const
 
 void SecretZone::Add(Playable* entity, int zonePos)
 {
-    const auto spell = dynamic_cast<Spell*>(entity);
+    const auto spell = EntityCast<Spell>(entity);
 
     if (spell->IsQuest())
     {
@@ -51,7 +51,7 @@ void SecretZone::Add(Playable* entity, int zonePos)
 
 Playable* SecretZone::Remove(Playable* entity)
 {
-    return LimitedZone::Remove(dynamic_cast<Spell*>(entity));
+    return LimitedZone::Remove(EntityCast<Spell>(entity));
 }
 
 bool SecretZone::Exist(Playable* entity) const
@@ -0,0 +1,125 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Loaders/CardImage.hpp>
+#include <Rosetta/Loaders/CardLoader.hpp>
+#include <Rosetta/Loaders/InternalCardLoader.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace RosettaStone;
+
+BENCHMARK_CASE("[Cards] - FindCardByID")
+{
+    const auto& cards = Cards::GetAllCards();
+
+    std::vector<std::string> ids;
+    ids.reserve(cards.size());
+    for (const auto& card : cards)
+    {
+        ids.emplace_back(card->id);
+    }
+
+    std::size_t found = 0;
+
+    // The linear scan that was used before the index is built
+    const double scanTime = Benchmarks::Measure("Linear scan", 1, [&]() {
+        for (const auto& id : ids)
+        {
+            for (const auto& card : cards)
+            {
+                if (card->id == id)
+                {
+                    ++found;
+                    break;
+                }
+            }
+        }
+    });
+
+    const double indexTime =
+        Benchmarks::Measure("Cards::FindCardByID", 100, [&]() {
+            for (const auto& id : ids)
+            {
+                found += Cards::FindCardByID(id)->id.size();
+            }
+        });
+
+    std::vector<CardIndex> indices;
+    indices.reserve(ids.size());
+    for (const auto& id : ids)
+    {
+        indices.emplace_back(Cards::GetCardIndex(id));
+    }
+
+    Benchmarks::Measure("Cards::GetCardByIndex", 100, [&]() {
+        for (const auto& index : indices)
+        {
+            found += Cards::GetCardByIndex(index)->dbfID;
+        }
+    });
+
+    Benchmarks::Measure("Cards::FindCardByDbfID", 100, [&]() {
+        for (const auto& card : cards)
+        {
+            found += Cards::FindCardByDbfID(card->dbfID)->dbfID;
+        }
+    });
+
+    std::cout << "  Cards: " << ids.size()
+              << ", Speedup of ID lookup: " << scanTime / indexTime << "x"
+              << " (checksum " << found << ")\n";
+}
+
+BENCHMARK_CASE("[Cards] - Load")
+{
+    std::vector<Card*> cards;
+
+    const auto release = [&]() {
+        for (Card* card : cards)
+        {
+            delete card;
+        }
+        cards.clear();
+    };
+
+    std::ifstream file(RESOURCES_DIR "cards.json", std::ios::binary);
+    const std::string json((std::istreambuf_iterator<char>(file)),
+                           std::istreambuf_iterator<char>());
+
+    const double jsonTime =
+        Benchmarks::Measure("CardLoader::LoadFromJSON", 3, [&]() {
+            release();
+            CardLoader::LoadFromJSON(json, cards);
+        });
+
+    const std::string imagePath = "CardsBenchmarks.bin";
+    CardImage::Save(imagePath, 0, cards);
+
+    const double imageTime = Benchmarks::Measure("CardImage::Load", 10, [&]() {
+        release();
+        CardImage::Load(imagePath, 0, cards);
+    });
+    std::remove(imagePath.c_str());
+
+    Benchmarks::Measure("CardImage::ComputeChecksum", 10, [&]() {
+        CardImage::ComputeChecksum(json.data(), json.size());
+    });
+
+    Benchmarks::Measure("InternalCardLoader::Load", 10,
+                        [&]() { InternalCardLoader::Load(cards); });
+
+    std::cout << "  Cards: " << cards.size()
+              << ", Speedup of image: " << jsonTime / imageTime << "x\n";
+    release();
+}
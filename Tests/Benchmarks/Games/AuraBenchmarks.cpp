@@ -0,0 +1,59 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+
+using namespace RosettaStone;
+using namespace PlayerTasks;
+
+BENCHMARK_CASE("[Game] - UpdateAura")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::PRIEST;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+
+    // Restless, adaptive and field auras with charge minions
+    for (const auto& name :
+         { "Warsong Commander", "Warsong Commander", "Southsea Deckhand",
+           "Stonetusk Boar", "Bluegill Warrior", "Stormwind Champion",
+           "Wolfrider" })
+    {
+        curPlayer->SetTotalMana(10);
+        curPlayer->SetUsedMana(0);
+
+        const auto card =
+            Generic::DrawCard(curPlayer, Cards::FindCardByName(name));
+        game.Process(curPlayer, PlayCardTask::Minion(card));
+    }
+
+    constexpr std::size_t ITERATIONS = 200000;
+    auto& field = *curPlayer->GetFieldZone();
+
+    Benchmarks::Measure("Unchanged board", ITERATIONS,
+                        [&]() { game.UpdateAura(); });
+
+    int damage = 0;
+    Benchmarks::Measure("One changed minion", ITERATIONS, [&]() {
+        field[3]->SetGameTag(GameTag::DAMAGE, damage);
+        damage ^= 1;
+        game.UpdateAura();
+    });
+}
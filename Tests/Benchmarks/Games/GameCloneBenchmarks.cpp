@@ -0,0 +1,93 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Actions/Draw.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameRestorer.hpp>
+#include <Rosetta/Tasks/PlayerTasks/EndTurnTask.hpp>
+#include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
+#include <Rosetta/Views/BoardRefView.hpp>
+#include <Rosetta/Views/BoardView.hpp>
+#include <Rosetta/Views/Types/UnknownCards.hpp>
+
+#include <iostream>
+
+using namespace RosettaStone;
+using namespace PlayerTasks;
+
+namespace
+{
+const std::string INNKEEPER_EXPERT_WARLOCK =
+    "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+
+void PrepareGame(Game& game)
+{
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    for (const auto& name :
+         { "Stormwind Champion", "Dire Wolf Alpha", "Acolyte of Pain" })
+    {
+        Player* curPlayer = game.GetCurrentPlayer();
+        curPlayer->SetTotalMana(10);
+        curPlayer->SetUsedMana(0);
+
+        const auto card =
+            Generic::DrawCard(curPlayer, Cards::FindCardByName(name));
+        game.Process(curPlayer, PlayCardTask::Minion(card));
+        game.Process(curPlayer, EndTurnTask());
+        game.ProcessUntil(Step::MAIN_START);
+    }
+}
+}  // namespace
+
+BENCHMARK_CASE("[Game] - Clone vs GameRestorer")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::WARLOCK;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doShuffle = false;
+    config.skipMulligan = true;
+    config.autoRun = false;
+
+    const auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+    for (std::size_t i = 0; i < deck.size(); ++i)
+    {
+        config.player1Deck[i] = Cards::FindCardByID(deck[i]);
+        config.player2Deck[i] = Cards::FindCardByID(deck[i]);
+    }
+
+    Game game(config);
+    PrepareGame(game);
+
+    constexpr std::size_t ITERATIONS = 2000;
+
+    const double cloneTime = Benchmarks::Measure("Game::Clone", ITERATIONS,
+                                                 [&]() { game.Clone(); });
+
+    const double restoreTime =
+        Benchmarks::Measure("GameRestorer", ITERATIONS, [&]() {
+            BoardView boardView;
+            Views::Types::UnknownCardsInfo p1Unknown;
+            Views::Types::UnknownCardsInfo p2Unknown;
+            p1Unknown.deckCards = deck;
+            p2Unknown.deckCards = deck;
+
+            boardView.Parse(
+                BoardRefView(game, game.GetCurrentPlayer()->playerType),
+                p1Unknown, p2Unknown);
+            auto restorer =
+                GameRestorer::Prepare(boardView, p1Unknown, p2Unknown);
+            restorer.RestoreGame();
+        });
+
+    std::cout << "  Speedup: " << restoreTime / cloneTime << "x\n";
+}
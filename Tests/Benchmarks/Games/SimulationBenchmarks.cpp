@@ -0,0 +1,199 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Commons/AllocationCounter.hpp>
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Actions/ActionParams.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Views/Board.hpp>
+
+#include <iostream>
+#include <random>
+
+using namespace RosettaStone;
+
+namespace
+{
+const std::string INNKEEPER_EXPERT_WARLOCK =
+    "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+
+class RandomActionParams : public ActionParams
+{
+ public:
+    explicit RandomActionParams(std::mt19937& random) : m_random(random)
+    {
+        // Do nothing
+    }
+
+    void Init(const Board& board)
+    {
+        Initialize(board.GetCurPlayerStateRefView().GetActionValidGetter());
+    }
+
+    std::size_t GetNumber(ActionType actionType, ActionChoices& choices) final
+    {
+        if (actionType != ActionType::MAIN_ACTION && choices.Size() == 1)
+        {
+            return choices.Get(0);
+        }
+
+        std::uniform_int_distribution<std::size_t> dist(0, choices.Size() - 1);
+        return dist(m_random);
+    }
+
+ private:
+    std::mt19937& m_random;
+};
+
+GameConfig MakeConfig(CardClass cardClass,
+                      const std::vector<std::string>& deck)
+{
+    GameConfig config;
+    config.player1Class = cardClass;
+    config.player2Class = cardClass;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doShuffle = false;
+    config.doFillDecks = false;
+    config.skipMulligan = true;
+    config.autoRun = true;
+
+    for (std::size_t i = 0; i < deck.size(); ++i)
+    {
+        config.player1Deck[i] = Cards::FindCardByID(deck[i]);
+        config.player2Deck[i] = Cards::FindCardByID(deck[i]);
+    }
+
+    return config;
+}
+
+GameConfig MakeConfig()
+{
+    return MakeConfig(
+        CardClass::WARLOCK,
+        DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs());
+}
+
+//! Plays a game with random actions.
+//! \param config The game config.
+//! \param random The random number generator to choose actions.
+//! \param numGameAllocations Incremented by the number of heap allocations
+//! made by the game itself, excluding building of the boards for actions.
+//! \return The number of actions in the game.
+std::size_t PlayRandomGame(const GameConfig& config, std::mt19937& random,
+                           std::size_t* numGameAllocations = nullptr)
+{
+    std::size_t numActions = 0;
+    std::size_t numAllocations = 0;
+
+    std::size_t begin = TestUtils::GetNumAllocations();
+    {
+        Game game(config);
+        game.Start();
+        game.MainReady();
+        numAllocations += TestUtils::GetNumAllocations() - begin;
+
+        while (game.state != State::COMPLETE)
+        {
+            RandomActionParams params(random);
+            Board board(game, game.GetCurrentPlayer()->playerType);
+            params.Init(board);
+
+            begin = TestUtils::GetNumAllocations();
+            board.ApplyAction(params);
+            numAllocations += TestUtils::GetNumAllocations() - begin;
+
+            ++numActions;
+        }
+    }
+
+    if (numGameAllocations != nullptr)
+    {
+        *numGameAllocations += numAllocations;
+    }
+
+    return numActions;
+}
+}  // namespace
+
+BENCHMARK_CASE("[Game] - Random simulation throughput")
+{
+    const GameConfig config = MakeConfig();
+
+    constexpr std::size_t NUM_GAMES = 1000;
+
+    std::mt19937 random(42);
+    std::size_t numActions = 0;
+
+    const double gameTime =
+        Benchmarks::Measure("Random game", NUM_GAMES, [&]() {
+            numActions += PlayRandomGame(config, random);
+        });
+
+    std::cout << "  Throughput: " << 1e9 / gameTime << " games/s, "
+              << static_cast<double>(numActions) / NUM_GAMES
+              << " actions/game\n";
+}
+
+BENCHMARK_CASE("[Game] - Arena allocation stress")
+{
+    GameConfig config = MakeConfig();
+
+    constexpr std::size_t NUM_GAMES = 1000;
+
+    for (const bool useArena : { false, true })
+    {
+        config.useArena = useArena;
+
+        std::mt19937 random(42);
+        std::size_t numAllocations = 0;
+
+        Benchmarks::Measure(useArena ? "With arena" : "Without arena",
+                            NUM_GAMES, [&]() {
+                                PlayRandomGame(config, random,
+                                               &numAllocations);
+                            });
+
+        std::cout << "    "
+                  << static_cast<double>(numAllocations) / NUM_GAMES
+                  << " heap allocations/game\n";
+    }
+}
+
+BENCHMARK_CASE("[Game] - Trigger-heavy simulation")
+{
+    // Knife Juggler, Wild Pyromancer, Mirror Image and Arcane Explosion
+    std::vector<std::string> deck;
+    for (const auto& [cardID, count] :
+         { std::pair<std::string, std::size_t>{ "NEW1_019", 10 },
+           std::pair<std::string, std::size_t>{ "NEW1_020", 10 },
+           std::pair<std::string, std::size_t>{ "CS2_027", 5 },
+           std::pair<std::string, std::size_t>{ "CS2_025", 5 } })
+    {
+        deck.insert(deck.end(), count, cardID);
+    }
+
+    const GameConfig config = MakeConfig(CardClass::MAGE, deck);
+
+    constexpr std::size_t NUM_GAMES = 1000;
+
+    std::mt19937 random(42);
+    std::size_t numActions = 0;
+    std::size_t numAllocations = 0;
+
+    const double gameTime =
+        Benchmarks::Measure("Random game", NUM_GAMES, [&]() {
+            numActions += PlayRandomGame(config, random, &numAllocations);
+        });
+
+    std::cout << "  Throughput: " << 1e9 / gameTime << " games/s, "
+              << static_cast<double>(numActions) / NUM_GAMES
+              << " actions/game, "
+              << static_cast<double>(numAllocations) / NUM_GAMES
+              << " heap allocations/game\n";
+}
@@ -0,0 +1,95 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Games/VectorEnv.hpp>
+
+#include <iostream>
+#include <thread>
+
+using namespace RosettaStone;
+
+namespace
+{
+const std::string INNKEEPER_EXPERT_WARLOCK =
+    "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+
+GameConfig MakeConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::WARLOCK;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = false;
+    config.seed = 42;
+
+    const auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+    for (std::size_t i = 0; i < deck.size(); ++i)
+    {
+        config.player1Deck[i] = Cards::FindCardByID(deck[i]);
+        config.player2Deck[i] = Cards::FindCardByID(deck[i]);
+    }
+
+    return config;
+}
+
+//! Selects a random legal action of each game from the action masks.
+void SelectActions(const VectorEnv& env, RandomGenerator& random,
+                   std::vector<std::int32_t>& actions)
+{
+    for (std::size_t i = 0; i < env.GetNumEnvs(); ++i)
+    {
+        const std::uint8_t* mask =
+            env.GetActionMasks() + i * VectorEnv::NUM_ACTIONS;
+
+        std::size_t numLegal = 0;
+        for (std::size_t j = 0; j < VectorEnv::NUM_ACTIONS; ++j)
+        {
+            numLegal += mask[j];
+        }
+
+        std::size_t choice = random.Get<std::size_t>(0, numLegal - 1);
+        for (std::size_t j = 0; j < VectorEnv::NUM_ACTIONS; ++j)
+        {
+            if (mask[j] != 0 && choice-- == 0)
+            {
+                actions[i] = static_cast<std::int32_t>(j);
+                break;
+            }
+        }
+    }
+}
+}  // namespace
+
+BENCHMARK_CASE("[VectorEnv] - Batched step throughput")
+{
+    constexpr std::size_t NUM_ENVS = 64;
+    constexpr std::size_t NUM_STEPS = 200;
+
+    const GameConfig config = MakeConfig();
+
+    std::cout << "  Hardware threads: " << std::thread::hardware_concurrency()
+              << '\n';
+
+    for (const std::size_t numThreads : { 1, 2, 4 })
+    {
+        VectorEnv env(config, NUM_ENVS, numThreads);
+        RandomGenerator random(42);
+        std::vector<std::int32_t> actions(NUM_ENVS);
+
+        std::cout << "  " << numThreads << " thread(s)\n";
+        const double stepTime = Benchmarks::Measure("Step", NUM_STEPS, [&]() {
+            SelectActions(env, random, actions);
+            env.Step(actions);
+        });
+
+        std::cout << "    Throughput: " << 1e9 * NUM_ENVS / stepTime
+                  << " actions/s\n";
+    }
+}
@@ -0,0 +1,70 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Commons/AllocationCounter.hpp>
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Managers/TriggerEvent.hpp>
+
+#include <iostream>
+#include <vector>
+
+using namespace RosettaStone;
+
+namespace
+{
+struct Listener
+{
+    void Handle(Entity*)
+    {
+        ++count;
+    }
+
+    int count = 0;
+};
+}  // namespace
+
+BENCHMARK_CASE("[TriggerEvent] - Add, notify and remove handlers")
+{
+    constexpr std::size_t NUM_HANDLERS = 16;
+    constexpr std::size_t ITERATIONS = 200000;
+
+    std::vector<Listener> listeners(NUM_HANDLERS);
+    std::vector<TriggerEventHandler> handlers;
+    for (auto& listener : listeners)
+    {
+        handlers.emplace_back(
+            TriggerEventHandler::Create<Listener, &Listener::Handle>(
+                &listener));
+    }
+
+    TriggerEvent event;
+
+    Benchmarks::Measure("Add, notify and remove", ITERATIONS, [&]() {
+        for (auto& handler : handlers)
+        {
+            event += handler;
+        }
+
+        event(nullptr);
+
+        for (auto& handler : handlers)
+        {
+            event -= handler;
+        }
+    });
+
+    for (auto& handler : handlers)
+    {
+        event += handler;
+    }
+
+    const std::size_t numAllocations = TestUtils::GetNumAllocations();
+    Benchmarks::Measure("Notify", ITERATIONS * 10, [&]() { event(nullptr); });
+
+    std::cout << "    " << TestUtils::GetNumAllocations() - numAllocations
+              << " heap allocations while notifying\n";
+}
@@ -0,0 +1,85 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef BENCHMARKS_BENCHMARK_HPP
+#define BENCHMARKS_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace Benchmarks
+{
+//!
+//! \brief Registry struct.
+//!
+//! This struct stores all benchmark cases that are registered by
+//! BENCHMARK_CASE macro. They are run by main() of Benchmarks.
+//!
+struct Registry
+{
+    //! Returns the list of benchmark cases.
+    //! \return The list of pairs of the name and the function of the case.
+    static std::vector<std::pair<std::string, void (*)()>>& Get()
+    {
+        static std::vector<std::pair<std::string, void (*)()>> cases;
+        return cases;
+    }
+
+    //! Registers benchmark case.
+    //! \param name The name of the benchmark case.
+    //! \param func The function of the benchmark case.
+    //! \return Always true to be used for static initialization.
+    static bool Add(std::string name, void (*func)())
+    {
+        Get().emplace_back(std::move(name), func);
+        return true;
+    }
+};
+
+//! Runs \p func \p iterations times and prints the average time.
+//! \param name The name of the measurement to print.
+//! \param iterations The number of iterations.
+//! \param func The function to measure.
+//! \return The average time per iteration in nanoseconds.
+inline double Measure(const std::string& name, std::size_t iterations,
+                      const std::function<void()>& func)
+{
+    const auto begin = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i)
+    {
+        func();
+    }
+    const auto end = std::chrono::steady_clock::now();
+
+    const double elapsed = static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin)
+            .count());
+    const double average = elapsed / static_cast<double>(iterations);
+
+    std::cout << "  " << name << ": " << static_cast<long long>(average)
+              << " ns/op (" << iterations << " iterations)\n";
+
+    return average;
+}
+}  // namespace Benchmarks
+
+#define BENCHMARK_CONCAT_IMPL(a, b) a##b
+#define BENCHMARK_CONCAT(a, b) BENCHMARK_CONCAT_IMPL(a, b)
+
+//! Defines benchmark case with given \p name.
+#define BENCHMARK_CASE(name)                                          \
+    static void BENCHMARK_CONCAT(BenchmarkCase, __LINE__)();          \
+    static const bool BENCHMARK_CONCAT(BenchmarkReg, __LINE__) =      \
+        Benchmarks::Registry::Add(name,                               \
+                                  &BENCHMARK_CONCAT(BenchmarkCase,    \
+                                                    __LINE__));       \
+    static void BENCHMARK_CONCAT(BenchmarkCase, __LINE__)()
+
+#endif  // BENCHMARKS_BENCHMARK_HPP
@@ -0,0 +1,56 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Actions/Summon.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Views/FeatureEncoder.hpp>
+
+using namespace RosettaStone;
+
+BENCHMARK_CASE("[FeatureEncoder] - Encode")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    for (Player* player : { game.GetCurrentPlayer(),
+                            game.GetOpponentPlayer() })
+    {
+        for (const auto& name : { "Chillwind Yeti", "Bloodfen Raptor",
+                                  "Silvermoon Guardian", "Worgen Infiltrator" })
+        {
+            const auto minion = dynamic_cast<Minion*>(
+                Entity::GetFromCard(player, Cards::FindCardByName(name)));
+            Generic::Summon(minion, -1, nullptr);
+        }
+    }
+
+    game.GetCurrentPlayer()->SetTotalMana(10);
+    game.GetCurrentPlayer()->SetUsedMana(0);
+
+    constexpr std::size_t ITERATIONS = 200000;
+    constexpr std::size_t BATCH_SIZE = 32;
+
+    std::vector<float> data(BATCH_SIZE * FeatureEncoder::NUM_FEATURES);
+    const std::vector<const Game*> games(BATCH_SIZE, &game);
+
+    Benchmarks::Measure("One state", ITERATIONS,
+                        [&]() { FeatureEncoder::Encode(game, data.data()); });
+
+    Benchmarks::Measure("Batch of 32 states", ITERATIONS / BATCH_SIZE, [&]() {
+        FeatureEncoder::Encode(games, data.data());
+    });
+}
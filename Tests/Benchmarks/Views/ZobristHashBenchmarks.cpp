@@ -0,0 +1,52 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Actions/Summon.hpp>
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Views/Board.hpp>
+
+using namespace RosettaStone;
+
+BENCHMARK_CASE("[ZobristHash] - Board Hash")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    for (Player* player : { game.GetCurrentPlayer(),
+                            game.GetOpponentPlayer() })
+    {
+        for (const auto& name : { "Chillwind Yeti", "Bloodfen Raptor",
+                                  "Silvermoon Guardian", "Worgen Infiltrator" })
+        {
+            const auto minion = dynamic_cast<Minion*>(
+                Entity::GetFromCard(player, Cards::FindCardByName(name)));
+            Generic::Summon(minion, -1, nullptr);
+        }
+    }
+
+    constexpr std::size_t ITERATIONS = 200000;
+
+    const Board board(game, PlayerType::PLAYER1);
+    volatile std::size_t result = 0;
+
+    Benchmarks::Measure("ReducedBoardView", ITERATIONS, [&]() {
+        result = std::hash<ReducedBoardView>()(board.CreateView());
+    });
+
+    Benchmarks::Measure("ZobristHash", ITERATIONS,
+                        [&]() { result = board.GetHash(); });
+}
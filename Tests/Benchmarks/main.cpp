@@ -0,0 +1,37 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/Benchmark.hpp>
+
+#include <Rosetta/Cards/Cards.hpp>
+
+#include <iostream>
+#include <string>
+
+using namespace RosettaStone;
+
+int main(int argc, char* argv[])
+{
+    // Load card data before running any case; it can be measured only once
+    std::cout << "[Cards] - GetInstance\n";
+    Benchmarks::Measure("Cold start", 1, []() { Cards::GetInstance(); });
+
+    // Run the cases whose name contains the filter only if it is specified
+    const std::string filter = argc > 1 ? argv[1] : "";
+
+    for (auto& [name, func] : Benchmarks::Registry::Get())
+    {
+        if (name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+
+        std::cout << name << '\n';
+        func();
+    }
+
+    return 0;
+}
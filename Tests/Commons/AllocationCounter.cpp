@@ -0,0 +1,46 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Commons/AllocationCounter.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+std::atomic<std::size_t> g_numAllocations{ 0 };
+}  // namespace
+
+void* operator new(std::size_t size)
+{
+    g_numAllocations.fetch_add(1, std::memory_order_relaxed);
+
+    if (void* ptr = std::malloc(size == 0 ? 1 : size); ptr != nullptr)
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+namespace TestUtils
+{
+std::size_t GetNumAllocations()
+{
+    return g_numAllocations.load(std::memory_order_relaxed);
+}
+}  // namespace TestUtils
@@ -0,0 +1,21 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#ifndef TESTS_ALLOCATION_COUNTER_HPP
+#define TESTS_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+
+namespace TestUtils
+{
+//! Returns the number of calls to global operator new since the start of
+//! the program. A test program that links AllocationCounter.cpp replaces
+//! global operator new to count them.
+//! \return The number of heap allocations.
+std::size_t GetNumAllocations();
+}  // namespace TestUtils
+
+#endif  // TESTS_ALLOCATION_COUNTER_HPP
@@ -214,7 +214,7 @@ TEST_CASE("[Rogue : Hero] - DRG_610 : Galakrond, the Nightmare")
 
     for (int i = 0; i < 30; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Fireball");
+        config.player1Deck[i] = Cards::FindCardByName("Fireball");
     }
 
     Game game(config);
@@ -275,7 +275,7 @@ TEST_CASE("[Rogue : Hero] - DRG_610t2 : Galakrond, the Apocalypse")
 
     for (int i = 0; i < 30; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Fireball");
+        config.player1Deck[i] = Cards::FindCardByName("Fireball");
     }
 
     Game game(config);
@@ -336,7 +336,7 @@ TEST_CASE("[Rogue : Hero] - DRG_610t3 : Galakrond, Azeroth's End")
 
     for (int i = 0; i < 30; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Fireball");
+        config.player1Deck[i] = Cards::FindCardByName("Fireball");
     }
 
     Game game(config);
@@ -614,7 +614,7 @@ TEST_CASE("[Warrior : Hero] - DRG_650 : Galakrond, the Unbreakable")
 
     for (int i = 0; i < 30; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Wisp");
+        config.player1Deck[i] = Cards::FindCardByName("Wisp");
     }
 
     Game game(config);
@@ -683,7 +683,7 @@ TEST_CASE("[Warrior : Hero] - DRG_650t2 : Galakrond, the Apocalypse")
 
     for (int i = 0; i < 30; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Wisp");
+        config.player1Deck[i] = Cards::FindCardByName("Wisp");
     }
 
     Game game(config);
@@ -753,7 +753,7 @@ TEST_CASE("[Warrior : Hero] - DRG_650t3 : Galakrond, Azeroth's End")
 
     for (int i = 0; i < 30; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Wisp");
+        config.player1Deck[i] = Cards::FindCardByName("Wisp");
     }
 
     Game game(config);
@@ -832,8 +832,8 @@ TEST_CASE("[Priest : Hero] - DRG_660 : Galakrond, the Unspeakable")
 
     for (int i = 0; i < 30; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Wisp");
-        config.player2Deck[i] = *Cards::FindCardByName("Wisp");
+        config.player1Deck[i] = Cards::FindCardByName("Wisp");
+        config.player2Deck[i] = Cards::FindCardByName("Wisp");
     }
 
     Game game(config);
@@ -903,8 +903,8 @@ TEST_CASE("[Priest : Hero] - DRG_660t2 : Galakrond, the Apocalypse")
 
     for (int i = 0; i < 30; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Wisp");
-        config.player2Deck[i] = *Cards::FindCardByName("Wisp");
+        config.player1Deck[i] = Cards::FindCardByName("Wisp");
+        config.player2Deck[i] = Cards::FindCardByName("Wisp");
     }
 
     Game game(config);
@@ -973,8 +973,8 @@ TEST_CASE("[Priest : Hero] - DRG_660t3 : Galakrond, Azeroth's End")
 
     for (int i = 0; i < 30; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Wisp");
-        config.player2Deck[i] = *Cards::FindCardByName("Wisp");
+        config.player1Deck[i] = Cards::FindCardByName("Wisp");
+        config.player2Deck[i] = Cards::FindCardByName("Wisp");
     }
 
     Game game(config);
@@ -1179,7 +1179,7 @@ TEST_CASE("[Hunter : Minion] - DRG_010 : Diving Gryphon")
 
     for (int i = 0; i < 5; ++i)
     {
-        config.player1Deck[i] = *Cards::FindCardByName("Restless Mummy");
+        config.player1Deck[i] = Cards::FindCardByName("Restless Mummy");
     }
 
     Game game(config);
@@ -1402,7 +1402,7 @@ TEST_CASE("[Priest : Spell] - DRG_303 : Disciple of Galakrond")
     config.doFillDecks = false;
     config.autoRun = false;
 
-    config.player1Deck[0] = *Cards::FindCardByName("Galakrond, the Unspeakable");
+    config.player1Deck[0] = Cards::FindCardByName("Galakrond, the Unspeakable");
 
     Game game(config);
     game.Start();
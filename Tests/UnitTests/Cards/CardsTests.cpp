@@ -62,6 +62,21 @@ TEST_CASE("[Cards] - FindCardByDbfId")
     CHECK_EQ(card2->id, "");
 }
 
+TEST_CASE("[Cards] - GetCardIndex")
+{
+    Cards& instance = Cards::GetInstance();
+
+    for (const auto& card : instance.GetAllCards())
+    {
+        const CardIndex index = instance.GetCardIndex(card->id);
+        CHECK_EQ(index, card->index);
+        CHECK_EQ(instance.GetCardByIndex(index)->id, card->id);
+    }
+
+    CHECK_EQ(instance.GetCardIndex("INVALID"), INVALID_CARD_INDEX);
+    CHECK_EQ(instance.GetCardByIndex(INVALID_CARD_INDEX)->id, "");
+}
+
 TEST_CASE("[Cards] - FindCardByRarity")
 {
     Cards& instance = Cards::GetInstance();
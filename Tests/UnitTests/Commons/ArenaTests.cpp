@@ -0,0 +1,104 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Commons/Arena.hpp>
+
+#include <cstdint>
+
+using namespace RosettaStone;
+
+namespace
+{
+struct TestObject : public ArenaObject
+{
+    explicit TestObject(int* _destroyCount) : destroyCount(_destroyCount)
+    {
+        // Do nothing
+    }
+
+    ~TestObject()
+    {
+        ++*destroyCount;
+    }
+
+    int* destroyCount = nullptr;
+};
+}  // namespace
+
+TEST_CASE("[Arena] - Allocate")
+{
+    Arena arena(256);
+    CHECK_EQ(arena.GetNumBlocks(), 0);
+
+    void* ptr1 = arena.Allocate(10, 1);
+    void* ptr2 = arena.Allocate(8, 8);
+    CHECK_EQ(reinterpret_cast<std::uintptr_t>(ptr2) % 8, 0);
+    CHECK_NE(ptr1, ptr2);
+    CHECK_EQ(arena.GetNumBlocks(), 1);
+    CHECK_EQ(arena.GetAllocatedBytes(), 18);
+
+    arena.Allocate(200, 8);
+    CHECK_EQ(arena.GetNumBlocks(), 1);
+
+    arena.Allocate(100, 8);
+    CHECK_EQ(arena.GetNumBlocks(), 2);
+
+    // The oversized request gets a block of its own
+    arena.Allocate(1024, 8);
+    CHECK_EQ(arena.GetNumBlocks(), 3);
+
+    arena.Release();
+    CHECK_EQ(arena.GetNumBlocks(), 0);
+    CHECK_EQ(arena.GetAllocatedBytes(), 0);
+}
+
+TEST_CASE("[Arena] - ArenaObject")
+{
+    Arena arena;
+    int destroyCount = 0;
+
+    TestObject* heapObject = new TestObject(&destroyCount);
+    CHECK_EQ(arena.GetNumBlocks(), 0);
+
+    TestObject* arenaObject = nullptr;
+    {
+        Arena::Scope scope(&arena);
+        CHECK_EQ(Arena::GetCurrent(), &arena);
+
+        arenaObject = new TestObject(&destroyCount);
+        CHECK(arena.GetAllocatedBytes() >= sizeof(TestObject));
+        CHECK_EQ(arena.GetNumBlocks(), 1);
+
+        {
+            Arena::Scope heapScope(nullptr);
+            CHECK_EQ(Arena::GetCurrent(), nullptr);
+        }
+        CHECK_EQ(Arena::GetCurrent(), &arena);
+    }
+    CHECK_EQ(Arena::GetCurrent(), nullptr);
+
+    delete heapObject;
+    delete arenaObject;
+    CHECK_EQ(destroyCount, 2);
+}
+
+TEST_CASE("[Arena] - ArenaAllocator")
+{
+    Arena arena;
+
+    auto ptr = std::allocate_shared<int>(ArenaAllocator<int>(&arena), 5);
+    CHECK_EQ(*ptr, 5);
+    CHECK_EQ(arena.GetNumBlocks(), 1);
+    CHECK(arena.GetAllocatedBytes() >= sizeof(int));
+    ptr.reset();
+
+    auto heapPtr = std::allocate_shared<int>(ArenaAllocator<int>(nullptr), 3);
+    CHECK_EQ(*heapPtr, 3);
+    CHECK(ArenaAllocator<int>(&arena) == ArenaAllocator<double>(&arena));
+    CHECK(ArenaAllocator<int>(&arena) != ArenaAllocator<int>(nullptr));
+}
@@ -6,7 +6,10 @@
 
 #include "doctest_proxy.hpp"
 
+#include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Zones/DeckZone.hpp>
 
 using namespace RosettaStone;
 
@@ -81,3 +84,33 @@ TEST_CASE("[DeckString] - Decode")
     CHECK_EQ(info.GetNumCardInDeck("DAL_378"), 2);   // Unleash the Beast
     CHECK_EQ(info.GetNumCardInDeck("TRL_065"), 1);   // Zul'jin
 }
+
+TEST_CASE("[DeckString] - GetDeck")
+{
+    const std::string deckCode =
+        "AAECAR8IxwOHBMkErgaggAOnggObhQPWmQMLngGoArUDxQj+DJjwAu/xAvWJA+aWA/"
+        "mWA76YAwA=";
+
+    const auto& deck = DeckCode::GetDeck(deckCode);
+    const auto cardIDs = DeckCode::Decode(deckCode).GetCardIDs();
+
+    CHECK_EQ(cardIDs.size(), START_DECK_SIZE);
+    for (std::size_t i = 0; i < cardIDs.size(); ++i)
+    {
+        CHECK_EQ(deck[i], Cards::FindCardByID(cardIDs[i]));
+    }
+
+    // The deck is decoded only once
+    CHECK_EQ(&DeckCode::GetDeck(deckCode), &deck);
+
+    GameConfig config;
+    config.player1Class = CardClass::HUNTER;
+    config.player2Class = CardClass::HUNTER;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doShuffle = false;
+    config.player1Deck = deck;
+
+    Game game(config);
+    CHECK_EQ(game.GetPlayer1()->GetDeckZone()->GetCount(), 30);
+    CHECK_EQ(game.GetPlayer2()->GetDeckZone()->GetCount(), 0);
+}
@@ -0,0 +1,54 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Commons/FixedVector.hpp>
+
+#include <stdexcept>
+
+using namespace RosettaStone;
+
+TEST_CASE("[FixedVector] - Basic")
+{
+    FixedVector<int, 4> vec;
+    CHECK(vec.empty());
+    CHECK_EQ(vec.capacity(), 4u);
+
+    vec.push_back(1);
+    vec.push_back(2);
+    vec.emplace_back(3);
+    CHECK_EQ(vec.size(), 3u);
+    CHECK_EQ(vec.front(), 1);
+    CHECK_EQ(vec.back(), 3);
+    CHECK_EQ(vec[1], 2);
+
+    int sum = 0;
+    for (const int value : vec)
+    {
+        sum += value;
+    }
+    CHECK_EQ(sum, 6);
+
+    vec.erase(vec.begin());
+    const FixedVector<int, 4> expected{ 2, 3 };
+    CHECK(vec == expected);
+    CHECK_FALSE(vec != expected);
+    CHECK(vec.ToVector() == std::vector<int>({ 2, 3 }));
+
+    vec.pop_back();
+    CHECK_EQ(vec.size(), 1u);
+
+    vec.clear();
+    CHECK(vec.empty());
+}
+
+TEST_CASE("[FixedVector] - Full")
+{
+    FixedVector<int, 2> vec{ 1, 2 };
+    CHECK_THROWS_AS(vec.push_back(3), std::length_error);
+    CHECK_EQ(vec.size(), 2u);
+}
@@ -0,0 +1,67 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Commons/GameTagStore.hpp>
+
+using namespace RosettaStone;
+
+TEST_CASE("[GameTagStore] - Set and Erase")
+{
+    GameTagStore store;
+    CHECK_EQ(store.Find(GameTag::ATK), nullptr);
+    CHECK_EQ(store.Find(GameTag::TAG_SCRIPT_DATA_NUM_1), nullptr);
+
+    store.Set(GameTag::ATK, 3);
+    store.Set(GameTag::TAG_SCRIPT_DATA_NUM_1, 5);
+    store.Set(GameTag::CHOOSE_ONE, 1);
+    CHECK_EQ(*store.Find(GameTag::ATK), 3);
+    CHECK_EQ(*store.Find(GameTag::TAG_SCRIPT_DATA_NUM_1), 5);
+    CHECK_EQ(*store.Find(GameTag::CHOOSE_ONE), 1);
+
+    store.Set(GameTag::TAG_SCRIPT_DATA_NUM_1, 7);
+    CHECK_EQ(*store.Find(GameTag::TAG_SCRIPT_DATA_NUM_1), 7);
+
+    store.Erase(GameTag::ATK);
+    store.Erase(GameTag::TAG_SCRIPT_DATA_NUM_1);
+    CHECK_EQ(store.Find(GameTag::ATK), nullptr);
+    CHECK_EQ(store.Find(GameTag::TAG_SCRIPT_DATA_NUM_1), nullptr);
+    CHECK_EQ(*store.Find(GameTag::CHOOSE_ONE), 1);
+
+    const GameTagStore copy(store);
+    store.Set(GameTag::CHOOSE_ONE, 0);
+    CHECK_EQ(*copy.Find(GameTag::CHOOSE_ONE), 1);
+}
+
+TEST_CASE("[GameTagStore] - SetDefaults")
+{
+    const std::map<GameTag, int> defaults = { { GameTag::ATK, 2 },
+                                              { GameTag::HEALTH, 3 },
+                                              { GameTag::CHOOSE_ONE, 1 } };
+
+    GameTagStore store;
+    store.SetDefaults(defaults);
+    CHECK_EQ(*store.Find(GameTag::ATK), 2);
+    CHECK_EQ(*store.Find(GameTag::HEALTH), 3);
+    CHECK_EQ(*store.Find(GameTag::DAMAGE), 0);
+    CHECK_EQ(store.Find(GameTag::CHOOSE_ONE), nullptr);
+
+    store.Set(GameTag::TAG_SCRIPT_DATA_NUM_1, 4);
+
+    const auto tags = store.ToMap();
+    CHECK_EQ(tags.size(), GameTagStore::NUM_DENSE_TAGS + 1);
+    CHECK_EQ(tags.at(GameTag::ATK), 2);
+    CHECK_EQ(tags.at(GameTag::TAG_SCRIPT_DATA_NUM_1), 4);
+    CHECK_EQ(tags.count(GameTag::CHOOSE_ONE), 0);
+
+    std::size_t count = 0;
+    store.ForEach([&](GameTag tag, int value) {
+        CHECK_EQ(tags.at(tag), value);
+        ++count;
+    });
+    CHECK_EQ(count, tags.size());
+}
@@ -0,0 +1,112 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Commons/RandomGenerator.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+using namespace RosettaStone;
+
+TEST_CASE("[RandomGenerator] - Seed")
+{
+    RandomGenerator random1(42);
+    RandomGenerator random2(42);
+    RandomGenerator random3(43);
+
+    CHECK_EQ(random1.GetSeed(), 42u);
+
+    bool isDifferent = false;
+    for (int i = 0; i < 100; ++i)
+    {
+        const auto value = random1();
+        CHECK_EQ(value, random2());
+        isDifferent |= (value != random3());
+    }
+
+    CHECK(isDifferent);
+    CHECK_EQ(random1.GetCounter(), 100u);
+
+    // Copying the generator copies the position in the stream
+    RandomGenerator copy = random1;
+    CHECK_EQ(copy(), random1());
+}
+
+TEST_CASE("[RandomGenerator] - DefaultSeed")
+{
+    // The seeds are drawn from the random generator of the thread
+    RandomGenerator random1;
+    RandomGenerator random2;
+    CHECK_NE(random1.GetSeed(), random2.GetSeed());
+    CHECK_NE(RandomGenerator().GetSeed(), random1.GetSeed());
+}
+
+TEST_CASE("[RandomGenerator] - Fork")
+{
+    RandomGenerator random(42);
+    random();
+
+    RandomGenerator fork1 = random.Fork(0);
+    RandomGenerator fork2 = random.Fork(0);
+    RandomGenerator fork3 = random.Fork(1);
+
+    // Forking doesn't advance the generator
+    CHECK_EQ(random.GetCounter(), 1u);
+
+    const auto value = fork1();
+    CHECK_EQ(value, fork2());
+    CHECK_NE(value, fork3());
+    CHECK_NE(fork1.GetSeed(), random.GetSeed());
+}
+
+TEST_CASE("[RandomGenerator] - Get")
+{
+    RandomGenerator random(7);
+
+    std::vector<int> counts(6, 0);
+    for (int i = 0; i < 6000; ++i)
+    {
+        const int value = random.Get(-2, 3);
+        CHECK((value >= -2 && value <= 3));
+        ++counts[value + 2];
+    }
+
+    for (const int count : counts)
+    {
+        CHECK(count > 800);
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        const float value = random.Get(0.0f, 1.0f);
+        CHECK((value >= 0.0f && value < 1.0f));
+    }
+
+    CHECK_EQ(random.Get<std::size_t>(5, 5), 5u);
+}
+
+TEST_CASE("[RandomGenerator] - Shuffle")
+{
+    std::vector<int> values(30);
+    std::iota(values.begin(), values.end(), 0);
+
+    std::vector<int> shuffled1 = values;
+    std::vector<int> shuffled2 = values;
+
+    RandomGenerator random1(42);
+    RandomGenerator random2(42);
+    random1.Shuffle(shuffled1.begin(), shuffled1.end());
+    random2.Shuffle(shuffled2.begin(), shuffled2.end());
+
+    CHECK(shuffled1 == shuffled2);
+    CHECK(shuffled1 != values);
+
+    std::sort(shuffled1.begin(), shuffled1.end());
+    CHECK(shuffled1 == values);
+}
@@ -18,6 +18,9 @@
 #include <Rosetta/Tasks/PlayerTasks/EndTurnTask.hpp>
 #include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
 #include <Rosetta/Views/Board.hpp>
+#include <Rosetta/Zones/DeckZone.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
 
 #include <effolkronium/random.hpp>
 
@@ -64,6 +67,36 @@ class TestActionParams : public ActionParams
     const Board* m_board = nullptr;
 };
 
+namespace
+{
+class SeededActionParams : public ActionParams
+{
+ public:
+    explicit SeededActionParams(RandomGenerator& random) : m_random(random)
+    {
+        // Do nothing
+    }
+
+    void Init(const Board& board)
+    {
+        Initialize(board.GetCurPlayerStateRefView().GetActionValidGetter());
+    }
+
+    std::size_t GetNumber(ActionType actionType, ActionChoices& choices) final
+    {
+        if (actionType != ActionType::MAIN_ACTION && choices.Size() == 1)
+        {
+            return choices.Get(0);
+        }
+
+        return m_random.Get<std::size_t>(0, choices.Size() - 1);
+    }
+
+ private:
+    RandomGenerator& m_random;
+};
+}  // namespace
+
 TEST_CASE("[Game] - RefCopyFrom")
 {
     GameConfig config1;
@@ -95,6 +128,94 @@ TEST_CASE("[Game] - RefCopyFrom")
     delete game1;
 }
 
+TEST_CASE("[Game] - Clone")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+    opPlayer->SetTotalMana(10);
+    opPlayer->SetUsedMana(0);
+
+    const auto card1 = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Stormwind Champion"));
+    const auto card2 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Dire Wolf Alpha"));
+    const auto card3 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Acolyte of Pain"));
+    const auto card4 =
+        Generic::DrawCard(opPlayer, Cards::FindCardByName("Arcane Explosion"));
+
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    curPlayer->SetUsedMana(0);
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    game.Process(curPlayer, PlayCardTask::Minion(card3));
+
+    game.Process(curPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_START);
+
+    auto clonedGame = game.Clone();
+    CHECK_EQ(clonedGame->entityList.size(), game.entityList.size());
+    CHECK_EQ(clonedGame->GetTurn(), game.GetTurn());
+    CHECK_EQ(clonedGame->step, game.step);
+
+    // Clone the copy again and destroy the copy to check that the result
+    // doesn't refer to anything of the game it is copied from
+    auto game2 = clonedGame->Clone();
+    clonedGame.reset();
+
+    const auto check = [](Game& g, int champion, int wolf, int acolyte,
+                          int handCount) {
+        auto& field = *(g.GetPlayer1()->GetFieldZone());
+        CHECK_EQ(field.GetCount(), 3);
+        CHECK_EQ(field[0]->GetAttack(), 7);
+        CHECK_EQ(field[0]->GetHealth(), champion);
+        CHECK_EQ(field[1]->GetAttack(), 3);
+        CHECK_EQ(field[1]->GetHealth(), wolf);
+        CHECK_EQ(field[2]->GetAttack(), 3);
+        CHECK_EQ(field[2]->GetHealth(), acolyte);
+        CHECK_EQ(g.GetPlayer1()->GetHandZone()->GetCount(), handCount);
+    };
+
+    const int handCount = curPlayer->GetHandZone()->GetCount();
+    check(game, 6, 3, 4, handCount);
+    check(*game2, 6, 3, 4, handCount);
+
+    Player* opPlayer2 = game2->GetCurrentPlayer();
+    game2->Process(opPlayer2,
+                   PlayCardTask::Spell(game2->entityList[card4->id]));
+    check(*game2, 5, 2, 3, handCount + 1);
+    check(game, 6, 3, 4, handCount);
+
+    game.Process(opPlayer, PlayCardTask::Spell(card4));
+    check(game, 5, 2, 3, handCount + 1);
+
+    auto& hand = *(game.GetPlayer1()->GetHandZone());
+    auto& hand2 = *(game2->GetPlayer1()->GetHandZone());
+    for (int i = 0; i < hand.GetCount(); ++i)
+    {
+        CHECK_EQ(hand2[i]->card->id, hand[i]->card->id);
+    }
+
+    game2->Process(game2->GetCurrentPlayer(), EndTurnTask());
+    game2->ProcessUntil(Step::MAIN_START);
+    game.Process(opPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_START);
+    CHECK_EQ(game2->GetPlayer1()->GetHandZone()->GetCount(),
+             game.GetPlayer1()->GetHandZone()->GetCount());
+}
+
 TEST_CASE("[Game] - GetPlayers")
 {
     GameConfig config;
@@ -289,8 +410,8 @@ TEST_CASE("[Game] - PerformAction")
 
     for (std::size_t j = 0; j < deck.size(); ++j)
     {
-        config.player1Deck[j] = *Cards::FindCardByID(deck[j]);
-        config.player2Deck[j] = *Cards::FindCardByID(deck[j]);
+        config.player1Deck[j] = Cards::FindCardByID(deck[j]);
+        config.player2Deck[j] = Cards::FindCardByID(deck[j]);
     }
 
     Game game(config);
@@ -325,6 +446,267 @@ TEST_CASE("[Game] - PerformAction")
              true);
 }
 
+TEST_CASE("[Game] - GetLegalActions")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = false;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    for (const auto& name : { "Wisp", "Fireball", "Wrath" })
+    {
+        curPlayer->GetHandZone()->Add(
+            Entity::GetFromCard(curPlayer, Cards::FindCardByName(name),
+                                std::nullopt, curPlayer->GetHandZone()));
+    }
+
+    curPlayer->GetFieldZone()->Add(Entity::GetFromCard(
+        curPlayer, Cards::FindCardByName("Boulderfist Ogre"), std::nullopt,
+        curPlayer->GetFieldZone()));
+    opPlayer->GetFieldZone()->Add(Entity::GetFromCard(
+        opPlayer, Cards::FindCardByName("Chillwind Yeti"), std::nullopt,
+        opPlayer->GetFieldZone()));
+    (*curPlayer->GetFieldZone())[0]->SetExhausted(false);
+
+    constexpr int HERO = EncodedAction::HERO_SLOT;
+    constexpr int OGRE = EncodedAction::HERO_SLOT + 1;
+    constexpr int OP_HERO = EncodedAction::OPPONENT_HERO_SLOT;
+    constexpr int YETI = EncodedAction::OPPONENT_HERO_SLOT + 1;
+
+    const std::vector<EncodedAction> expected = {
+        // Wisp
+        EncodedAction::PlayCard(0, EncodedAction::NO_SLOT, 0),
+        EncodedAction::PlayCard(0, EncodedAction::NO_SLOT, 1),
+        // Fireball
+        EncodedAction::PlayCard(1, OGRE),
+        EncodedAction::PlayCard(1, YETI),
+        EncodedAction::PlayCard(1, HERO),
+        EncodedAction::PlayCard(1, OP_HERO),
+        // Wrath
+        EncodedAction::PlayCard(2, OGRE, 0, 1),
+        EncodedAction::PlayCard(2, OGRE, 0, 2),
+        EncodedAction::PlayCard(2, YETI, 0, 1),
+        EncodedAction::PlayCard(2, YETI, 0, 2),
+        // Boulderfist Ogre
+        EncodedAction::Attack(OGRE, YETI),
+        EncodedAction::Attack(OGRE, OP_HERO),
+        // Fireblast
+        EncodedAction::HeroPower(OGRE),
+        EncodedAction::HeroPower(YETI),
+        EncodedAction::HeroPower(HERO),
+        EncodedAction::HeroPower(OP_HERO),
+        EncodedAction::EndTurn(),
+    };
+
+    const auto actions = game.GetLegalActions();
+    CHECK_EQ(actions.size(), expected.size());
+    for (std::size_t i = 0; i < actions.size() && i < expected.size(); ++i)
+    {
+        CHECK_EQ(actions[i].GetValue(), expected[i].GetValue());
+    }
+
+    // Every legal action can be applied
+    for (const auto& action : actions)
+    {
+        auto clonedGame = game.Clone();
+        CHECK_NOTHROW(clonedGame->Apply(action));
+    }
+
+    auto game1 = game.Clone();
+    game1->Apply(EncodedAction::PlayCard(0, EncodedAction::NO_SLOT, 1));
+    CHECK_EQ(game1->GetCurrentPlayer()->GetFieldZone()->GetCount(), 2);
+    CHECK_EQ((*game1->GetCurrentPlayer()->GetFieldZone())[1]->card->name,
+             "Wisp");
+
+    auto game2 = game.Clone();
+    game2->Apply(EncodedAction::PlayCard(2, YETI, 0, 1));
+    CHECK_EQ((*game2->GetOpponentPlayer()->GetFieldZone())[0]->GetHealth(), 2);
+
+    const int opHealth = opPlayer->GetHero()->GetHealth();
+    auto game3 = game.Clone();
+    game3->Apply(EncodedAction::Attack(OGRE, OP_HERO));
+    CHECK_EQ(game3->GetOpponentPlayer()->GetHero()->GetHealth(), opHealth - 6);
+
+    CHECK_THROWS_AS(game.Apply(EncodedAction::PlayCard(3)),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(game.Apply(EncodedAction::Attack(OP_HERO, HERO)),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(game.Apply(EncodedAction()), std::invalid_argument);
+}
+
+TEST_CASE("[Game] - Apply")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::ROGUE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doShuffle = false;
+    config.doFillDecks = false;
+    config.skipMulligan = true;
+    config.autoRun = true;
+    config.seed = 42;
+
+    const std::string INNKEEPER_EXPERT_WARLOCK =
+        "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+    auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+
+    for (std::size_t j = 0; j < deck.size(); ++j)
+    {
+        config.player1Deck[j] = Cards::FindCardByID(deck[j]);
+        config.player2Deck[j] = Cards::FindCardByID(deck[j]);
+    }
+
+    Game game(config);
+    game.Start();
+    game.MainReady();
+
+    RandomGenerator random(42);
+    std::vector<EncodedAction> actions;
+
+    while (game.state != State::COMPLETE)
+    {
+        game.GetLegalActions(actions);
+        CHECK_FALSE(actions.empty());
+        CHECK_EQ(actions.back(), EncodedAction::EndTurn());
+
+        const auto idx = random.Get<std::size_t>(0, actions.size() - 1);
+        const auto [p1State, p2State] = game.Apply(actions[idx]);
+        CHECK_NE(p1State, PlayState::INVALID);
+        CHECK_NE(p2State, PlayState::INVALID);
+    }
+
+    CHECK_EQ(game.state, State::COMPLETE);
+}
+
+TEST_CASE("[Game] - Arena")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::WARLOCK;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doShuffle = false;
+    config.doFillDecks = false;
+    config.skipMulligan = true;
+    config.autoRun = true;
+    config.useArena = true;
+
+    const std::string INNKEEPER_EXPERT_WARLOCK =
+        "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+    auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+
+    for (std::size_t j = 0; j < deck.size(); ++j)
+    {
+        config.player1Deck[j] = Cards::FindCardByID(deck[j]);
+        config.player2Deck[j] = Cards::FindCardByID(deck[j]);
+    }
+
+    Game game(config);
+    CHECK(game.arena != nullptr);
+
+    game.Start();
+    game.MainReady();
+
+    const std::size_t numBlocks = game.arena->GetNumBlocks();
+    CHECK(numBlocks > 0);
+
+    std::unique_ptr<Game> game2;
+    while (game.state != State::COMPLETE)
+    {
+        TestActionParams params;
+        Board board(game, game.GetCurrentPlayer()->playerType);
+
+        params.Init(board);
+        board.ApplyAction(params);
+
+        if (game2 == nullptr && game.GetTurn() >= 6 &&
+            game.state != State::COMPLETE)
+        {
+            game2 = game.Clone();
+            CHECK(game2->arena != nullptr);
+            CHECK(game2->arena != game.arena);
+        }
+    }
+
+    CHECK(game.arena->GetAllocatedBytes() > 0);
+
+    while (game2 != nullptr && game2->state != State::COMPLETE)
+    {
+        TestActionParams params;
+        Board board(*game2, game2->GetCurrentPlayer()->playerType);
+
+        params.Init(board);
+        board.ApplyAction(params);
+    }
+}
+
+TEST_CASE("[Game] - Seed")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::RANDOM;
+    config.doFillDecks = true;
+    config.autoRun = true;
+    config.seed = 42;
+
+    const auto playGame = [&](std::uint64_t seed) {
+        config.seed = seed;
+
+        Game game(config);
+        CHECK_EQ(game.GetSeed(), seed);
+        game.Start();
+
+        std::vector<std::string> deck;
+        for (auto& playable : game.GetPlayer1()->GetDeckZone()->GetAll())
+        {
+            deck.emplace_back(playable->card->id);
+        }
+
+        RandomGenerator actionRandom(7);
+        std::vector<int> trace;
+        while (game.state != State::COMPLETE)
+        {
+            SeededActionParams params(actionRandom);
+            Board board(game, game.GetCurrentPlayer()->playerType);
+
+            params.Init(board);
+            board.ApplyAction(params);
+
+            trace.emplace_back(game.GetPlayer1()->GetHero()->GetHealth());
+            trace.emplace_back(game.GetPlayer2()->GetHero()->GetHealth());
+        }
+
+        return std::make_pair(deck, trace);
+    };
+
+    const auto result1 = playGame(42);
+    const auto result2 = playGame(42);
+    CHECK(result1.first == result2.first);
+    CHECK(result1.second == result2.second);
+
+    const auto result3 = playGame(43);
+    CHECK(result1.first != result3.first);
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    auto game2 = game.Clone();
+    CHECK_EQ(game2->GetSeed(), game.GetSeed());
+    CHECK_EQ(game2->GetRandom()(), game.GetRandom()());
+}
+
 TEST_CASE("[Game] - CreateView")
 {
     GameConfig config;
@@ -346,4 +728,59 @@ TEST_CASE("[Game] - CreateView")
 
     const auto player2View = game.CreateView();
     CHECK_EQ(player2View.GetMyHeroPower().cardID, "CS2_083b");
-}
\ No newline at end of file
+}
+
+TEST_CASE("[Game] - UpdateAura")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    auto& curField = *(curPlayer->GetFieldZone());
+
+    const auto card1 =
+        Generic::DrawCard(curPlayer, Cards::FindCardByName("Murloc Raider"));
+    const auto card2 = Generic::DrawCard(
+        curPlayer, Cards::FindCardByName("Warsong Commander"));
+
+    game.Process(curPlayer, PlayCardTask::Minion(card1));
+    game.Process(curPlayer, PlayCardTask::Minion(card2));
+    CHECK_EQ(curField[0]->GetAttack(), 2);
+
+    // The aura is skipped if nothing is changed.
+    const std::size_t version = game.GetStateVersion();
+    game.ProcessDestroyAndUpdateAura();
+    CHECK_EQ(game.GetStateVersion(), version);
+
+    // The aura renews only the changed minion.
+    curField[0]->SetGameTag(GameTag::CHARGE, 1);
+    CHECK(game.GetStateVersion() > version);
+    CHECK_EQ(curField[0]->GetVersion(), game.GetStateVersion());
+    game.ProcessDestroyAndUpdateAura();
+    CHECK_EQ(curField[0]->GetAttack(), 3);
+    CHECK_EQ(curField[1]->GetAttack(), 2);
+
+    curField[0]->SetGameTag(GameTag::CHARGE, 0);
+    game.ProcessDestroyAndUpdateAura();
+    CHECK_EQ(curField[0]->GetAttack(), 2);
+
+    // The clone renews the aura by itself.
+    const auto clone = game.Clone();
+    CHECK(clone->GetStateVersion() >= game.GetStateVersion());
+    clone->GetCurrentPlayer()->GetFieldZone()->GetAll()[0]->SetGameTag(
+        GameTag::CHARGE, 1);
+    clone->ProcessDestroyAndUpdateAura();
+    CHECK_EQ((*clone->GetCurrentPlayer()->GetFieldZone())[0]->GetAttack(), 3);
+    CHECK_EQ(curField[0]->GetAttack(), 2);
+}
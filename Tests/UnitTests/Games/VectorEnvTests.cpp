@@ -0,0 +1,167 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Commons/DeckCode.hpp>
+#include <Rosetta/Games/VectorEnv.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace RosettaStone;
+
+namespace
+{
+GameConfig CreateConfig()
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::WARLOCK;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = false;
+    config.seed = 42;
+
+    const std::string INNKEEPER_EXPERT_WARLOCK =
+        "AAEBAfqUAwAPMJMB3ALVA9AE9wTOBtwGkgeeB/sHsQjCCMQI9ggA";
+    auto deck = DeckCode::Decode(INNKEEPER_EXPERT_WARLOCK).GetCardIDs();
+
+    for (std::size_t j = 0; j < deck.size(); ++j)
+    {
+        config.player1Deck[j] = Cards::FindCardByID(deck[j]);
+        config.player2Deck[j] = Cards::FindCardByID(deck[j]);
+    }
+
+    return config;
+}
+
+//! Selects a random legal action of each game from the action masks.
+std::vector<std::int32_t> SelectActions(const VectorEnv& env,
+                                        RandomGenerator& random)
+{
+    std::vector<std::int32_t> actions(env.GetNumEnvs());
+    std::vector<std::int32_t> legalActions;
+
+    for (std::size_t i = 0; i < env.GetNumEnvs(); ++i)
+    {
+        const std::uint8_t* mask =
+            env.GetActionMasks() + i * VectorEnv::NUM_ACTIONS;
+
+        legalActions.clear();
+        for (std::size_t j = 0; j < VectorEnv::NUM_ACTIONS; ++j)
+        {
+            if (mask[j] != 0)
+            {
+                legalActions.emplace_back(static_cast<std::int32_t>(j));
+            }
+        }
+
+        actions[i] = legalActions[random.Get<std::size_t>(
+            0, legalActions.size() - 1)];
+    }
+
+    return actions;
+}
+}  // namespace
+
+TEST_CASE("[VectorEnv] - ActionIndex")
+{
+    for (std::size_t i = 0; i < VectorEnv::NUM_ACTIONS; ++i)
+    {
+        const auto idx = static_cast<int>(i);
+        CHECK_EQ(VectorEnv::ToActionIndex(VectorEnv::FromActionIndex(idx)),
+                 idx);
+    }
+
+    CHECK_EQ(VectorEnv::FromActionIndex(VectorEnv::END_TURN_OFFSET),
+             EncodedAction::EndTurn());
+    CHECK_EQ(VectorEnv::FromActionIndex(VectorEnv::HERO_POWER_OFFSET +
+                                        EncodedAction::OPPONENT_HERO_SLOT),
+             EncodedAction::HeroPower(EncodedAction::OPPONENT_HERO_SLOT));
+    CHECK_EQ(VectorEnv::ToActionIndex(EncodedAction()), -1);
+
+    CHECK_THROWS_AS(VectorEnv::FromActionIndex(-1), std::invalid_argument);
+    CHECK_THROWS_AS(VectorEnv::FromActionIndex(VectorEnv::NUM_ACTIONS),
+                    std::invalid_argument);
+}
+
+TEST_CASE("[VectorEnv] - Reset")
+{
+    VectorEnv env(CreateConfig(), 4, 2);
+    CHECK_EQ(env.GetNumEnvs(), 4u);
+
+    for (std::size_t i = 0; i < env.GetNumEnvs(); ++i)
+    {
+        const Game& game = env.GetGame(i);
+        CHECK_EQ(game.step, Step::MAIN_ACTION);
+
+        const std::uint8_t* mask =
+            env.GetActionMasks() + i * VectorEnv::NUM_ACTIONS;
+        const auto numLegal = static_cast<std::size_t>(
+            std::count(mask, mask + VectorEnv::NUM_ACTIONS, 1));
+        CHECK_EQ(numLegal, game.GetLegalActions().size());
+        CHECK_EQ(mask[VectorEnv::END_TURN_OFFSET], 1);
+
+        CHECK_EQ(env.GetRewards()[i], 0.0f);
+        CHECK_EQ(env.GetDones()[i], 0);
+    }
+
+    // An illegal action doesn't change any game
+    std::vector<std::int32_t> actions(env.GetNumEnvs(),
+                                      VectorEnv::END_TURN_OFFSET);
+    actions[1] = VectorEnv::ATTACK_OFFSET;
+    CHECK_THROWS_AS(env.Step(actions), std::invalid_argument);
+    CHECK_EQ(env.GetGame(0).GetTurn(), 1);
+
+    actions.pop_back();
+    CHECK_THROWS_AS(env.Step(actions), std::invalid_argument);
+}
+
+TEST_CASE("[VectorEnv] - Step")
+{
+    constexpr std::size_t NUM_ENVS = 8;
+
+    VectorEnv env1(CreateConfig(), NUM_ENVS, 4);
+    VectorEnv env2(CreateConfig(), NUM_ENVS, 1);
+
+    RandomGenerator random(42);
+    std::size_t numDones = 0;
+
+    for (int step = 0; step < 5000 && numDones < 2 * NUM_ENVS; ++step)
+    {
+        const auto actions = SelectActions(env1, random);
+        env1.Step(actions);
+        env2.Step(actions);
+
+        for (std::size_t i = 0; i < NUM_ENVS; ++i)
+        {
+            const float reward = env1.GetRewards()[i];
+            if (env1.GetDones()[i] != 0)
+            {
+                ++numDones;
+                CHECK((reward == 1.0f || reward == -1.0f || reward == 0.0f));
+            }
+            else
+            {
+                CHECK_EQ(reward, 0.0f);
+            }
+
+            CHECK_NE(env1.GetGame(i).state, State::COMPLETE);
+        }
+
+        // The same seed and the same actions make the same games
+        // regardless of the number of threads
+        CHECK(std::memcmp(env1.GetObservations(), env2.GetObservations(),
+                          NUM_ENVS * VectorEnv::NUM_FEATURES *
+                              sizeof(float)) == 0);
+        CHECK(std::memcmp(env1.GetActionMasks(), env2.GetActionMasks(),
+                          NUM_ENVS * VectorEnv::NUM_ACTIONS) == 0);
+        CHECK(std::memcmp(env1.GetDones(), env2.GetDones(), NUM_ENVS) == 0);
+    }
+
+    CHECK(numDones >= 2 * NUM_ENVS);
+}
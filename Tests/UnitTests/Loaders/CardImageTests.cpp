@@ -0,0 +1,121 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Loaders/CardImage.hpp>
+#include <Rosetta/Loaders/CardLoader.hpp>
+
+#include <cstdio>
+#include <fstream>
+
+using namespace RosettaStone;
+
+namespace
+{
+void Release(std::vector<Card*>& cards)
+{
+    for (Card* card : cards)
+    {
+        delete card;
+    }
+    cards.clear();
+}
+}  // namespace
+
+TEST_CASE("[CardImage] - Save and Load")
+{
+    const std::string path = "CardImageTests.bin";
+    const std::vector<Card*>& cards = Cards::GetAllCards();
+
+    CHECK(CardImage::Save(path, 42, cards));
+
+    std::vector<Card*> loaded;
+    CHECK(CardImage::Load(path, 42, loaded));
+    CHECK_EQ(loaded.size(), cards.size());
+
+    for (std::size_t i = 0; i < loaded.size() && i < cards.size(); ++i)
+    {
+        CHECK_EQ(loaded[i]->id, cards[i]->id);
+        CHECK_EQ(loaded[i]->dbfID, cards[i]->dbfID);
+        CHECK_EQ(loaded[i]->name, cards[i]->name);
+        CHECK_EQ(loaded[i]->text, cards[i]->text);
+        CHECK(loaded[i]->gameTags == cards[i]->gameTags);
+    }
+    Release(loaded);
+
+    // A stale image is rejected
+    CHECK_FALSE(CardImage::Load(path, 43, loaded));
+    CHECK(loaded.empty());
+
+    // A truncated image is rejected
+    {
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        std::string data(static_cast<std::size_t>(in.tellg()), '\0');
+        in.seekg(0);
+        in.read(data.data(), static_cast<std::streamsize>(data.size()));
+        in.close();
+
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out.write(data.data(),
+                  static_cast<std::streamsize>(data.size() - 1));
+    }
+    CHECK_FALSE(CardImage::Load(path, 42, loaded));
+    CHECK(loaded.empty());
+
+    std::remove(path.c_str());
+    CHECK_FALSE(CardImage::Load(path, 42, loaded));
+}
+
+TEST_CASE("[CardImage] - CardLoader")
+{
+    const std::string jsonPath = "CardImageTests.json";
+    const std::string imagePath = "CardImageTests.json.bin";
+
+    const std::string json =
+        R"([{"id": "TEST_001", "name": "Test", "dbfId": 1,)"
+        R"( "cost": 3, "mechanics": ["TAUNT"]}])";
+    {
+        std::ofstream out(jsonPath, std::ios::binary | std::ios::trunc);
+        out << json;
+    }
+    std::remove(imagePath.c_str());
+
+    // The first load parses JSON and writes the image
+    std::vector<Card*> cards;
+    CardLoader::Load(jsonPath, imagePath, cards);
+    CHECK_EQ(cards.size(), 1u);
+    CHECK_EQ(cards[0]->id, "TEST_001");
+    CHECK_EQ(cards[0]->gameTags[GameTag::TAUNT], 1);
+    CHECK_EQ(cards[0]->gameTags[GameTag::COST], 3);
+
+    // The second load reads the image that is up to date
+    cards[0]->name = "Image";
+    CHECK(CardImage::Save(imagePath,
+                          CardImage::ComputeChecksum(json.data(), json.size()),
+                          cards));
+    Release(cards);
+
+    CardLoader::Load(jsonPath, imagePath, cards);
+    CHECK_EQ(cards.size(), 1u);
+    CHECK_EQ(cards[0]->name, "Image");
+    Release(cards);
+
+    // Changing JSON file invalidates the image
+    {
+        std::ofstream out(jsonPath, std::ios::binary | std::ios::trunc);
+        out << R"([{"id": "TEST_002", "name": "Test2", "dbfId": 2}])";
+    }
+    CardLoader::Load(jsonPath, imagePath, cards);
+    CHECK_EQ(cards.size(), 1u);
+    CHECK_EQ(cards[0]->id, "TEST_002");
+    CHECK_EQ(cards[0]->name, "Test2");
+    Release(cards);
+
+    std::remove(jsonPath.c_str());
+    std::remove(imagePath.c_str());
+}
@@ -0,0 +1,119 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Managers/TriggerEvent.hpp>
+
+#include <functional>
+#include <vector>
+
+using namespace RosettaStone;
+
+namespace
+{
+struct TestListener
+{
+    void Handle(Entity*)
+    {
+        calls->emplace_back(number);
+
+        if (onHandle)
+        {
+            onHandle();
+        }
+    }
+
+    TriggerEventHandler GetHandler()
+    {
+        return TriggerEventHandler::Create<TestListener, &TestListener::Handle>(
+            this);
+    }
+
+    int number = 0;
+    std::vector<int>* calls = nullptr;
+    std::function<void()> onHandle;
+};
+}  // namespace
+
+TEST_CASE("[TriggerEvent] - Notify")
+{
+    std::vector<int> calls;
+    TestListener listener1{ 1, &calls, nullptr };
+    TestListener listener2{ 2, &calls, nullptr };
+    TestListener listener3{ 3, &calls, nullptr };
+
+    const TriggerEventHandler handler1 = listener1.GetHandler();
+    const TriggerEventHandler handler2 = listener2.GetHandler();
+    const TriggerEventHandler handler3 = listener3.GetHandler();
+    CHECK(handler1 != nullptr);
+    CHECK_FALSE(handler1 == handler2);
+
+    TriggerEvent event;
+    event += handler1;
+    event += handler2;
+    event += handler3;
+
+    event(nullptr);
+    CHECK_EQ(calls, (std::vector<int>{ 1, 2, 3 }));
+
+    calls.clear();
+    event -= handler2;
+    event(nullptr);
+    CHECK_EQ(calls, (std::vector<int>{ 1, 3 }));
+}
+
+TEST_CASE("[TriggerEvent] - Change handlers while notifying")
+{
+    std::vector<int> calls;
+    TestListener listener1{ 1, &calls, nullptr };
+    TestListener listener2{ 2, &calls, nullptr };
+    TestListener listener3{ 3, &calls, nullptr };
+    TestListener listener4{ 4, &calls, nullptr };
+
+    const TriggerEventHandler handler1 = listener1.GetHandler();
+    const TriggerEventHandler handler2 = listener2.GetHandler();
+    const TriggerEventHandler handler3 = listener3.GetHandler();
+    const TriggerEventHandler handler4 = listener4.GetHandler();
+
+    TriggerEvent event;
+    event += handler1;
+    event += handler2;
+    event += handler3;
+
+    // Removing a handler is deferred until the notification ends,
+    // and the added handler runs from the next notification.
+    listener1.onHandle = [&]() {
+        event -= handler3;
+        event += handler4;
+    };
+    event(nullptr);
+    CHECK_EQ(calls, (std::vector<int>{ 1, 2, 3 }));
+
+    calls.clear();
+    listener1.onHandle = nullptr;
+    event(nullptr);
+    CHECK_EQ(calls, (std::vector<int>{ 1, 2, 4 }));
+
+    // Nested notification doesn't erase the handlers of the outer one
+    calls.clear();
+    bool isNested = false;
+    listener2.onHandle = [&]() {
+        if (!isNested)
+        {
+            isNested = true;
+            event -= handler1;
+            event(nullptr);
+        }
+    };
+    event(nullptr);
+    CHECK_EQ(calls, (std::vector<int>{ 1, 2, 1, 2, 4, 4 }));
+
+    calls.clear();
+    listener2.onHandle = nullptr;
+    event(nullptr);
+    CHECK_EQ(calls, (std::vector<int>{ 2, 4 }));
+}
@@ -0,0 +1,88 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/TestUtils.hpp>
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Cards/Cards.hpp>
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Models/Enchantment.hpp>
+#include <Rosetta/Models/Hero.hpp>
+#include <Rosetta/Models/Minion.hpp>
+#include <Rosetta/Models/Spell.hpp>
+#include <Rosetta/Models/Weapon.hpp>
+
+using namespace RosettaStone;
+using namespace TestUtils;
+
+namespace
+{
+template <typename T>
+void CheckEntityCast(Entity* entity)
+{
+    CHECK_EQ(EntityCast<T>(entity), dynamic_cast<T*>(entity));
+    CHECK_EQ(EntityCast<const T>(static_cast<const Entity*>(entity)),
+             dynamic_cast<const T*>(entity));
+}
+
+void CheckEntityCasts(Entity* entity)
+{
+    CheckEntityCast<Player>(entity);
+    CheckEntityCast<Playable>(entity);
+    CheckEntityCast<Character>(entity);
+    CheckEntityCast<Hero>(entity);
+    CheckEntityCast<HeroPower>(entity);
+    CheckEntityCast<Minion>(entity);
+    CheckEntityCast<Spell>(entity);
+    CheckEntityCast<Weapon>(entity);
+    CheckEntityCast<Enchantment>(entity);
+}
+}  // namespace
+
+TEST_CASE("[Entity] - GetKind")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::MAGE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+
+    Playable* minion =
+        Entity::GetFromCard(curPlayer, Cards::FindCardByName("Wisp"));
+    Playable* spell =
+        Entity::GetFromCard(curPlayer, Cards::FindCardByName("Fireball"));
+    Playable* weapon =
+        Entity::GetFromCard(curPlayer, Cards::FindCardByName("Fiery War Axe"));
+
+    auto card = GenerateEnchantmentCard("enchantment1");
+    const auto enchantment =
+        Enchantment::GetInstance(curPlayer, &card, minion);
+
+    CHECK_EQ(curPlayer->GetKind(), EntityKind::PLAYER);
+    CHECK_EQ(curPlayer->GetHero()->GetKind(), EntityKind::HERO);
+    CHECK_EQ(curPlayer->GetHero()->heroPower->GetKind(),
+             EntityKind::HERO_POWER);
+    CHECK_EQ(minion->GetKind(), EntityKind::MINION);
+    CHECK_EQ(spell->GetKind(), EntityKind::SPELL);
+    CHECK_EQ(weapon->GetKind(), EntityKind::WEAPON);
+    CHECK_EQ(enchantment->GetKind(), EntityKind::ENCHANTMENT);
+
+    for (Entity* entity : std::vector<Entity*>{
+             curPlayer, curPlayer->GetHero(), curPlayer->GetHero()->heroPower,
+             minion, spell, weapon, enchantment.get() })
+    {
+        CheckEntityCasts(entity);
+    }
+
+    CHECK_EQ(EntityCast<Minion>(static_cast<Entity*>(nullptr)), nullptr);
+}
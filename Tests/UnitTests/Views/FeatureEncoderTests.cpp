@@ -0,0 +1,137 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/TestUtils.hpp>
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Views/FeatureEncoder.hpp>
+#include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/HandZone.hpp>
+
+#include <cmath>
+
+using namespace RosettaStone;
+using namespace TestUtils;
+
+namespace
+{
+float Normalize(double v, double min, double max)
+{
+    const double scale = std::sqrt(12.0) / (max - min);
+    return static_cast<float>((v - (min + max) / 2) * scale);
+}
+}  // namespace
+
+TEST_CASE("[FeatureEncoder] - Encode")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::ROGUE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    curPlayer->SetTotalMana(4);
+    curPlayer->SetUsedMana(1);
+    curPlayer->GetHero()->SetDamage(10);
+    curPlayer->GetHero()->SetArmor(5);
+    opPlayer->GetHero()->SetDamage(3);
+
+    Card curCard = GenerateMinionCard("minion1", 2, 3);
+    PlayMinionCard(curPlayer, &curCard);
+    curPlayer->GetFieldZone()->GetAll()[0]->SetGameTag(GameTag::TAUNT, 1);
+
+    Card opCard = GenerateMinionCard("minion2", 5, 6);
+    PlayMinionCard(opPlayer, &opCard);
+
+    using FE = FeatureEncoder;
+    std::vector<float> data(FE::NUM_FEATURES, 100.0f);
+    FE::Encode(game, data.data());
+
+    // Hero
+    CHECK_EQ(data[FE::HERO_OFFSET], Normalize(25, 0, 30));
+    CHECK_EQ(data[FE::HERO_OFFSET + 1], Normalize(27, 0, 30));
+
+    // Minion
+    const float boolTrue = Normalize(1, -1, 1);
+    const float boolFalse = Normalize(-1, -1, 1);
+    const float* minion = &data[FE::MINION_OFFSET];
+
+    CHECK_EQ(minion[0], Normalize(3, 1, 7));
+    CHECK_EQ(minion[1], Normalize(3, 1, 7));
+    CHECK_EQ(minion[2], Normalize(2, 0, 7));
+    CHECK_EQ(minion[3], boolFalse);
+    CHECK_EQ(minion[4], boolTrue);
+    CHECK_EQ(minion[5], boolFalse);
+    CHECK_EQ(minion[6], boolFalse);
+    CHECK_EQ(minion[7], 0.0f);
+    CHECK_EQ(minion[10], boolFalse);
+
+    minion += FE::NUM_MAX_MINIONS * FE::NUM_MINION_FEATURES;
+    CHECK_EQ(minion[0], Normalize(6, 1, 7));
+    CHECK_EQ(minion[2], Normalize(5, 0, 7));
+    CHECK_EQ(minion[4], boolFalse);
+
+    // Standalone
+    const float* standalone = &data[FE::STANDALONE_OFFSET];
+    HandZone& handZone = *curPlayer->GetHandZone();
+    const int handCount = handZone.GetCount();
+
+    CHECK_EQ(standalone[0], Normalize(3, 0, 10));
+    CHECK_EQ(standalone[1], Normalize(4, 0, 10));
+    CHECK_EQ(standalone[2], Normalize(0, 0, 10));
+    CHECK_EQ(standalone[3], Normalize(handCount, 0, 10));
+
+    for (int i = 0; i < static_cast<int>(FE::NUM_MAX_HAND_CARDS); ++i)
+    {
+        const int cost = i < handCount ? handZone[i]->GetCost() : -1;
+        CHECK_EQ(standalone[5 + i], Normalize(cost, 0, 10));
+    }
+
+    const int opHandCount = opPlayer->GetHandZone()->GetCount();
+    CHECK_EQ(standalone[15], Normalize(opHandCount, 0, 10));
+    CHECK_EQ(standalone[16], boolTrue);
+}
+
+TEST_CASE("[FeatureEncoder] - Encode Batch")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game1(config);
+    game1.Start();
+    game1.ProcessUntil(Step::MAIN_START);
+
+    Game game2(config);
+    game2.Start();
+    game2.ProcessUntil(Step::MAIN_START);
+    game2.GetCurrentPlayer()->GetHero()->SetDamage(20);
+
+    using FE = FeatureEncoder;
+    std::vector<float> single(2 * FE::NUM_FEATURES);
+    FE::Encode(game1, single.data());
+    FE::Encode(game2, single.data() + FE::NUM_FEATURES);
+
+    std::vector<float> batch(2 * FE::NUM_FEATURES);
+    FE::Encode({ &game1, &game2 }, batch.data());
+
+    CHECK(single == batch);
+    CHECK_NE(batch[FE::HERO_OFFSET],
+             batch[FE::NUM_FEATURES + FE::HERO_OFFSET]);
+}
@@ -0,0 +1,115 @@
+// Copyright (c) 2019 Chris Ohk, Youngjoong Kim, SeungHyun Jeon
+
+// We are making my contributions/submissions to this project solely in our
+// personal capacity and are not conveying any rights to any intellectual
+// property of any third parties.
+
+#include <Utils/TestUtils.hpp>
+#include "doctest_proxy.hpp"
+
+#include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Games/GameConfig.hpp>
+#include <Rosetta/Views/Board.hpp>
+#include <Rosetta/Views/ZobristHash.hpp>
+
+using namespace RosettaStone;
+using namespace TestUtils;
+
+TEST_CASE("[ZobristHash] - Compute")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARRIOR;
+    config.player2Class = CardClass::ROGUE;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    curPlayer->SetTotalMana(10);
+    curPlayer->SetUsedMana(0);
+
+    Card weaponCard = GenerateWeaponCard("weapon1", 3, 2);
+    PlayWeaponCard(opPlayer, &weaponCard);
+
+    const Board board1(game, PlayerType::PLAYER1);
+    const Board board2(game, PlayerType::PLAYER2);
+
+    const auto hash1 = ZobristHash::Compute(game, PlayerType::PLAYER1);
+    const auto hash2 = ZobristHash::Compute(game, PlayerType::PLAYER2);
+
+    CHECK_EQ(board1.GetHash(), hash1);
+    CHECK_EQ(board2.GetHash(), hash2);
+    CHECK_NE(hash1, hash2);
+
+    // The hidden info of the opponent player doesn't change the hash
+    (*opPlayer->GetHandZone())[0]->SetCost(9);
+    CHECK_EQ(ZobristHash::Compute(game, PlayerType::PLAYER1), hash1);
+    CHECK_NE(ZobristHash::Compute(game, PlayerType::PLAYER2), hash2);
+
+    Card minionCard = GenerateMinionCard("minion1", 1, 2);
+    PlayMinionCard(curPlayer, &minionCard);
+
+    const auto hash3 = ZobristHash::Compute(game, PlayerType::PLAYER1);
+    CHECK_NE(hash3, hash1);
+
+    (*curPlayer->GetFieldZone())[0]->SetGameTag(GameTag::TAUNT, 1);
+    const auto hash4 = ZobristHash::Compute(game, PlayerType::PLAYER1);
+    CHECK_NE(hash4, hash3);
+
+    (*curPlayer->GetFieldZone())[0]->SetGameTag(GameTag::TAUNT, 0);
+    CHECK_EQ(ZobristHash::Compute(game, PlayerType::PLAYER1), hash3);
+}
+
+TEST_CASE("[ZobristHash] - Equal Views")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::PRIEST;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.doShuffle = false;
+    config.autoRun = false;
+
+    Game game1(config);
+    game1.Start();
+    game1.ProcessUntil(Step::MAIN_START);
+
+    Game game2(config);
+    game2.Start();
+    game2.ProcessUntil(Step::MAIN_START);
+
+    const Board board1(game1, PlayerType::PLAYER1);
+    const Board board2(game2, PlayerType::PLAYER1);
+
+    CHECK(board1.CreateView() == board2.CreateView());
+    CHECK_EQ(board1.GetHash(), board2.GetHash());
+
+    Card card = GenerateMinionCard("minion1", 1, 2);
+    PlayMinionCard(game1.GetCurrentPlayer(), &card);
+    CHECK(board1.CreateView() != board2.CreateView());
+    CHECK_NE(board1.GetHash(), board2.GetHash());
+
+    PlayMinionCard(game2.GetCurrentPlayer(), &card);
+    CHECK(board1.CreateView() == board2.CreateView());
+    CHECK_EQ(board1.GetHash(), board2.GetHash());
+}
+
+TEST_CASE("[ZobristHash] - GetKey")
+{
+    using Field = ZobristHash::Field;
+
+    CHECK_EQ(ZobristHash::GetKey(Field::HERO_HEALTH, 0, 30),
+             ZobristHash::GetKey(Field::HERO_HEALTH, 0, 30));
+    CHECK_NE(ZobristHash::GetKey(Field::HERO_HEALTH, 0, 30),
+             ZobristHash::GetKey(Field::HERO_HEALTH, 1, 30));
+    CHECK_NE(ZobristHash::GetKey(Field::HERO_HEALTH, 0, 30),
+             ZobristHash::GetKey(Field::HERO_HEALTH, 0, 29));
+    CHECK_NE(ZobristHash::GetKey(Field::HERO_HEALTH, 0, 30),
+             ZobristHash::GetKey(Field::HERO_ATTACK, 0, 30));
+}
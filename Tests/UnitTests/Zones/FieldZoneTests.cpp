@@ -6,10 +6,16 @@
 
 #include "doctest_proxy.hpp"
 
+#include <Commons/AllocationCounter.hpp>
+
+#include <Rosetta/Actions/Summon.hpp>
 #include <Rosetta/Cards/Cards.hpp>
 #include <Rosetta/Games/Game.hpp>
+#include <Rosetta/Tasks/PlayerTasks/AttackTask.hpp>
+#include <Rosetta/Tasks/PlayerTasks/EndTurnTask.hpp>
 #include <Rosetta/Tasks/PlayerTasks/PlayCardTask.hpp>
 #include <Rosetta/Zones/FieldZone.hpp>
+#include <Rosetta/Zones/GraveyardZone.hpp>
 
 using namespace RosettaStone;
 using namespace PlayerTasks;
@@ -83,4 +89,138 @@ TEST_CASE("[FieldZone] - FindIndex")
     CHECK_EQ(curField.FindIndex(character1), 0);
     CHECK_EQ(curField.FindIndex(character2), 1);
     CHECK_EQ(curField.FindIndex(character3), -1);
-}
\ No newline at end of file
+}
+
+TEST_CASE("[FieldZone] - GetView")
+{
+    GameConfig config;
+    config.player1Class = CardClass::WARLOCK;
+    config.player2Class = CardClass::PALADIN;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_START);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    auto& curField = *(curPlayer->GetFieldZone());
+
+    for (const auto& name : { "Flame Imp", "Wisp", "Voidwalker" })
+    {
+        curField.Add(Entity::GetFromCard(curPlayer,
+                                         Cards::FindCardByName(name),
+                                         std::nullopt, &curField));
+    }
+
+    // Destroyed minions are skipped until they are removed from the zone
+    curField[1]->isDestroyed = true;
+
+    std::vector<std::string> names;
+    for (Minion* minion : curField.GetView())
+    {
+        names.emplace_back(minion->card->name);
+    }
+    CHECK_EQ(names.size(), 2u);
+    CHECK_EQ(names[0], "Flame Imp");
+    CHECK_EQ(names[1], "Voidwalker");
+
+    const auto minions = curField.GetAll();
+    CHECK_EQ(minions.size(), 2u);
+    CHECK_EQ(minions[0], curField[0]);
+    CHECK_EQ(minions[1], curField[2]);
+}
+
+TEST_CASE("[FieldZone] - Attack without allocation")
+{
+    GameConfig config;
+    config.player1Class = CardClass::MAGE;
+    config.player2Class = CardClass::WARRIOR;
+    config.startPlayer = PlayerType::PLAYER1;
+    config.doFillDecks = true;
+    config.autoRun = false;
+
+    Game game(config);
+    game.Start();
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    Player* curPlayer = game.GetCurrentPlayer();
+    Player* opPlayer = game.GetOpponentPlayer();
+
+    const auto Summon = [](Player* player, const std::string& name) {
+        const auto minion = dynamic_cast<Minion*>(
+            Entity::GetFromCard(player, Cards::FindCardByName(name)));
+        Generic::Summon(minion, -1, nullptr);
+    };
+
+    for (int i = 0; i < MAX_FIELD_SIZE; ++i)
+    {
+        Summon(curPlayer, "Chillwind Yeti");
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        Summon(opPlayer, "Chillwind Yeti");
+    }
+    Summon(opPlayer, "Boulderfist Ogre");
+    Summon(opPlayer, "Boulderfist Ogre");
+    Summon(opPlayer, "Wisp");
+
+    curPlayer->GetHero()->SetArmor(100);
+    opPlayer->GetHero()->SetArmor(100);
+
+    game.Process(curPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    // The first attacks fill the caches of event data, and the wisp dies
+    auto& curField = *curPlayer->GetFieldZone();
+    auto& opField = *opPlayer->GetFieldZone();
+    game.Process(opPlayer, AttackTask(opField[6], curField[0]));
+    game.Process(opPlayer, AttackTask(opField[0], curPlayer->GetHero()));
+    game.Process(opPlayer, EndTurnTask());
+    game.ProcessUntil(Step::MAIN_ACTION);
+
+    const auto minions = curField.GetAll();
+    const auto opMinions = opField.GetAll();
+    CHECK_EQ(minions[0]->GetHealth(), 4);
+    CHECK_EQ(opMinions.size(), 6u);
+
+    // The minions trade with the opponent's minions: both sides take
+    // damage, and the attackers and the defenders die
+    const std::size_t numAllocations = TestUtils::GetNumAllocations();
+    game.Process(curPlayer, AttackTask(minions[0], opMinions[0]));
+    game.Process(curPlayer, AttackTask(minions[1], opMinions[0]));
+    game.Process(curPlayer, AttackTask(minions[2], opMinions[4]));
+    game.Process(curPlayer, AttackTask(minions[3], opMinions[4]));
+    game.Process(curPlayer, AttackTask(minions[4], opMinions[1]));
+    game.Process(curPlayer, AttackTask(minions[5], opMinions[5]));
+    game.Process(curPlayer, AttackTask(minions[6], opPlayer->GetHero()));
+    const std::size_t numAttackAllocations =
+        TestUtils::GetNumAllocations() - numAllocations;
+
+    CHECK_EQ(numAttackAllocations, 0u);
+
+    // Yetis have 4 attack and 5 health, and ogres have 6 attack and 7 health
+    CHECK_EQ(curField.GetCount(), 3);
+    CHECK_EQ(curField[0], minions[1]);
+    CHECK_EQ(curField[0]->GetHealth(), 1);
+    CHECK_EQ(curField[1], minions[4]);
+    CHECK_EQ(curField[1]->GetHealth(), 1);
+    CHECK_EQ(curField[2], minions[6]);
+    CHECK_EQ(curField[2]->GetHealth(), 5);
+    CHECK_EQ(curPlayer->GetGraveyardZone()->GetCount(), 4);
+
+    CHECK_EQ(opField.GetCount(), 4);
+    CHECK_EQ(opField[0], opMinions[1]);
+    CHECK_EQ(opField[0]->GetHealth(), 1);
+    CHECK_EQ(opField[3], opMinions[5]);
+    CHECK_EQ(opField[3]->GetHealth(), 3);
+    CHECK_EQ(opPlayer->GetGraveyardZone()->GetCount(), 3);
+    CHECK_EQ(opPlayer->GetHero()->GetArmor(), 96);
+
+    for (Minion* minion : curField.GetView())
+    {
+        CHECK(minion->IsExhausted());
+    }
+}
@@ -7,10 +7,15 @@
 #define DOCTEST_CONFIG_IMPLEMENT
 #include <doctest.h>
 
+#include <Rosetta/Games/Game.hpp>
+
 int main()
 {
     doctest::Context context;
 
+    // Check the incremental aura updates against the full recomputation
+    RosettaStone::Game::SetAuraVerification(true);
+
     // Run queries, or run tests unless --no-run is specified
     const int res = context.run();
 